@@ -20,6 +20,7 @@
 */
 
 #include <stdio.h>
+#include <string.h>
 
 /*
 
@@ -27,8 +28,15 @@ Built with:
 
 gcc -o genchancvt build-scripts/gen_audio_channel_conversion.c -lm && ./genchancvt > src/audio/SDL_audio_channel_converters.h
 
+Add -DGENERATE_NEON_CONVERTERS=1 to also generate the NEON converters. They are off until they have been
+built and checked with test/testaudiochannels on ARM.
+
 */
 
+#ifndef GENERATE_NEON_CONVERTERS
+#define GENERATE_NEON_CONVERTERS 0
+#endif
+
 #define NUM_CHANNELS 8
 
 static const char *layout_names[NUM_CHANNELS] = {
@@ -399,6 +407,448 @@ static void write_converter(const int fromchans, const int tochans)
     printf("\n}\n\n");
 }
 
+/* The SIMD converters work one sample frame at a time: the input frame is loaded into a register or two, and each
+   register's worth of output channels is built as a sum of "terms", each one a lane shuffle of an input register
+   times a vector of coefficients. Since most of the conversion matrix is zeros and ones, this usually needs far
+   fewer operations than a full matrix multiply (a lot of upmixing is just copying the input through). Each
+   output lane adds up its inputs in the same order as the scalar converters do, so they get the same results. */
+typedef struct
+{
+    int reg;                /* which input register this term reads from. */
+    int index[8];           /* which lane of that register feeds each output lane, -1 if none. */
+    float coefficient[8];
+} SimdTerm;
+
+typedef struct
+{
+    const char *name;       /* "SSE", "AVX2", "NEON" */
+    const char *target;     /* SDL_TARGETING() string, NULL if not needed. */
+    const char *vectype;
+    int width;              /* lanes per register. */
+    int min_tochans;        /* smaller output layouts waste most of each register; the scalar converters do as well there. */
+} SimdIsa;
+
+static const SimdIsa simd_isas[] = {
+    { "SSE", "sse", "__m128", 4, 2 },
+    { "AVX2", "avx2", "__m256", 8, 5 },
+    { "NEON", NULL, "float32x4_t", 4, 2 }
+};
+
+/* SDL_audiocvt.c has a hand-written SSE mono-to-stereo converter that works on four frames at a time; don't clash with it. */
+static int has_handwritten_converter(const int fromchans, const int tochans, const SimdIsa *isa)
+{
+    return (fromchans == 1) && (tochans == 2) && (strcmp(isa->name, "SSE") == 0);
+}
+
+static int build_simd_terms(const int fromchans, const int tochans, const int first, const int width, SimdTerm *terms)
+{
+    const float *cvtmatrix = channel_conversion_matrix[fromchans-1][tochans-1];
+    int next[8];  /* next input channel to consider for each output lane. */
+    int num_terms = 0;
+    int lane;
+
+    for (lane = 0; lane < width; lane++) {
+        next[lane] = 0;
+    }
+
+    for (;;) {
+        SimdTerm *term;
+        int reg = -1;
+
+        /* the lowest input register that any output lane still needs something from goes next. */
+        for (lane = 0; (lane < width) && ((first + lane) < tochans); lane++) {
+            const float *row = &cvtmatrix[(first + lane) * fromchans];
+            while ((next[lane] < fromchans) && (row[next[lane]] == 0.0f)) {
+                next[lane]++;
+            }
+            if ((next[lane] < fromchans) && ((reg < 0) || ((next[lane] / width) < reg))) {
+                reg = next[lane] / width;
+            }
+        }
+
+        if (reg < 0) {
+            return num_terms;
+        }
+
+        term = &terms[num_terms++];
+        term->reg = reg;
+        for (lane = 0; lane < width; lane++) {
+            const int j = first + lane;
+            if ((j < tochans) && (next[lane] < fromchans) && ((next[lane] / width) == reg)) {
+                term->index[lane] = next[lane] % width;
+                term->coefficient[lane] = cvtmatrix[(j * fromchans) + next[lane]];
+                next[lane]++;
+            } else {
+                term->index[lane] = -1;
+                term->coefficient[lane] = 0.0f;
+            }
+        }
+    }
+}
+
+/* Figure out how to spell a term's (shuffled) input in C, and whether it needs to be scaled at all. Returns non-zero if it does. */
+static int describe_simd_term(const SimdIsa *isa, const SimdTerm *term, const int first, const int fromchans, const int tochans, char *input, const size_t inputlen)
+{
+    const int width = isa->width;
+    /* lanes past the end of the input frame are loaded as zeros. */
+    const int loaded = ((fromchans - (term->reg * width)) < width) ? (fromchans - (term->reg * width)) : width;
+    int index[8];
+    int identity = 1;
+    int broadcast = -1;
+    int needs_coefficients = 0;
+    int lane;
+
+    /* lanes that don't get anything from this term keep their own channel, so the shuffle can often be skipped. */
+    for (lane = 0; lane < width; lane++) {
+        index[lane] = (term->index[lane] < 0) ? lane : term->index[lane];
+        if (index[lane] != lane) {
+            identity = 0;
+        }
+        if (term->index[lane] >= 0) {
+            if (broadcast == -1) {
+                broadcast = term->index[lane];
+            } else if (broadcast != term->index[lane]) {
+                broadcast = -2;
+            }
+        }
+    }
+
+    /* NEON has no cheap general shuffle, but it can splat one lane. */
+    if (!identity && (broadcast >= 0) && (strcmp(isa->name, "NEON") == 0)) {
+        for (lane = 0; lane < width; lane++) {
+            index[lane] = broadcast;
+        }
+    }
+
+    /* a term can skip the multiply if every output lane that gets stored would come out right anyway. */
+    for (lane = 0; (lane < width) && ((first + lane) < tochans); lane++) {
+        if (term->index[lane] >= 0) {
+            if (term->coefficient[lane] != 1.0f) {
+                needs_coefficients = 1;
+            }
+        } else if (index[lane] < loaded) {
+            needs_coefficients = 1;
+        }
+    }
+
+    if (identity) {
+        snprintf(input, inputlen, "in%d", term->reg);
+    } else if (strcmp(isa->name, "SSE") == 0) {
+        snprintf(input, inputlen, "_mm_shuffle_ps(in%d, in%d, _MM_SHUFFLE(%d, %d, %d, %d))", term->reg, term->reg, index[3], index[2], index[1], index[0]);
+    } else if (strcmp(isa->name, "AVX2") == 0) {
+        snprintf(input, inputlen, "_mm256_permutevar8x32_ps(in%d, _mm256_setr_epi32(%d, %d, %d, %d, %d, %d, %d, %d))", term->reg,
+                 index[0], index[1], index[2], index[3], index[4], index[5], index[6], index[7]);
+    } else if (broadcast >= 0) {
+        snprintf(input, inputlen, "vdupq_lane_f32(vget_%s_f32(in%d), %d)", (broadcast < 2) ? "low" : "high", term->reg, broadcast & 1);
+    } else {
+        snprintf(input, inputlen, "SDL_SHUFFLE_CHANNELS_NEON(in%d, %d, %d, %d, %d)", term->reg, index[0], index[1], index[2], index[3]);
+    }
+
+    return needs_coefficients;
+}
+
+static void write_simd_term(const SimdIsa *isa, const SimdTerm *term, const int first, const int fromchans, const int tochans, const int coefficients_row)
+{
+    char input[160];
+    int lane;
+
+    if (!describe_simd_term(isa, term, first, fromchans, tochans, input, sizeof (input))) {
+        printf("%s", input);
+    } else if (strcmp(isa->name, "SSE") == 0) {
+        printf("_mm_mul_ps(%s, _mm_setr_ps(", input);
+        for (lane = 0; lane < 4; lane++) {
+            printf("%s%.9ff", (lane == 0) ? "" : ", ", term->coefficient[lane]);
+        }
+        printf("))");
+    } else if (strcmp(isa->name, "AVX2") == 0) {
+        printf("_mm256_mul_ps(%s, _mm256_setr_ps(", input);
+        for (lane = 0; lane < 8; lane++) {
+            printf("%s%.9ff", (lane == 0) ? "" : ", ", term->coefficient[lane]);
+        }
+        printf("))");
+    } else {
+        printf("vmulq_f32(%s, vld1q_f32(coefficients[%d]))", input, coefficients_row);
+    }
+}
+
+static int term_needs_coefficients(const SimdIsa *isa, const SimdTerm *term, const int first, const int fromchans, const int tochans)
+{
+    char input[160];
+    return describe_simd_term(isa, term, first, fromchans, tochans, input, sizeof (input));
+}
+
+static void write_simd_converter(const int fromchans, const int tochans, const SimdIsa *isa)
+{
+    const char *fromstr = layout_names[fromchans-1];
+    const char *tostr = layout_names[tochans-1];
+    const int convert_backwards = (tochans > fromchans);
+    const int width = isa->width;
+    const int num_inregs = (fromchans + width - 1) / width;
+    const int num_outregs = (tochans + width - 1) / width;
+    SimdTerm terms[2][16];
+    int num_terms[2];
+    int inreg_used[2] = { 0, 0 };
+    int coefficients_row = 0;
+    int i, j;
+
+    if ((tochans == fromchans) || (tochans < isa->min_tochans) || has_handwritten_converter(fromchans, tochans, isa)) {
+        return;
+    }
+
+    for (j = 0; j < num_outregs; j++) {
+        num_terms[j] = build_simd_terms(fromchans, tochans, j * width, width, terms[j]);
+        for (i = 0; i < num_terms[j]; i++) {
+            inreg_used[terms[j][i].reg] = 1;
+        }
+    }
+
+    if (isa->target) {
+        printf("static void SDL_TARGETING(\"%s\") ", isa->target);
+    } else {
+        printf("static void ");
+    }
+    printf("SDL_Convert%sTo%s_%s(float *dst, const float *src, int num_frames)\n{\n", remove_dots(fromstr), remove_dots(tostr), isa->name);
+
+    /* NEON can't build vectors out of constants inline, so keep them in a table. */
+    if (strcmp(isa->name, "NEON") == 0) {
+        const char *comma = "";
+        for (j = 0; j < num_outregs; j++) {
+            for (i = 0; i < num_terms[j]; i++) {
+                if (term_needs_coefficients(isa, &terms[j][i], j * width, fromchans, tochans)) {
+                    int lane;
+                    if (coefficients_row == 0) {
+                        printf("    static const float coefficients[][4] = {");
+                    }
+                    printf("%s\n        {", comma);
+                    for (lane = 0; lane < 4; lane++) {
+                        printf("%s %.9ff", (lane == 0) ? "" : ",", terms[j][i].coefficient[lane]);
+                    }
+                    printf(" }");
+                    comma = ",";
+                    coefficients_row++;
+                }
+            }
+        }
+        if (coefficients_row > 0) {
+            printf("\n    };\n");
+        }
+        coefficients_row = 0;
+    }
+
+    printf("    int i;\n"
+           "\n"
+           "    LOG_DEBUG_AUDIO_CONVERT(\"%s\", ", lowercase(fromstr));
+    printf("\"%s (using %s)\");\n"
+           "\n", lowercase(tostr), isa->name);
+
+    if (convert_backwards) {
+        printf("    // convert backwards, since output is growing in-place.\n");
+        printf("    src += (num_frames-1)");
+        if (fromchans != 1) {
+            printf(" * %d", fromchans);
+        }
+        printf(";\n");
+        printf("    dst += (num_frames-1) * %d;\n", tochans);
+        printf("    for (i = num_frames; i; i--, ");
+        if (fromchans == 1) {
+            printf("src--");
+        } else {
+            printf("src -= %d", fromchans);
+        }
+        printf(", dst -= %d) {\n", tochans);
+    } else {
+        printf("    for (i = num_frames; i; i--, src += %d, ", fromchans);
+        if (tochans == 1) {
+            printf("dst++");
+        } else {
+            printf("dst += %d", tochans);
+        }
+        printf(") {\n");
+    }
+
+    /* load the whole input frame before storing anything, in case we're converting in-place. */
+    for (i = 0; i < num_inregs; i++) {
+        if (inreg_used[i]) {
+            const int count = ((fromchans - (i * width)) < width) ? (fromchans - (i * width)) : width;
+            printf("        const %s in%d = SDL_LoadChannels_%s(src", isa->vectype, i, isa->name);
+            if (i > 0) {
+                printf(" + %d", i * width);
+            }
+            printf(", %d);\n", count);
+        }
+    }
+
+    for (j = 0; j < num_outregs; j++) {
+        if (num_terms[j] == 0) {
+            printf("        const %s out%d = ", isa->vectype, j);
+            if (strcmp(isa->name, "SSE") == 0) {
+                printf("_mm_setzero_ps();\n");
+            } else if (strcmp(isa->name, "AVX2") == 0) {
+                printf("_mm256_setzero_ps();\n");
+            } else {
+                printf("vdupq_n_f32(0.0f);\n");
+            }
+            continue;
+        }
+
+        printf("        %s%s out%d = ", (num_terms[j] == 1) ? "const " : "", isa->vectype, j);
+        for (i = 0; i < num_terms[j]; i++) {
+            const SimdTerm *term = &terms[j][i];
+            if (i > 0) {
+                if (strcmp(isa->name, "SSE") == 0) {
+                    printf("        out%d = _mm_add_ps(out%d, ", j, j);
+                } else if (strcmp(isa->name, "AVX2") == 0) {
+                    printf("        out%d = _mm256_add_ps(out%d, ", j, j);
+                } else {
+                    printf("        out%d = vaddq_f32(out%d, ", j, j);
+                }
+            }
+            write_simd_term(isa, term, j * width, fromchans, tochans, coefficients_row);
+            printf("%s;\n", (i > 0) ? ")" : "");
+            if (term_needs_coefficients(isa, term, j * width, fromchans, tochans)) {
+                coefficients_row++;
+            }
+        }
+    }
+
+    for (j = 0; j < num_outregs; j++) {
+        const int count = ((tochans - (j * width)) < width) ? (tochans - (j * width)) : width;
+        printf("        SDL_StoreChannels_%s(dst", isa->name);
+        if (j > 0) {
+            printf(" + %d", j * width);
+        }
+        printf(", out%d, %d);\n", j, count);
+    }
+
+    printf("    }\n"
+           "}\n\n");
+}
+
+static void write_simd_converters(const SimdIsa *isa)
+{
+    int ini, outi;
+
+    for (ini = 1; ini <= NUM_CHANNELS; ini++) {
+        for (outi = 1; outi <= NUM_CHANNELS; outi++) {
+            write_simd_converter(ini, outi, isa);
+        }
+    }
+
+    printf("static const SDL_AudioChannelConverter channel_converters_%s[%d][%d] = {   /* [from][to] */\n", isa->name, NUM_CHANNELS, NUM_CHANNELS);
+    for (ini = 1; ini <= NUM_CHANNELS; ini++) {
+        const char *comma = "";
+        printf("    {");
+        for (outi = 1; outi <= NUM_CHANNELS; outi++) {
+            const char *fromstr = layout_names[ini-1];
+            const char *tostr = layout_names[outi-1];
+            if ((ini == outi) || (outi < isa->min_tochans) || has_handwritten_converter(ini, outi, isa)) {
+                printf("%s NULL", comma);
+            } else {
+                printf("%s SDL_Convert%sTo%s_%s", comma, remove_dots(fromstr), remove_dots(tostr), isa->name);
+            }
+            comma = ",";
+        }
+        printf(" }%s\n", (ini == NUM_CHANNELS) ? "" : ",");
+    }
+
+    printf("};\n\n");
+}
+
+static const char *sse_helpers =
+    "#ifdef SDL_SSE_INTRINSICS\n"
+    "// Load `count` (1 to 4) channels, zeroing the unused lanes; the SIMD converters never touch memory past the end of a frame, so they can run in-place.\n"
+    "SDL_FORCE_INLINE __m128 SDL_TARGETING(\"sse\") SDL_LoadChannels_SSE(const float *src, const int count)\n"
+    "{\n"
+    "    if (count == 4) {\n"
+    "        return _mm_loadu_ps(src);\n"
+    "    } else if (count == 1) {\n"
+    "        return _mm_load_ss(src);\n"
+    "    } else if (count == 2) {\n"
+    "        return _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)src);\n"
+    "    }\n"
+    "    return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)src), _mm_load_ss(src + 2));\n"
+    "}\n"
+    "\n"
+    "// Store the first `count` (1 to 4) lanes of `v`.\n"
+    "SDL_FORCE_INLINE void SDL_TARGETING(\"sse\") SDL_StoreChannels_SSE(float *dst, const __m128 v, const int count)\n"
+    "{\n"
+    "    if (count == 4) {\n"
+    "        _mm_storeu_ps(dst, v);\n"
+    "    } else if (count == 1) {\n"
+    "        _mm_store_ss(dst, v);\n"
+    "    } else {\n"
+    "        _mm_storel_pi((__m64 *)dst, v);\n"
+    "        if (count == 3) {\n"
+    "            _mm_store_ss(dst + 2, _mm_movehl_ps(v, v));\n"
+    "        }\n"
+    "    }\n"
+    "}\n"
+    "\n";
+
+static const char *avx2_helpers =
+    "#ifdef SDL_AVX2_INTRINSICS\n"
+    "// Load `count` (1 to 8) channels, zeroing the unused lanes.\n"
+    "SDL_FORCE_INLINE __m256 SDL_TARGETING(\"avx2\") SDL_LoadChannels_AVX2(const float *src, const int count)\n"
+    "{\n"
+    "    if (count == 8) {\n"
+    "        return _mm256_loadu_ps(src);\n"
+    "    } else if (count > 4) {\n"
+    "        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)), SDL_LoadChannels_SSE(src + 4, count - 4), 1);\n"
+    "    }\n"
+    "    return _mm256_insertf128_ps(_mm256_setzero_ps(), SDL_LoadChannels_SSE(src, count), 0);\n"
+    "}\n"
+    "\n"
+    "// Store the first `count` (1 to 8) lanes of `v`.\n"
+    "SDL_FORCE_INLINE void SDL_TARGETING(\"avx2\") SDL_StoreChannels_AVX2(float *dst, const __m256 v, const int count)\n"
+    "{\n"
+    "    if (count == 8) {\n"
+    "        _mm256_storeu_ps(dst, v);\n"
+    "    } else if (count > 4) {\n"
+    "        _mm_storeu_ps(dst, _mm256_castps256_ps128(v));\n"
+    "        SDL_StoreChannels_SSE(dst + 4, _mm256_extractf128_ps(v, 1), count - 4);\n"
+    "    } else {\n"
+    "        SDL_StoreChannels_SSE(dst, _mm256_castps256_ps128(v), count);\n"
+    "    }\n"
+    "}\n"
+    "\n";
+
+static const char *neon_helpers =
+    "#ifdef SDL_NEON_INTRINSICS\n"
+    "#define SDL_NEON_CHANNEL_CONVERTERS 1\n"
+    "\n"
+    "// Load `count` (1 to 4) channels, zeroing the unused lanes; the SIMD converters never touch memory past the end of a frame, so they can run in-place.\n"
+    "SDL_FORCE_INLINE float32x4_t SDL_LoadChannels_NEON(const float *src, const int count)\n"
+    "{\n"
+    "    if (count == 4) {\n"
+    "        return vld1q_f32(src);\n"
+    "    } else if (count == 1) {\n"
+    "        return vld1q_lane_f32(src, vdupq_n_f32(0.0f), 0);\n"
+    "    } else if (count == 2) {\n"
+    "        return vcombine_f32(vld1_f32(src), vdup_n_f32(0.0f));\n"
+    "    }\n"
+    "    return vld1q_lane_f32(src + 2, vcombine_f32(vld1_f32(src), vdup_n_f32(0.0f)), 2);\n"
+    "}\n"
+    "\n"
+    "// Store the first `count` (1 to 4) lanes of `v`.\n"
+    "SDL_FORCE_INLINE void SDL_StoreChannels_NEON(float *dst, const float32x4_t v, const int count)\n"
+    "{\n"
+    "    if (count == 4) {\n"
+    "        vst1q_f32(dst, v);\n"
+    "    } else if (count == 1) {\n"
+    "        vst1q_lane_f32(dst, v, 0);\n"
+    "    } else {\n"
+    "        vst1_f32(dst, vget_low_f32(v));\n"
+    "        if (count == 3) {\n"
+    "            vst1q_lane_f32(dst + 2, v, 2);\n"
+    "        }\n"
+    "    }\n"
+    "}\n"
+    "\n"
+    "// NEON has no general single-register float shuffle that works on both 32 and 64-bit ARM, so move the lanes one at a time.\n"
+    "#define SDL_SHUFFLE_CHANNELS_NEON(v, a, b, c, d) \\\n"
+    "    vsetq_lane_f32(vgetq_lane_f32(v, d), vsetq_lane_f32(vgetq_lane_f32(v, c), vsetq_lane_f32(vgetq_lane_f32(v, b), vdupq_n_f32(vgetq_lane_f32(v, a)), 1), 2), 3)\n"
+    "\n";
+
 int main(void)
 {
     int ini, outi;
@@ -457,5 +907,22 @@ int main(void)
 
     printf("};\n\n");
 
+    printf("// SIMD versions of the above, built from the same matrices. Each output register is a sum of lane shuffles\n"
+           "// of the input frame, scaled by constant coefficients, with the zero terms left out.\n"
+           "\n");
+
+    fputs(sse_helpers, stdout);
+    write_simd_converters(&simd_isas[0]);
+    fputs(avx2_helpers, stdout);
+    write_simd_converters(&simd_isas[1]);
+    printf("#endif // SDL_AVX2_INTRINSICS\n\n");
+    printf("#endif // SDL_SSE_INTRINSICS\n\n");
+
+    if (GENERATE_NEON_CONVERTERS) {
+        fputs(neon_helpers, stdout);
+        write_simd_converters(&simd_isas[2]);
+        printf("#endif // SDL_NEON_INTRINSICS\n\n");
+    }
+
     return 0;
 }
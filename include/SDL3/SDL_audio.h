@@ -334,6 +334,21 @@ typedef struct SDL_AudioSpec
  */
 typedef struct SDL_AudioStream SDL_AudioStream;
 
+/**
+ * How an audio stream resamples, trading quality for CPU time.
+ *
+ * \since This enum is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamProperties
+ * \sa SDL_HINT_AUDIO_RESAMPLING_QUALITY
+ */
+typedef enum SDL_AudioResamplingQuality
+{
+    SDL_AUDIO_RESAMPLING_LOW,           /**< Linear interpolation; cheapest, but lets some aliasing through. Fine for UI sound effects. */
+    SDL_AUDIO_RESAMPLING_MEDIUM,        /**< A 12-tap windowed sinc filter (default) */
+    SDL_AUDIO_RESAMPLING_HIGH           /**< A 32-tap windowed sinc filter, with a sharper cutoff and less aliasing */
+} SDL_AudioResamplingQuality;
+
 
 /* Function prototypes */
 
@@ -524,6 +539,72 @@ extern SDL_DECLSPEC const char *SDLCALL SDL_GetAudioDeviceName(SDL_AudioDeviceID
  */
 extern SDL_DECLSPEC int SDLCALL SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *sample_frames);
 
+/**
+ * Get the properties associated with an audio device.
+ *
+ * Logical devices report the properties of the physical device they are
+ * opened on, so the counters below include the work done for every logical
+ * device sharing it. The counters are reset when the physical device is
+ * opened, and are refreshed each time this function is called.
+ *
+ * The following read-only properties are provided by SDL:
+ *
+ * - `SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER`: the number of buffers the device
+ *   thread has played or recorded.
+ * - `SDL_PROP_AUDIO_DEVICE_UNDERRUNS_NUMBER`: the number of those buffers
+ *   where at least one bound, unpaused stream couldn't provide all the data
+ *   that was needed (or, for recording devices, where the device provided
+ *   less than a full buffer).
+ * - `SDL_PROP_AUDIO_DEVICE_SHORT_READS_NUMBER`: the total number of stream
+ *   reads that came up short; one underrun can include several.
+ * - `SDL_PROP_AUDIO_DEVICE_LATE_WAKEUPS_NUMBER`: the number of times the
+ *   device thread woke up more than half a buffer later than expected.
+ * - `SDL_PROP_AUDIO_DEVICE_MAX_LATENESS_NS_NUMBER`: the latest the device
+ *   thread has woken up, in nanoseconds past the expected time.
+ * - `SDL_PROP_AUDIO_DEVICE_MAX_ITERATE_NS_NUMBER`: the longest the device
+ *   thread has spent producing or consuming one buffer, in nanoseconds,
+ *   including time spent in stream callbacks.
+ * - `SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_POINTER`: a (const Sint64 *)
+ *   array counting buffers by the time the device thread spent on them. The
+ *   first element counts buffers that took less than 1/64 of the buffer's
+ *   duration, each following element doubles that limit, and the last
+ *   element counts buffers that took the buffer's whole duration or longer.
+ *   The array is valid until the next call to this function or until the
+ *   device is closed.
+ * - `SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_BUCKETS_NUMBER`: the number of
+ *   elements in the histogram array.
+ * - `SDL_PROP_AUDIO_DEVICE_RESAMPLE_NS_NUMBER`: the total time, in
+ *   nanoseconds, that bound streams spent resampling for the device.
+ * - `SDL_PROP_AUDIO_DEVICE_CONVERT_NS_NUMBER`: the total time, in
+ *   nanoseconds, that bound streams spent on everything else (format and
+ *   channel conversion, gain and mixing), not counting stream callbacks.
+ *
+ * Keeping these counters is cheap, so SDL always does it.
+ *
+ * \param devid the instance ID of the device to query.
+ * \returns a valid property ID on success or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetProperty
+ * \sa SDL_GetAudioStreamProperties
+ */
+extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid);
+
+#define SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER                   "SDL.audio.device.periods"
+#define SDL_PROP_AUDIO_DEVICE_UNDERRUNS_NUMBER                 "SDL.audio.device.underruns"
+#define SDL_PROP_AUDIO_DEVICE_SHORT_READS_NUMBER               "SDL.audio.device.short_reads"
+#define SDL_PROP_AUDIO_DEVICE_LATE_WAKEUPS_NUMBER              "SDL.audio.device.late_wakeups"
+#define SDL_PROP_AUDIO_DEVICE_MAX_LATENESS_NS_NUMBER           "SDL.audio.device.max_lateness_ns"
+#define SDL_PROP_AUDIO_DEVICE_MAX_ITERATE_NS_NUMBER            "SDL.audio.device.max_iterate_ns"
+#define SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_POINTER        "SDL.audio.device.iterate_histogram"
+#define SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_BUCKETS_NUMBER "SDL.audio.device.iterate_histogram_buckets"
+#define SDL_PROP_AUDIO_DEVICE_RESAMPLE_NS_NUMBER               "SDL.audio.device.resample_ns"
+#define SDL_PROP_AUDIO_DEVICE_CONVERT_NS_NUMBER                "SDL.audio.device.convert_ns"
+
 
 /**
  * Open a specific audio device.
@@ -841,6 +922,35 @@ extern SDL_DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStream(const SDL_Aud
 /**
  * Get the properties associated with an audio stream.
  *
+ * The following read-write properties are provided by SDL:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_RESAMPLING_QUALITY_NUMBER`: an
+ *   SDL_AudioResamplingQuality value, used the next time the stream
+ *   resamples. Defaults to SDL_HINT_AUDIO_RESAMPLING_QUALITY, as it was when
+ *   the stream was created. When the stream's frequency ratio is 1.0 and the
+ *   input and output rates reduce to a simple enough fraction (like 44100Hz
+ *   to 48000Hz), the sinc filters may be computed once per stream, instead of
+ *   for every output frame.
+ * - `SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN`: true if data is only
+ *   ever put into the stream by one thread at a time. SDL_PutAudioStreamData()
+ *   can then add it to the stream without locking it, so a thread getting
+ *   data from the stream, like an audio device it is bound to, never has to
+ *   wait for a put to finish copying. Puts still lock the stream when they
+ *   have to: the first one after the stream's format changes, and all of them
+ *   while a put callback is set. SDL_PutAudioStreamBuffer() always locks the
+ *   stream. Data must not be put into the stream from its get callback while
+ *   this is set. Defaults to false.
+ *
+ * The following read-only properties are updated by SDL each time this
+ * function is called:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_SHORT_READS_NUMBER`: the number of times reading
+ *   from the stream, by the app or by an audio device it is bound to,
+ *   returned less data than was requested.
+ * - `SDL_PROP_AUDIOSTREAM_DEVICE_QUEUED_FRAMES_NUMBER`: the number of
+ *   converted sample frames that were still available when the audio device
+ *   the stream is bound to last pulled data from it.
+ *
  * \param stream the SDL_AudioStream to query.
  * \returns a valid property ID on success or 0 on failure; call
  *          SDL_GetError() for more information.
@@ -852,6 +962,11 @@ extern SDL_DECLSPEC SDL_AudioStream *SDLCALL SDL_CreateAudioStream(const SDL_Aud
  */
 extern SDL_DECLSPEC SDL_PropertiesID SDLCALL SDL_GetAudioStreamProperties(SDL_AudioStream *stream);
 
+#define SDL_PROP_AUDIOSTREAM_RESAMPLING_QUALITY_NUMBER "SDL.audiostream.resampling_quality"
+#define SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN   "SDL.audiostream.single_producer"
+#define SDL_PROP_AUDIOSTREAM_SHORT_READS_NUMBER         "SDL.audiostream.short_reads"
+#define SDL_PROP_AUDIOSTREAM_DEVICE_QUEUED_FRAMES_NUMBER "SDL.audiostream.device_queued_frames"
+
 /**
  * Query the current format of an audio stream.
  *
@@ -945,6 +1060,52 @@ extern SDL_DECLSPEC float SDLCALL SDL_GetAudioStreamFrequencyRatio(SDL_AudioStre
  */
 extern SDL_DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float ratio);
 
+/**
+ * Get the gain of an audio stream.
+ *
+ * The gain of a stream is its volume; a larger gain means a louder output,
+ * with a gain of zero being silence.
+ *
+ * Audio streams default to a gain of 1.0f (no change in output).
+ *
+ * \param stream the SDL_AudioStream to query.
+ * \returns the gain of the stream, or -1.0f on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_SetAudioStreamGain
+ */
+extern SDL_DECLSPEC float SDLCALL SDL_GetAudioStreamGain(SDL_AudioStream *stream);
+
+/**
+ * Change the gain of an audio stream.
+ *
+ * The gain of a stream is its volume; a larger gain means a louder output,
+ * with a gain of zero being silence.
+ *
+ * Audio streams default to a gain of 1.0f (no change in output).
+ *
+ * This is applied during SDL_GetAudioStreamData, and can be continuously
+ * changed to create various effects. When the stream is bound to a playback
+ * device, the gain is applied as the stream's output is mixed into the
+ * device's buffer, without a separate pass over the data.
+ *
+ * \param stream the stream on which the gain is being changed.
+ * \param gain the gain. 1.0f is no change, 0.0f is silence.
+ * \returns 0 on success, or -1 on error.
+ *
+ * \threadsafety It is safe to call this function from any thread, as it holds
+ *               a stream-specific mutex while running.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetAudioStreamGain
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain);
+
 /**
  * Add data to the stream.
  *
@@ -964,7 +1125,9 @@ extern SDL_DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream
  *
  * \threadsafety It is safe to call this function from any thread, but if the
  *               stream has a callback set, the caller might need to manage
- *               extra locking.
+ *               extra locking. If the stream has
+ *               SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN set, only one
+ *               thread may put data into it at a time.
  *
  * \since This function is available since SDL 3.0.0.
  *
@@ -975,6 +1138,68 @@ extern SDL_DECLSPEC int SDLCALL SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream
  */
 extern SDL_DECLSPEC int SDLCALL SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len);
 
+/**
+ * A callback that fires when SDL no longer needs a buffer added with
+ * SDL_PutAudioStreamBuffer.
+ *
+ * This fires once the last sample frame of the buffer has been read from the
+ * stream, or when the stream is cleared or destroyed before that happens.
+ * After this, the app is free to reuse or free the buffer.
+ *
+ * This callback is called while the stream's lock is held, and may be called
+ * from any thread, including the audio device thread if the stream is bound
+ * to a device. It should return quickly, and it must not call any functions
+ * on this stream.
+ *
+ * \param userdata an opaque pointer provided by the app for their personal
+ *                 use.
+ * \param buf the buffer that was passed to SDL_PutAudioStreamBuffer.
+ * \param buflen the length of `buf`, in bytes.
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_PutAudioStreamBuffer
+ */
+typedef void (SDLCALL *SDL_ReleaseAudioBufferCallback)(void *userdata, const void *buf, int buflen);
+
+/**
+ * Add data to the stream without copying it.
+ *
+ * This works like SDL_PutAudioStreamData, except the stream refers to `buf`
+ * directly instead of copying it. This saves a copy, and the memory it would
+ * need, when adding large buffers of audio, like decoded music.
+ *
+ * The app must not change or free `buf` until `callback` is called, which
+ * happens once the stream has read the last sample frame of the buffer, or
+ * the stream is cleared or destroyed. If `callback` is NULL, the app must
+ * otherwise make sure `buf` outlives its use by the stream.
+ *
+ * If this function fails, the stream does not keep a reference to `buf`, and
+ * `callback` is not called.
+ *
+ * \param stream the stream the audio data is being added to.
+ * \param buf a pointer to the audio data to add.
+ * \param len the number of bytes in `buf`. This must be a whole number of
+ *            sample frames.
+ * \param callback the function to call once the stream is done with `buf`,
+ *                 may be NULL.
+ * \param userdata an opaque pointer that is passed to `callback`.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread, but if the
+ *               stream has a callback set, the caller might need to manage
+ *               extra locking.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_ClearAudioStream
+ * \sa SDL_FlushAudioStream
+ * \sa SDL_GetAudioStreamData
+ * \sa SDL_PutAudioStreamData
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void *userdata);
+
 /**
  * Get converted/resampled data from the stream.
  *
@@ -1621,6 +1846,116 @@ extern SDL_DECLSPEC int SDLCALL SDL_LoadWAV_IO(SDL_IOStream * src, SDL_bool clos
 extern SDL_DECLSPEC int SDLCALL SDL_LoadWAV(const char *path, SDL_AudioSpec * spec,
                                         Uint8 ** audio_buf, Uint32 * audio_len);
 
+/**
+ * Create an audio stream that decodes a WAVE file on demand.
+ *
+ * Unlike SDL_LoadWAV_IO, this doesn't read and decode all of the audio data
+ * up front. Only the headers are read before this function returns. The
+ * audio data is read from `src` and decoded a block at a time whenever data
+ * is requested from the stream, so the memory used doesn't depend on the
+ * length of the file. This supports the same encodings as SDL_LoadWAV_IO and
+ * honors the same hints.
+ *
+ * The stream's input format is the format of the decoded data, which is also
+ * reported in `spec`. The output format starts out the same; change it with
+ * SDL_SetAudioStreamFormat() or bind the stream to an audio device, which
+ * sets it to the device's format.
+ *
+ * The stream uses its get callback to decode data, so don't set another one.
+ * Data may still be put into the stream, but it will be mixed up with the
+ * decoded data. Once the end of the file is reached, the stream is flushed.
+ *
+ * If reading or decoding the file fails, for example because it's corrupt or
+ * truncated and `SDL_HINT_WAVE_TRUNCATION` is strict, decoding stops without
+ * flushing the stream and the error message is stored in the
+ * `SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING` property. SDL_SeekWAVStream()
+ * clears the error and tries again from the new position.
+ *
+ * The data source has to support seeking and must stay valid until the stream
+ * is destroyed. If `closeio` is SDL_TRUE, SDL_DestroyAudioStream() closes it.
+ *
+ * The following properties are set on the stream:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_WAVE_FRAMES_NUMBER`: the number of sample frames in
+ *   the WAVE file.
+ *
+ * These properties may be set on the stream while it's being read:
+ *
+ * - `SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING`: the error message if reading or
+ *   decoding the file failed.
+ *
+ * \param src the data source for the WAVE data.
+ * \param closeio if SDL_TRUE, calls SDL_CloseIO() on `src` when the stream is
+ *                destroyed, or before returning if an error occurs.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return, may be NULL.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAV_IO
+ * \sa SDL_LoadWAVStream
+ * \sa SDL_SeekWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream *SDLCALL SDL_LoadWAVStream_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec);
+
+#define SDL_PROP_AUDIOSTREAM_WAVE_FRAMES_NUMBER "SDL.audiostream.wave.frames"
+#define SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING  "SDL.audiostream.wave.error"
+
+/**
+ * Create an audio stream that decodes a WAVE file from a file path on demand.
+ *
+ * This is a convenience function that is effectively the same as:
+ *
+ * ```c
+ * SDL_LoadWAVStream_IO(SDL_IOFromFile(path, "rb"), 1, spec);
+ * ```
+ *
+ * \param path the file path of the WAV file to open.
+ * \param spec a pointer to an SDL_AudioSpec that will be set to the WAVE
+ *             data's format details on successful return, may be NULL.
+ * \returns a new audio stream on success or NULL on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_DestroyAudioStream
+ * \sa SDL_LoadWAVStream_IO
+ * \sa SDL_SeekWAVStream
+ */
+extern SDL_DECLSPEC SDL_AudioStream *SDLCALL SDL_LoadWAVStream(const char *path, SDL_AudioSpec *spec);
+
+/**
+ * Move the decoding position of a WAVE audio stream to a sample frame.
+ *
+ * This clears the stream, so any data that was decoded but not yet obtained
+ * from the stream is dropped, and decoding continues at `frame` the next time
+ * data is requested. Seeking to the number of sample frames in the file is
+ * allowed and makes the stream end. Seeking also clears an error that stopped
+ * decoding, see `SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING`.
+ *
+ * For ADPCM encoded files, the block containing `frame` is decoded from its
+ * start, so seeking is exact but costs up to one block of decoding.
+ *
+ * \param stream an audio stream created by SDL_LoadWAVStream_IO().
+ * \param frame the sample frame to continue decoding at.
+ * \returns 0 on success or -1 on failure; call SDL_GetError() for more
+ *          information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_LoadWAVStream_IO
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SeekWAVStream(SDL_AudioStream *stream, Uint64 frame);
+
 /**
  * Mix audio data in a specified format.
  *
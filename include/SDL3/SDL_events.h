@@ -1057,6 +1057,26 @@ extern SDL_DECLSPEC void SDLCALL SDL_FlushEvent(Uint32 type);
  */
 extern SDL_DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType);
 
+/**
+ * Get the number of events that were merged into an earlier queued event.
+ *
+ * When SDL_HINT_EVENT_COALESCE_MOTION is enabled, SDL_EVENT_MOUSE_MOTION,
+ * SDL_EVENT_PEN_MOTION and SDL_EVENT_GAMEPAD_SENSOR_UPDATE events generated
+ * by SDL are folded into the most recently queued event if it's of the same
+ * type and comes from the same device and window. This returns how many
+ * events of the given type have been folded since the event subsystem was
+ * initialized.
+ *
+ * \param type the type of event to query; see SDL_EventType for details.
+ * \returns the number of events of this type that were coalesced, or 0 if
+ *          events of this type are never coalesced.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_HINT_EVENT_COALESCE_MOTION
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_GetCoalescedEventCount(Uint32 type);
+
 /**
  * Poll for currently pending events.
  *
@@ -1102,6 +1122,46 @@ extern SDL_DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType)
  */
 extern SDL_DECLSPEC SDL_bool SDLCALL SDL_PollEvent(SDL_Event *event);
 
+/**
+ * Poll for many currently pending events at once.
+ *
+ * This pumps events once and then removes up to `numevents` events from the
+ * queue, storing them in `events`, in a single pass over the queue. It stops
+ * at the same point SDL_PollEvent() would start returning SDL_FALSE, so the
+ * following two loops see the same events:
+ *
+ * ```c
+ * SDL_Event event;
+ * while (SDL_PollEvent(&event)) {
+ *     // decide what to do with this event.
+ * }
+ *
+ * SDL_Event events[64];
+ * int count;
+ * while ((count = SDL_PollEvents(events, SDL_arraysize(events))) > 0) {
+ *     for (int i = 0; i < count; ++i) {
+ *         // decide what to do with events[i].
+ *     }
+ * }
+ * ```
+ *
+ * As this function may implicitly call SDL_PumpEvents(), you can only call
+ * this function in the thread that set the video mode.
+ *
+ * \param events an array of SDL_Event structures to be filled with the next
+ *               events from the queue.
+ * \param numevents the maximum number of events to return.
+ * \returns the number of events stored in `events`, 0 if there are none
+ *          available, or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_PollEvent
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_PollEvents(SDL_Event *events, int numevents);
+
 /**
  * Wait indefinitely for the next available event.
  *
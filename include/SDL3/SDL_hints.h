@@ -427,6 +427,89 @@ extern "C" {
  */
 #define SDL_HINT_AUDIO_INCLUDE_MONITORS "SDL_AUDIO_INCLUDE_MONITORS"
 
+/**
+ * A variable controlling how many worker threads help a playback device pull
+ * data from its bound audio streams.
+ *
+ * By default, the device thread gets data from each bound stream in turn.
+ * When many streams are bound and each one has to convert or resample, this
+ * can take longer than the device's buffer lasts. Setting this hint to a
+ * number greater than zero creates that many extra threads per opened
+ * playback device, which get data from the streams in parallel with the
+ * device thread; the results are then mixed in the usual order, so the
+ * output and SDL_SetAudioPostmixCallback() behave the same either way.
+ * Parallel gets are only used when at least a handful of streams are bound.
+ *
+ * Note that stream callbacks (SDL_SetAudioStreamGetCallback(), etc) may
+ * then run on these worker threads, several at once, and must not lock or
+ * otherwise change the audio device they are bound to.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Streams are only read from the device thread. (default)
+ * - A number greater than zero: the number of extra threads to use.
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_AUDIO_MIXING_THREADS "SDL_AUDIO_MIXING_THREADS"
+
+/**
+ * A variable controlling whether the "disk" and "dummy" audio drivers render
+ * playback as fast as possible instead of in real time.
+ *
+ * This is meant for rendering audio in batch jobs and automated tests, and
+ * for measuring how fast SDL can convert and mix audio streams.
+ *
+ * When enabled, a playback device doesn't wait for a clock between buffers.
+ * Instead, it waits until every audio stream bound to it (on an unpaused
+ * logical device) can fill the next buffer. Streams that have a get callback
+ * (see SDL_SetAudioStreamGetCallback()) can always do this, as they are asked
+ * for data as it is needed; other streams can when enough data has been put
+ * into them, or when they have been flushed with SDL_FlushAudioStream(). Time
+ * stands still while nothing is bound, so no silence is rendered until audio
+ * is available.
+ *
+ * This makes the output depend only on the data given to the streams, not on
+ * how quickly it arrives, so the same audio renders to the same bytes every
+ * time. Each buffer advances the device's virtual clock by the device's
+ * buffer size; SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER (see
+ * SDL_GetAudioDeviceProperties()) reports how many buffers were rendered.
+ *
+ * Note that a bound stream that is never fed or flushed will stop the device.
+ * Unbind or pause streams that aren't playing anything. Recording devices
+ * aren't affected by this hint.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Audio is rendered in real time. (default)
+ * - "1": Audio is rendered as fast as the streams can provide it.
+ *
+ * This hint should be set before an audio device is opened.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_AUDIO_OFFLINE_RENDERING "SDL_AUDIO_OFFLINE_RENDERING"
+
+/**
+ * A variable controlling the default resampling quality of new audio streams.
+ *
+ * Streams can override this with the
+ * `SDL_PROP_AUDIOSTREAM_RESAMPLING_QUALITY_NUMBER` property.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "low": Linear interpolation, which is the cheapest.
+ * - "medium": A 12-tap windowed sinc filter. (default)
+ * - "high": A 32-tap windowed sinc filter.
+ *
+ * This hint should be set before creating an audio stream.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_AUDIO_RESAMPLING_QUALITY "SDL_AUDIO_RESAMPLING_QUALITY"
+
 /**
  * A variable controlling whether SDL updates joystick state when getting
  * input events.
@@ -661,6 +744,30 @@ extern "C" {
  */
 #define SDL_HINT_ENABLE_SCREEN_KEYBOARD "SDL_ENABLE_SCREEN_KEYBOARD"
 
+/**
+ * A variable controlling whether motion events are merged while they wait in
+ * the event queue.
+ *
+ * When the application falls behind, consecutive SDL_EVENT_MOUSE_MOTION,
+ * SDL_EVENT_PEN_MOTION and SDL_EVENT_GAMEPAD_SENSOR_UPDATE events from the
+ * same device and window are folded into the one already at the end of the
+ * queue. The merged event keeps the latest position, state and timestamp, and
+ * mouse motion events accumulate their relative motion, so the sum of `xrel`
+ * and `yrel` is unchanged. Event watchers still see every event.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Every motion event is queued. (default)
+ * - "1": Consecutive motion events are merged.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetCoalescedEventCount
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION "SDL_EVENT_COALESCE_MOTION"
+
 /**
  * A variable controlling verbosity of the logging of SDL events pushed onto
  * the internal queue.
@@ -2806,6 +2913,33 @@ extern "C" {
  */
 #define SDL_HINT_STORAGE_USER_DRIVER "SDL_STORAGE_USER_DRIVER"
 
+/**
+ * A variable controlling how many worker threads help with large surface
+ * blits.
+ *
+ * By default, SDL_BlitSurface(), SDL_ConvertSurface(), SDL_BlitSurfaceScaled()
+ * and friends run entirely on the calling thread. Setting this hint to a
+ * number greater than zero creates that many extra threads, shared by the
+ * whole process, and large blits are split into horizontal bands that run on
+ * them and the calling thread at the same time. The output is the same either
+ * way.
+ *
+ * Blits that read or write a palette, RLE accelerated blits, and scaled blits
+ * between different formats always run on the calling thread. If another
+ * thread is already using the workers, the blit also runs on the calling
+ * thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0": Blits only run on the calling thread. (default)
+ * - A number greater than zero: the number of extra threads to use.
+ *
+ * This hint can be set anytime.
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_SURFACE_BLIT_THREADS "SDL_SURFACE_BLIT_THREADS"
+
 /**
  * Specifies whether SDL_THREAD_PRIORITY_TIME_CRITICAL should be treated as
  * realtime.
@@ -3320,6 +3454,27 @@ extern "C" {
  */
 #define SDL_HINT_VITA_TOUCH_MOUSE_DEVICE    "SDL_VITA_TOUCH_MOUSE_DEVICE"
 
+/**
+ * A variable controlling how many threads decode a large ADPCM WAVE file.
+ *
+ * MS ADPCM and IMA ADPCM data is made of independent blocks. When a file
+ * holds a lot of sample frames, SDL_LoadWAV() and SDL_LoadWAV_IO() split its
+ * blocks between several threads that are started for the call and finish
+ * before it returns. Short files are always decoded on the calling thread.
+ *
+ * The variable can be set to the following values:
+ *
+ * - "0" - Use up to one thread per CPU core. (default)
+ * - "1" - Decode on the calling thread only.
+ * - A larger number: the maximum number of threads to use, including the
+ *   calling thread.
+ *
+ * This hint should be set before calling SDL_LoadWAV() or SDL_LoadWAV_IO()
+ *
+ * \since This hint is available since SDL 3.0.0.
+ */
+#define SDL_HINT_WAVE_DECODE_THREADS   "SDL_WAVE_DECODE_THREADS"
+
 /**
  * A variable controlling how the fact chunk affects the loading of a WAVE
  * file.
@@ -45,6 +45,19 @@ extern "C" {
  */
 typedef Uint32 SDL_PropertiesID;
 
+/**
+ * SDL property key
+ *
+ * A property name that has been looked up once with SDL_GetPropertyKey(), so
+ * it can be used to get and set properties without hashing and comparing the
+ * name string each time.
+ *
+ * \since This datatype is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetPropertyKey
+ */
+typedef Uint32 SDL_PropertyKey;
+
 /**
  * SDL property type
  *
@@ -458,6 +471,221 @@ extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GetBooleanProperty(SDL_PropertiesID pro
  */
 extern SDL_DECLSPEC int SDLCALL SDL_ClearProperty(SDL_PropertiesID props, const char *name);
 
+/**
+ * Get the key for a property name.
+ *
+ * The key can be passed to the functions ending in `ByKey`, like
+ * SDL_GetNumberPropertyByKey(), which behave exactly like their counterparts
+ * taking a name but skip looking up the name. This is useful for properties
+ * that are queried often, like once per frame.
+ *
+ * The same name always returns the same key, for any set of properties. Keys
+ * remain valid until SDL_Quit() is called.
+ *
+ * \param name the name of the property.
+ * \returns the key for the property name, or 0 on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetPropertyByKey
+ * \sa SDL_SetPropertyByKey
+ */
+extern SDL_DECLSPEC SDL_PropertyKey SDLCALL SDL_GetPropertyKey(const char *name);
+
+/**
+ * Set a property on a set of properties using a property key.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify, from SDL_GetPropertyKey().
+ * \param value the new value of the property, or NULL to delete the property.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetPropertyByKey
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetProperty
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *value);
+
+/**
+ * Set a string property on a set of properties using a property key.
+ *
+ * This function makes a copy of the string; the caller does not have to
+ * preserve the data after this call completes.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify, from SDL_GetPropertyKey().
+ * \param value the new value of the property, or NULL to delete the property.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetStringPropertyByKey
+ * \sa SDL_SetStringProperty
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *value);
+
+/**
+ * Set an integer property on a set of properties using a property key.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify, from SDL_GetPropertyKey().
+ * \param value the new value of the property.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetNumberPropertyByKey
+ * \sa SDL_SetNumberProperty
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 value);
+
+/**
+ * Set a floating point property on a set of properties using a property key.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify, from SDL_GetPropertyKey().
+ * \param value the new value of the property.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetFloatPropertyByKey
+ * \sa SDL_SetFloatProperty
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float value);
+
+/**
+ * Set a boolean property on a set of properties using a property key.
+ *
+ * \param props the properties to modify.
+ * \param key the key of the property to modify, from SDL_GetPropertyKey().
+ * \param value the new value of the property.
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetBooleanPropertyByKey
+ * \sa SDL_SetBooleanProperty
+ */
+extern SDL_DECLSPEC int SDLCALL SDL_SetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, SDL_bool value);
+
+/**
+ * Get a property on a set of properties using a property key.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query, from SDL_GetPropertyKey().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a pointer property.
+ *
+ * \threadsafety It is safe to call this function from any thread, although
+ *               the data returned is not protected and could potentially be
+ *               freed if you call SDL_SetProperty() or SDL_ClearProperty() on
+ *               these properties from another thread. If you need to avoid
+ *               this, use SDL_LockProperties() and SDL_UnlockProperties().
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetProperty
+ * \sa SDL_GetPropertyKey
+ * \sa SDL_SetPropertyByKey
+ */
+extern SDL_DECLSPEC void *SDLCALL SDL_GetPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *default_value);
+
+/**
+ * Get a string property on a set of properties using a property key.
+ *
+ * The returned string follows the SDL_GetStringRule.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query, from SDL_GetPropertyKey().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a string property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetStringProperty
+ * \sa SDL_SetStringPropertyByKey
+ */
+extern SDL_DECLSPEC const char *SDLCALL SDL_GetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *default_value);
+
+/**
+ * Get a number property on a set of properties using a property key.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query, from SDL_GetPropertyKey().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a number property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetNumberProperty
+ * \sa SDL_SetNumberPropertyByKey
+ */
+extern SDL_DECLSPEC Sint64 SDLCALL SDL_GetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 default_value);
+
+/**
+ * Get a floating point property on a set of properties using a property key.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query, from SDL_GetPropertyKey().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a float property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetFloatProperty
+ * \sa SDL_SetFloatPropertyByKey
+ */
+extern SDL_DECLSPEC float SDLCALL SDL_GetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float default_value);
+
+/**
+ * Get a boolean property on a set of properties using a property key.
+ *
+ * \param props the properties to query.
+ * \param key the key of the property to query, from SDL_GetPropertyKey().
+ * \param default_value the default value of the property.
+ * \returns the value of the property, or `default_value` if it is not set or
+ *          not a boolean property.
+ *
+ * \threadsafety It is safe to call this function from any thread.
+ *
+ * \since This function is available since SDL 3.0.0.
+ *
+ * \sa SDL_GetBooleanProperty
+ * \sa SDL_SetBooleanPropertyByKey
+ */
+extern SDL_DECLSPEC SDL_bool SDLCALL SDL_GetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, SDL_bool default_value);
+
 /**
  * A callback used to enumerate all properties set in an SDL_PropertiesID.
  *
@@ -540,6 +540,7 @@ void SDL_Quit(void)
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
 
     SDL_QuitTicks();
+    SDL_QuitBlitThreads();
 
 #ifdef SDL_USE_LIBDBUS
     SDL_DBus_Quit();
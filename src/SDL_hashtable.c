@@ -23,15 +23,31 @@
 
 typedef struct SDL_HashItem
 {
+    // TODO: Splitting off values into a separate array might be more cache-friendly
     const void *key;
     const void *value;
-    struct SDL_HashItem *next;
+    Uint32 hash;
+    Uint32 probe_len : 31;
+    Uint32 live : 1;
 } SDL_HashItem;
 
+// Must be a power of 2 >= sizeof(SDL_HashItem)
+#define MAX_HASHITEM_SIZEOF 32u
+SDL_COMPILE_TIME_ASSERT(sizeof_SDL_HashItem, sizeof(SDL_HashItem) <= MAX_HASHITEM_SIZEOF);
+
+// Anything larger than this will cause integer overflows
+#define MAX_HASHTABLE_SIZE (0x80000000u / (MAX_HASHITEM_SIZEOF))
+
+// The table grows once it is this full (out of 256). Robin Hood probing keeps
+// lookups short well past half full, so we can afford a fairly dense table.
+#define MAX_LOAD_FACTOR 224u
+
 struct SDL_HashTable
 {
-    SDL_HashItem **table;
-    Uint32 table_len;
+    SDL_HashItem *table;
+    Uint32 hash_mask;
+    Uint32 max_probe_len;
+    Uint32 num_occupied_slots;
     SDL_bool stackable;
     void *data;
     SDL_HashTable_HashFn hash;
@@ -52,18 +68,24 @@ SDL_HashTable *SDL_CreateHashTable(void *data, const Uint32 num_buckets, const S
         return NULL;
     }
 
+    if (num_buckets > MAX_HASHTABLE_SIZE) {
+        SDL_SetError("num_buckets is too large");
+        return NULL;
+    }
+
     table = (SDL_HashTable *) SDL_calloc(1, sizeof (SDL_HashTable));
     if (!table) {
         return NULL;
     }
 
-    table->table = (SDL_HashItem **) SDL_calloc(num_buckets, sizeof (SDL_HashItem *));
+    // num_buckets is only the initial size now, the table grows as needed.
+    table->table = (SDL_HashItem *) SDL_calloc(num_buckets, sizeof (SDL_HashItem));
     if (!table->table) {
         SDL_free(table);
         return NULL;
     }
 
-    table->table_len = num_buckets;
+    table->hash_mask = num_buckets - 1;
     table->stackable = stackable;
     table->data = data;
     table->hash = hashfn;
@@ -74,59 +96,256 @@ SDL_HashTable *SDL_CreateHashTable(void *data, const Uint32 num_buckets, const S
 
 static SDL_INLINE Uint32 calc_hash(const SDL_HashTable *table, const void *key)
 {
-    return table->hash(key, table->data) & (table->table_len - 1);
+    // Mix the bits so weak hashes (like the identity hash of sequential IDs)
+    // still spread evenly over the low bits we mask against. This is the
+    // finalizer from MurmurHash3.
+    Uint32 h = table->hash(key, table->data);
+    h ^= h >> 16;
+    h *= 0x85ebca6b;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35;
+    h ^= h >> 16;
+    return h;
 }
 
+static SDL_INLINE Uint32 get_probe_length(Uint32 zero_idx, Uint32 actual_idx, Uint32 num_buckets)
+{
+    // returns the probe sequence length from zero_idx to actual_idx
+    if (actual_idx < zero_idx) {
+        return num_buckets - zero_idx + actual_idx;
+    }
+    return actual_idx - zero_idx;
+}
+
+static SDL_HashItem *find_item(const SDL_HashTable *table, const void *key, Uint32 hash, Uint32 *i, Uint32 *probe_len)
+{
+    const Uint32 hash_mask = table->hash_mask;
+    const Uint32 max_probe_len = table->max_probe_len;
+    SDL_HashItem *items = table->table;
+
+    for (;;) {
+        SDL_HashItem *item = &items[*i];
+
+        if (!item->live) {
+            return NULL;
+        }
+
+        // Compare the cached hash first, so mismatches almost never reach keymatch.
+        if (item->hash == hash && table->keymatch(key, item->key, table->data)) {
+            return item;
+        }
+
+        // Robin Hood invariant: if this item is closer to its home slot than
+        // we are to ours, our key would have displaced it, so it isn't here.
+        if (item->probe_len < *probe_len) {
+            return NULL;
+        }
+
+        if (++*probe_len > max_probe_len) {
+            return NULL;
+        }
+
+        *i = (*i + 1) & hash_mask;
+    }
+}
+
+static SDL_HashItem *find_first_item(const SDL_HashTable *table, const void *key, Uint32 hash)
+{
+    Uint32 i = hash & table->hash_mask;
+    Uint32 probe_len = 0;
+    return find_item(table, key, hash, &i, &probe_len);
+}
+
+// When newest_first is set, the item goes in front of any items with the same hash, so the most
+// recently inserted duplicate of a key in a stackable table is the first one found.
+static SDL_HashItem *insert_item(SDL_HashItem *item_to_insert, SDL_HashItem *table, Uint32 hash_mask, Uint32 *max_probe_len_ptr, SDL_bool newest_first)
+{
+    const Uint32 num_buckets = hash_mask + 1;
+    Uint32 idx = item_to_insert->hash & hash_mask;
+    SDL_HashItem temp_item, *target = NULL;
+
+    for (;;) {
+        SDL_HashItem *candidate = &table[idx];
+
+        if (!candidate->live) {
+            // Found an empty slot. Put it here and we're done.
+            *candidate = *item_to_insert;
+
+            if (target == NULL) {
+                target = candidate;
+            }
+
+            const Uint32 probe_len = get_probe_length(candidate->hash & hash_mask, idx, num_buckets);
+            candidate->probe_len = probe_len;
+
+            if (*max_probe_len_ptr < probe_len) {
+                *max_probe_len_ptr = probe_len;
+            }
+
+            break;
+        }
+
+        const Uint32 candidate_probe_len = candidate->probe_len;
+        SDL_assert(candidate_probe_len == get_probe_length(candidate->hash & hash_mask, idx, num_buckets));
+        const Uint32 new_probe_len = get_probe_length(item_to_insert->hash & hash_mask, idx, num_buckets);
+
+        if (candidate_probe_len < new_probe_len ||
+            (newest_first && candidate_probe_len == new_probe_len && candidate->hash == item_to_insert->hash)) {
+            // Robin Hood hashing: the item at idx has a better probe length than our item would at this position.
+            // Evict it and put our item in its place, then continue looking for a new spot for the displaced item.
+            // This algorithm significantly reduces clustering in the table, making lookups take very few probes.
+
+            temp_item = *candidate;
+            *candidate = *item_to_insert;
+
+            if (target == NULL) {
+                target = candidate;
+            }
+
+            *item_to_insert = temp_item;
+
+            SDL_assert(new_probe_len < num_buckets);
+            candidate->probe_len = new_probe_len;
+
+            if (*max_probe_len_ptr < new_probe_len) {
+                *max_probe_len_ptr = new_probe_len;
+            }
+        }
+
+        idx = (idx + 1) & hash_mask;
+    }
+
+    return target;
+}
+
+static void delete_item(SDL_HashTable *table, SDL_HashItem *item)
+{
+    const Uint32 hash_mask = table->hash_mask;
+    SDL_HashItem *items = table->table;
+
+    if (table->nuke) {
+        table->nuke(item->key, item->value, table->data);
+    }
+    table->num_occupied_slots--;
+
+    Uint32 idx = (Uint32)(item - items);
+
+    // Backward-shift deletion: pull every following item of the cluster one
+    // slot closer to its home, so no tombstones are needed.
+    for (;;) {
+        idx = (idx + 1) & hash_mask;
+        SDL_HashItem *next_item = &items[idx];
+
+        if (next_item->probe_len < 1) {
+            SDL_zerop(item);
+            return;
+        }
+
+        *item = *next_item;
+        item->probe_len -= 1;
+        SDL_assert(item->probe_len < table->max_probe_len);
+        item = next_item;
+    }
+}
+
+static SDL_bool resize(SDL_HashTable *table, Uint32 new_size)
+{
+    SDL_HashItem *old_table = table->table;
+    Uint32 old_size = table->hash_mask + 1;
+    Uint32 new_hash_mask = new_size - 1;
+    SDL_HashItem *new_table = (SDL_HashItem *) SDL_calloc(new_size, sizeof (SDL_HashItem));
+
+    if (!new_table) {
+        return SDL_FALSE;
+    }
+
+    table->max_probe_len = 0;
+    table->hash_mask = new_hash_mask;
+    table->table = new_table;
+
+    // Start at the beginning of a cluster, so items that wrapped around the end of the old
+    // table are reinserted after the ones before them and duplicates keep their order.
+    Uint32 start = 0;
+    while (start < old_size && old_table[start].live && old_table[start].probe_len > 0) {
+        ++start;
+    }
+
+    for (Uint32 i = 0; i < old_size; ++i) {
+        SDL_HashItem *item = &old_table[(start + i) & (old_size - 1)];
+        if (item->live) {
+            insert_item(item, new_table, new_hash_mask, &table->max_probe_len, SDL_FALSE);
+        }
+    }
+
+    SDL_free(old_table);
+    return SDL_TRUE;
+}
+
+static SDL_bool maybe_resize(SDL_HashTable *table)
+{
+    const Uint32 capacity = table->hash_mask + 1;
+
+    if (capacity >= MAX_HASHTABLE_SIZE) {
+        // Can't grow any further, but we can keep filling it up until it's completely full.
+        return (table->num_occupied_slots < capacity);
+    }
+
+    const Uint32 resize_threshold = (Uint32)(((Uint64)capacity * MAX_LOAD_FACTOR) >> 8);
+
+    if (table->num_occupied_slots >= resize_threshold) {
+        if (!resize(table, capacity * 2)) {
+            // Out of memory, but there might still be room left.
+            return (table->num_occupied_slots < capacity);
+        }
+    }
+    return SDL_TRUE;
+}
 
 SDL_bool SDL_InsertIntoHashTable(SDL_HashTable *table, const void *key, const void *value)
 {
-    SDL_HashItem *item;
+    SDL_HashItem new_item;
     Uint32 hash;
 
     if (!table) {
         return SDL_FALSE;
     }
 
-    if ( (!table->stackable) && (SDL_FindInHashTable(table, key, NULL)) ) {
+    hash = calc_hash(table, key);
+
+    if ( (!table->stackable) && (find_first_item(table, key, hash)) ) {
         return SDL_FALSE;
     }
 
-    // !!! FIXME: grow and rehash table if it gets too saturated.
-    item = (SDL_HashItem *) SDL_malloc(sizeof (SDL_HashItem));
-    if (!item) {
+    if (!maybe_resize(table)) {
         return SDL_FALSE;
     }
 
-    hash = calc_hash(table, key);
+    new_item.key = key;
+    new_item.value = value;
+    new_item.hash = hash;
+    new_item.live = SDL_TRUE;
+    new_item.probe_len = 0;
 
-    item->key = key;
-    item->value = value;
-    item->next = table->table[hash];
-    table->table[hash] = item;
+    insert_item(&new_item, table->table, table->hash_mask, &table->max_probe_len, table->stackable);
+    table->num_occupied_slots++;
 
     return SDL_TRUE;
 }
 
 SDL_bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const void **_value)
 {
-    Uint32 hash;
-    void *data;
     SDL_HashItem *i;
 
     if (!table) {
         return SDL_FALSE;
     }
 
-    hash = calc_hash(table, key);
-    data = table->data;
-
-    for (i = table->table[hash]; i; i = i->next) {
-        if (table->keymatch(key, i->key, data)) {
-            if (_value) {
-                *_value = i->value;
-            }
-            return SDL_TRUE;
+    i = find_first_item(table, key, calc_hash(table, key));
+    if (i) {
+        if (_value) {
+            *_value = i->value;
         }
+        return SDL_TRUE;
     }
 
     return SDL_FALSE;
@@ -134,56 +353,48 @@ SDL_bool SDL_FindInHashTable(const SDL_HashTable *table, const void *key, const
 
 SDL_bool SDL_RemoveFromHashTable(SDL_HashTable *table, const void *key)
 {
-    Uint32 hash;
-    SDL_HashItem *item = NULL;
-    SDL_HashItem *prev = NULL;
-    void *data;
+    SDL_HashItem *item;
 
     if (!table) {
         return SDL_FALSE;
     }
 
-    hash = calc_hash(table, key);
-    data = table->data;
-
-    for (item = table->table[hash]; item; item = item->next) {
-        if (table->keymatch(key, item->key, data)) {
-            if (prev) {
-                prev->next = item->next;
-            } else {
-                table->table[hash] = item->next;
-            }
-
-            if (table->nuke) {
-                table->nuke(item->key, item->value, data);
-            }
-            SDL_free(item);
-            return SDL_TRUE;
-        }
-
-        prev = item;
+    item = find_first_item(table, key, calc_hash(table, key));
+    if (!item) {
+        return SDL_FALSE;
     }
 
-    return SDL_FALSE;
+    delete_item(table, item);
+    return SDL_TRUE;
 }
 
 SDL_bool SDL_IterateHashTableKey(const SDL_HashTable *table, const void *key, const void **_value, void **iter)
 {
-    SDL_HashItem *item;
+    SDL_HashItem *item = (SDL_HashItem *) *iter;
+    Uint32 i, probe_len, hash;
 
     if (!table) {
         return SDL_FALSE;
     }
 
-    item = *iter ? ((SDL_HashItem *)*iter)->next : table->table[calc_hash(table, key)];
+    hash = calc_hash(table, key);
+
+    if (item) {
+        // Pick up right after the last match; it shares our home slot, so its probe length is ours too.
+        i = ((Uint32)(item - table->table) + 1) & table->hash_mask;
+        probe_len = item->probe_len + 1;
+    } else {
+        i = hash & table->hash_mask;
+        probe_len = 0;
+    }
 
-    while (item) {
-        if (table->keymatch(key, item->key, table->data)) {
+    if (probe_len <= table->max_probe_len) {
+        item = find_item(table, key, hash, &i, &probe_len);
+        if (item) {
             *_value = item->value;
             *iter = item;
             return SDL_TRUE;
         }
-        item = item->next;
     }
 
     // no more matches.
@@ -195,25 +406,20 @@ SDL_bool SDL_IterateHashTableKey(const SDL_HashTable *table, const void *key, co
 SDL_bool SDL_IterateHashTable(const SDL_HashTable *table, const void **_key, const void **_value, void **iter)
 {
     SDL_HashItem *item = (SDL_HashItem *) *iter;
-    Uint32 idx = 0;
+    const SDL_HashItem *end;
 
     if (!table) {
         return SDL_FALSE;
     }
 
-    if (item) {
-        const SDL_HashItem *orig = item;
-        item = item->next;
-        if (!item) {
-            idx = calc_hash(table, orig->key) + 1;  // !!! FIXME: we probably shouldn't rehash each time.
-        }
-    }
+    end = table->table + (table->hash_mask + 1);
+    item = item ? item + 1 : table->table;
 
-    while (!item && (idx < table->table_len)) {
-        item = table->table[idx++];  // skip empty buckets...
+    while (item < end && !item->live) {
+        ++item;  // skip empty slots...
     }
 
-    if (!item) {  // no more matches?
+    if (item == end) {  // no more matches?
         *_key = NULL;
         *iter = NULL;
         return SDL_FALSE;
@@ -228,17 +434,7 @@ SDL_bool SDL_IterateHashTable(const SDL_HashTable *table, const void **_key, con
 
 SDL_bool SDL_HashTableEmpty(SDL_HashTable *table)
 {
-    if (table) {
-        Uint32 i;
-
-        for (i = 0; i < table->table_len; i++) {
-            SDL_HashItem *item = table->table[i];
-            if (item) {
-                return SDL_FALSE;
-            }
-        }
-    }
-    return SDL_TRUE;
+    return !(table && table->num_occupied_slots);
 }
 
 void SDL_EmptyHashTable(SDL_HashTable *table)
@@ -247,18 +443,17 @@ void SDL_EmptyHashTable(SDL_HashTable *table)
         void *data = table->data;
         Uint32 i;
 
-        for (i = 0; i < table->table_len; i++) {
-            SDL_HashItem *item = table->table[i];
-            while (item) {
-                SDL_HashItem *next = item->next;
+        for (i = 0; i <= table->hash_mask; i++) {
+            SDL_HashItem *item = &table->table[i];
+            if (item->live) {
                 if (table->nuke) {
                     table->nuke(item->key, item->value, data);
                 }
-                SDL_free(item);
-                item = next;
+                SDL_zerop(item);
             }
-            table->table[i] = NULL;
         }
+        table->num_occupied_slots = 0;
+        table->max_probe_len = 0;
     }
 }
 
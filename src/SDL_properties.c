@@ -38,6 +38,8 @@ typedef struct
 
     char *string_storage;
 
+    const char *name;  // interned, owned by SDL_property_keys
+
     SDL_CleanupPropertyCallback cleanup;
     void *userdata;
 } SDL_Property;
@@ -48,9 +50,14 @@ typedef struct
     SDL_Mutex *lock;
 } SDL_Properties;
 
+// SDL_properties_lock guards the table of property sets and the interned
+// property names. Both are read far more often than they are written.
 static SDL_HashTable *SDL_properties;
-static SDL_Mutex *SDL_properties_lock;
+static SDL_HashTable *SDL_property_keys;   // name -> SDL_PropertyKey
+static SDL_HashTable *SDL_property_names;  // SDL_PropertyKey -> name
+static SDL_RWLock *SDL_properties_lock;
 static SDL_PropertiesID SDL_last_properties_id;
+static SDL_PropertyKey SDL_last_property_key;  // never reset, so stale keys can't alias new names
 static SDL_PropertiesID SDL_global_properties;
 
 
@@ -72,7 +79,6 @@ static void SDL_FreePropertyWithCleanup(const void *key, const void *value, void
         }
         SDL_FreeLater(property->string_storage);  // this pointer might be given to the app by SDL_GetStringProperty.
     }
-    SDL_free((void *)key);
     SDL_free((void *)value);
 }
 
@@ -97,20 +103,38 @@ static void SDL_FreeProperties(const void *key, const void *value, void *data)
     }
 }
 
+static void SDL_FreePropertyKey(const void *key, const void *value, void *data)
+{
+    SDL_free((void *)key);
+}
+
 int SDL_InitProperties(void)
 {
     if (!SDL_properties_lock) {
-        SDL_properties_lock = SDL_CreateMutex();
+        SDL_properties_lock = SDL_CreateRWLock();
         if (!SDL_properties_lock) {
             return -1;
         }
     }
     if (!SDL_properties) {
-        SDL_properties = SDL_CreateHashTable(NULL, 16, SDL_HashID, SDL_KeyMatchID, SDL_FreeProperties, SDL_FALSE);
+        // Property sets are freed outside of SDL_properties_lock, see SDL_DestroyProperties()
+        SDL_properties = SDL_CreateHashTable(NULL, 16, SDL_HashID, SDL_KeyMatchID, NULL, SDL_FALSE);
         if (!SDL_properties) {
             return -1;
         }
     }
+    if (!SDL_property_keys) {
+        SDL_property_keys = SDL_CreateHashTable(NULL, 64, SDL_HashString, SDL_KeyMatchString, SDL_FreePropertyKey, SDL_FALSE);
+        if (!SDL_property_keys) {
+            return -1;
+        }
+    }
+    if (!SDL_property_names) {
+        SDL_property_names = SDL_CreateHashTable(NULL, 64, SDL_HashID, SDL_KeyMatchID, NULL, SDL_FALSE);
+        if (!SDL_property_names) {
+            return -1;
+        }
+    }
     return 0;
 }
 
@@ -121,11 +145,25 @@ void SDL_QuitProperties(void)
         SDL_global_properties = 0;
     }
     if (SDL_properties) {
+        const void *key, *value;
+        void *iter = NULL;
+        while (SDL_IterateHashTable(SDL_properties, &key, &value, &iter)) {
+            SDL_DestroyProperties((SDL_PropertiesID)(uintptr_t)key);
+            iter = NULL;  // the table changed, start over.
+        }
         SDL_DestroyHashTable(SDL_properties);
         SDL_properties = NULL;
     }
+    if (SDL_property_names) {
+        SDL_DestroyHashTable(SDL_property_names);
+        SDL_property_names = NULL;
+    }
+    if (SDL_property_keys) {
+        SDL_DestroyHashTable(SDL_property_keys);
+        SDL_property_keys = NULL;
+    }
     if (SDL_properties_lock) {
-        SDL_DestroyMutex(SDL_properties_lock);
+        SDL_DestroyRWLock(SDL_properties_lock);
         SDL_properties_lock = NULL;
     }
 }
@@ -152,7 +190,7 @@ SDL_PropertiesID SDL_CreateProperties(void)
     if (!properties) {
         goto error;
     }
-    properties->props = SDL_CreateHashTable(NULL, 4, SDL_HashString, SDL_KeyMatchString, SDL_FreeProperty, SDL_FALSE);
+    properties->props = SDL_CreateHashTable(NULL, 4, SDL_HashID, SDL_KeyMatchID, SDL_FreeProperty, SDL_FALSE);
     if (!properties->props) {
         goto error;
     }
@@ -165,7 +203,7 @@ SDL_PropertiesID SDL_CreateProperties(void)
         goto error;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
+    SDL_LockRWLockForWriting(SDL_properties_lock);
     ++SDL_last_properties_id;
     if (SDL_last_properties_id == 0) {
         ++SDL_last_properties_id;
@@ -174,7 +212,7 @@ SDL_PropertiesID SDL_CreateProperties(void)
     if (SDL_InsertIntoHashTable(SDL_properties, (const void *)(uintptr_t)props, properties)) {
         inserted = SDL_TRUE;
     }
-    SDL_UnlockMutex(SDL_properties_lock);
+    SDL_UnlockRWLock(SDL_properties_lock);
 
     if (inserted) {
         /* All done! */
@@ -186,6 +224,78 @@ error:
     return 0;
 }
 
+SDL_PropertyKey SDL_GetPropertyKey(const char *name)
+{
+    const void *value = NULL;
+    SDL_PropertyKey key;
+
+    if (!name || !*name) {
+        SDL_InvalidParamError("name");
+        return 0;
+    }
+
+    if (!SDL_properties && SDL_InitProperties() < 0) {
+        return 0;
+    }
+
+    SDL_LockRWLockForReading(SDL_properties_lock);
+    SDL_FindInHashTable(SDL_property_keys, name, &value);
+    SDL_UnlockRWLock(SDL_properties_lock);
+
+    key = (SDL_PropertyKey)(uintptr_t)value;
+    if (key) {
+        return key;
+    }
+
+    SDL_LockRWLockForWriting(SDL_properties_lock);
+    if (SDL_FindInHashTable(SDL_property_keys, name, &value)) {
+        // Someone else interned it while we were waiting for the lock
+        key = (SDL_PropertyKey)(uintptr_t)value;
+    } else {
+        char *interned_name = SDL_strdup(name);
+        if (interned_name) {
+            ++SDL_last_property_key;
+            if (SDL_last_property_key == 0) {
+                ++SDL_last_property_key;
+            }
+            key = SDL_last_property_key;
+            if (!SDL_InsertIntoHashTable(SDL_property_keys, interned_name, (const void *)(uintptr_t)key)) {
+                SDL_free(interned_name);
+                key = 0;
+            } else if (!SDL_InsertIntoHashTable(SDL_property_names, (const void *)(uintptr_t)key, interned_name)) {
+                SDL_RemoveFromHashTable(SDL_property_keys, interned_name);
+                key = 0;
+            }
+        }
+    }
+    SDL_UnlockRWLock(SDL_properties_lock);
+
+    return key;
+}
+
+/* Find a set of properties and, optionally, the key for a property name.
+ * The key is 0 if that name has never been set on any properties.
+ */
+static SDL_Properties *SDL_FindProperties(SDL_PropertiesID props, const char *name, SDL_PropertyKey *key)
+{
+    SDL_Properties *properties = NULL;
+
+    if (!props) {
+        return NULL;
+    }
+
+    SDL_LockRWLockForReading(SDL_properties_lock);
+    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
+    if (properties && name) {
+        const void *value = NULL;
+        SDL_FindInHashTable(SDL_property_keys, name, &value);
+        *key = (SDL_PropertyKey)(uintptr_t)value;
+    }
+    SDL_UnlockRWLock(SDL_properties_lock);
+
+    return properties;
+}
+
 int SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
 {
     SDL_Properties *src_properties = NULL;
@@ -199,10 +309,8 @@ int SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
         return SDL_InvalidParamError("dst");
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)src, (const void **)&src_properties);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)dst, (const void **)&dst_properties);
-    SDL_UnlockMutex(SDL_properties_lock);
+    src_properties = SDL_FindProperties(src, NULL, NULL);
+    dst_properties = SDL_FindProperties(dst, NULL, NULL);
 
     if (!src_properties) {
         return SDL_InvalidParamError("src");
@@ -219,9 +327,7 @@ int SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
 
         iter = NULL;
         while (SDL_IterateHashTable(src_properties->props, &key, &value, &iter)) {
-            const char *src_name = (const char *)key;
             const SDL_Property *src_property = (const SDL_Property *)value;
-            char *dst_name;
             SDL_Property *dst_property;
 
             if (src_property->cleanup) {
@@ -229,25 +335,20 @@ int SDL_CopyProperties(SDL_PropertiesID src, SDL_PropertiesID dst)
                 continue;
             }
 
-            SDL_RemoveFromHashTable(dst_properties->props, src_name);
+            SDL_RemoveFromHashTable(dst_properties->props, key);
 
-            dst_name = SDL_strdup(src_name);
-            if (!dst_name) {
-                result = -1;
-                continue;
-            }
             dst_property = (SDL_Property *)SDL_malloc(sizeof(*dst_property));
             if (!dst_property) {
-                SDL_free(dst_name);
                 result = -1;
                 continue;
             }
             SDL_copyp(dst_property, src_property);
+            dst_property->string_storage = NULL;
             if (src_property->type == SDL_PROPERTY_TYPE_STRING) {
                 dst_property->value.string_value = SDL_strdup(src_property->value.string_value);
             }
-            if (!SDL_InsertIntoHashTable(dst_properties->props, dst_name, dst_property)) {
-                SDL_FreePropertyWithCleanup(dst_name, dst_property, NULL, SDL_FALSE);
+            if (!SDL_InsertIntoHashTable(dst_properties->props, key, dst_property)) {
+                SDL_FreePropertyWithCleanup(key, dst_property, NULL, SDL_FALSE);
                 result = -1;
             }
         }
@@ -266,10 +367,7 @@ int SDL_LockProperties(SDL_PropertiesID props)
         return SDL_InvalidParamError("props");
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
-
+    properties = SDL_FindProperties(props, NULL, NULL);
     if (!properties) {
         return SDL_InvalidParamError("props");
     }
@@ -286,10 +384,7 @@ void SDL_UnlockProperties(SDL_PropertiesID props)
         return;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
-
+    properties = SDL_FindProperties(props, NULL, NULL);
     if (!properties) {
         return;
     }
@@ -297,36 +392,42 @@ void SDL_UnlockProperties(SDL_PropertiesID props)
     SDL_UnlockMutex(properties->lock);
 }
 
-static int SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_Property *property)
+static int SDL_PrivateSetPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, SDL_Property *property)
 {
     SDL_Properties *properties = NULL;
+    const char *name = NULL;
     int result = 0;
 
     if (!props) {
         SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
         return SDL_InvalidParamError("props");
     }
-    if (!name || !*name) {
+    if (!key) {
         SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
-        return SDL_InvalidParamError("name");
+        return SDL_InvalidParamError("key");
     }
 
-    SDL_LockMutex(SDL_properties_lock);
+    SDL_LockRWLockForReading(SDL_properties_lock);
     SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
+    SDL_FindInHashTable(SDL_property_names, (const void *)(uintptr_t)key, (const void **)&name);
+    SDL_UnlockRWLock(SDL_properties_lock);
 
     if (!properties) {
         SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
         return SDL_InvalidParamError("props");
     }
+    if (!name) {
+        SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
+        return SDL_InvalidParamError("key");
+    }
 
     SDL_LockMutex(properties->lock);
     {
-        SDL_RemoveFromHashTable(properties->props, name);
+        SDL_RemoveFromHashTable(properties->props, (const void *)(uintptr_t)key);
         if (property) {
-            char *key = SDL_strdup(name);
-            if (!SDL_InsertIntoHashTable(properties->props, key, property)) {
-                SDL_FreePropertyWithCleanup(key, property, NULL, SDL_TRUE);
+            property->name = name;
+            if (!SDL_InsertIntoHashTable(properties->props, (const void *)(uintptr_t)key, property)) {
+                SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
                 result = -1;
             }
         }
@@ -336,6 +437,36 @@ static int SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_
     return result;
 }
 
+static int SDL_PrivateSetProperty(SDL_PropertiesID props, const char *name, SDL_Property *property)
+{
+    SDL_PropertyKey key = 0;
+
+    if (!props) {
+        SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
+        return SDL_InvalidParamError("props");
+    }
+    if (!name || !*name) {
+        SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
+        return SDL_InvalidParamError("name");
+    }
+
+    if (property) {
+        key = SDL_GetPropertyKey(name);
+        if (!key) {
+            SDL_FreePropertyWithCleanup(NULL, property, NULL, SDL_TRUE);
+            return -1;
+        }
+    } else {
+        if (!SDL_FindProperties(props, name, &key)) {
+            return SDL_InvalidParamError("props");
+        }
+        if (!key) {
+            return 0;  // this name has never been set anywhere, so there's nothing to clear.
+        }
+    }
+    return SDL_PrivateSetPropertyByKey(props, key, property);
+}
+
 int SDL_SetPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *value, SDL_CleanupPropertyCallback cleanup, void *userdata)
 {
     SDL_Property *property;
@@ -362,6 +493,17 @@ int SDL_SetPropertyWithCleanup(SDL_PropertiesID props, const char *name, void *v
     return SDL_PrivateSetProperty(props, name, property);
 }
 
+static SDL_Property *SDL_CreatePointerProperty(void *value)
+{
+    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    if (!property) {
+        return NULL;
+    }
+    property->type = SDL_PROPERTY_TYPE_POINTER;
+    property->value.pointer_value = value;
+    return property;
+}
+
 int SDL_SetProperty(SDL_PropertiesID props, const char *name, void *value)
 {
     SDL_Property *property;
@@ -370,15 +512,26 @@ int SDL_SetProperty(SDL_PropertiesID props, const char *name, void *value)
         return SDL_ClearProperty(props, name);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    property = SDL_CreatePointerProperty(value);
     if (!property) {
         return -1;
     }
-    property->type = SDL_PROPERTY_TYPE_POINTER;
-    property->value.pointer_value = value;
     return SDL_PrivateSetProperty(props, name, property);
 }
 
+int SDL_SetPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *value)
+{
+    SDL_Property *property = NULL;
+
+    if (value) {
+        property = SDL_CreatePointerProperty(value);
+        if (!property) {
+            return -1;
+        }
+    }
+    return SDL_PrivateSetPropertyByKey(props, key, property);
+}
+
 static void SDLCALL CleanupFreeableProperty(void *userdata, void *value)
 {
     SDL_free(value);
@@ -401,6 +554,21 @@ int SDL_SetSurfaceProperty(SDL_PropertiesID props, const char *name, SDL_Surface
     return SDL_SetPropertyWithCleanup(props, name, surface, CleanupSurface, NULL);
 }
 
+static SDL_Property *SDL_CreateStringProperty(const char *value)
+{
+    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    if (!property) {
+        return NULL;
+    }
+    property->type = SDL_PROPERTY_TYPE_STRING;
+    property->value.string_value = SDL_strdup(value);
+    if (!property->value.string_value) {
+        SDL_free(property);
+        return NULL;
+    }
+    return property;
+}
+
 int SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *value)
 {
     SDL_Property *property;
@@ -409,52 +577,113 @@ int SDL_SetStringProperty(SDL_PropertiesID props, const char *name, const char *
         return SDL_ClearProperty(props, name);
     }
 
-    property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    property = SDL_CreateStringProperty(value);
     if (!property) {
         return -1;
     }
-    property->type = SDL_PROPERTY_TYPE_STRING;
-    property->value.string_value = SDL_strdup(value);
-    if (!property->value.string_value) {
-        SDL_free(property);
-        return -1;
-    }
     return SDL_PrivateSetProperty(props, name, property);
 }
 
-int SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+int SDL_SetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *value)
+{
+    SDL_Property *property = NULL;
+
+    if (value) {
+        property = SDL_CreateStringProperty(value);
+        if (!property) {
+            return -1;
+        }
+    }
+    return SDL_PrivateSetPropertyByKey(props, key, property);
+}
+
+static SDL_Property *SDL_CreateNumberProperty(Sint64 value)
 {
     SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
     if (!property) {
-        return -1;
+        return NULL;
     }
     property->type = SDL_PROPERTY_TYPE_NUMBER;
     property->value.number_value = value;
+    return property;
+}
+
+int SDL_SetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 value)
+{
+    SDL_Property *property = SDL_CreateNumberProperty(value);
+    if (!property) {
+        return -1;
+    }
     return SDL_PrivateSetProperty(props, name, property);
 }
 
-int SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+int SDL_SetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    SDL_Property *property = SDL_CreateNumberProperty(value);
     if (!property) {
         return -1;
     }
+    return SDL_PrivateSetPropertyByKey(props, key, property);
+}
+
+static SDL_Property *SDL_CreateFloatProperty(float value)
+{
+    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    if (!property) {
+        return NULL;
+    }
     property->type = SDL_PROPERTY_TYPE_FLOAT;
     property->value.float_value = value;
+    return property;
+}
+
+int SDL_SetFloatProperty(SDL_PropertiesID props, const char *name, float value)
+{
+    SDL_Property *property = SDL_CreateFloatProperty(value);
+    if (!property) {
+        return -1;
+    }
     return SDL_PrivateSetProperty(props, name, property);
 }
 
-int SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, SDL_bool value)
+int SDL_SetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float value)
 {
-    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    SDL_Property *property = SDL_CreateFloatProperty(value);
     if (!property) {
         return -1;
     }
+    return SDL_PrivateSetPropertyByKey(props, key, property);
+}
+
+static SDL_Property *SDL_CreateBooleanProperty(SDL_bool value)
+{
+    SDL_Property *property = (SDL_Property *)SDL_calloc(1, sizeof(*property));
+    if (!property) {
+        return NULL;
+    }
     property->type = SDL_PROPERTY_TYPE_BOOLEAN;
     property->value.boolean_value = value ? SDL_TRUE : SDL_FALSE;
+    return property;
+}
+
+int SDL_SetBooleanProperty(SDL_PropertiesID props, const char *name, SDL_bool value)
+{
+    SDL_Property *property = SDL_CreateBooleanProperty(value);
+    if (!property) {
+        return -1;
+    }
     return SDL_PrivateSetProperty(props, name, property);
 }
 
+int SDL_SetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, SDL_bool value)
+{
+    SDL_Property *property = SDL_CreateBooleanProperty(value);
+    if (!property) {
+        return -1;
+    }
+    return SDL_PrivateSetPropertyByKey(props, key, property);
+}
+
 SDL_bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
 {
     return (SDL_GetPropertyType(props, name) != SDL_PROPERTY_TYPE_INVALID);
@@ -463,6 +692,7 @@ SDL_bool SDL_HasProperty(SDL_PropertiesID props, const char *name)
 SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
 {
     SDL_Properties *properties = NULL;
+    SDL_PropertyKey key = 0;
     SDL_PropertyType type = SDL_PROPERTY_TYPE_INVALID;
 
     if (!props) {
@@ -472,18 +702,15 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
-
-    if (!properties) {
+    properties = SDL_FindProperties(props, name, &key);
+    if (!properties || !key) {
         return SDL_PROPERTY_TYPE_INVALID;
     }
 
     SDL_LockMutex(properties->lock);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)key, (const void **)&property)) {
             type = property->type;
         }
     }
@@ -492,23 +719,11 @@ SDL_PropertyType SDL_GetPropertyType(SDL_PropertiesID props, const char *name)
     return type;
 }
 
-void *SDL_GetProperty(SDL_PropertiesID props, const char *name, void *default_value)
+static void *SDL_PrivateGetProperty(SDL_Properties *properties, SDL_PropertyKey key, void *default_value)
 {
-    SDL_Properties *properties = NULL;
     void *value = default_value;
 
-    if (!props) {
-        return value;
-    }
-    if (!name || !*name) {
-        return value;
-    }
-
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
-
-    if (!properties) {
+    if (!properties || !key) {
         return value;
     }
 
@@ -519,7 +734,7 @@ void *SDL_GetProperty(SDL_PropertiesID props, const char *name, void *default_va
     SDL_LockMutex(properties->lock);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)key, (const void **)&property)) {
             if (property->type == SDL_PROPERTY_TYPE_POINTER) {
                 value = property->value.pointer_value;
             }
@@ -530,30 +745,36 @@ void *SDL_GetProperty(SDL_PropertiesID props, const char *name, void *default_va
     return value;
 }
 
-const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
+void *SDL_GetProperty(SDL_PropertiesID props, const char *name, void *default_value)
 {
-    SDL_Properties *properties = NULL;
-    const char *value = default_value;
+    SDL_Properties *properties;
+    SDL_PropertyKey key = 0;
 
-    if (!props) {
-        return value;
-    }
     if (!name || !*name) {
-        return value;
+        return default_value;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
+    properties = SDL_FindProperties(props, name, &key);
+    return SDL_PrivateGetProperty(properties, key, default_value);
+}
 
-    if (!properties) {
+void *SDL_GetPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, void *default_value)
+{
+    return SDL_PrivateGetProperty(SDL_FindProperties(props, NULL, NULL), key, default_value);
+}
+
+static const char *SDL_PrivateGetStringProperty(SDL_Properties *properties, SDL_PropertyKey key, const char *default_value)
+{
+    const char *value = default_value;
+
+    if (!properties || !key) {
         return value;
     }
 
     SDL_LockMutex(properties->lock);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = property->value.string_value;
@@ -591,30 +812,36 @@ const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, cons
     return value;
 }
 
-Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
+const char *SDL_GetStringProperty(SDL_PropertiesID props, const char *name, const char *default_value)
 {
-    SDL_Properties *properties = NULL;
-    Sint64 value = default_value;
+    SDL_Properties *properties;
+    SDL_PropertyKey key = 0;
 
-    if (!props) {
-        return value;
-    }
     if (!name || !*name) {
-        return value;
+        return default_value;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
+    properties = SDL_FindProperties(props, name, &key);
+    return SDL_PrivateGetStringProperty(properties, key, default_value);
+}
 
-    if (!properties) {
+const char *SDL_GetStringPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, const char *default_value)
+{
+    return SDL_PrivateGetStringProperty(SDL_FindProperties(props, NULL, NULL), key, default_value);
+}
+
+static Sint64 SDL_PrivateGetNumberProperty(SDL_Properties *properties, SDL_PropertyKey key, Sint64 default_value)
+{
+    Sint64 value = default_value;
+
+    if (!properties || !key) {
         return value;
     }
 
     SDL_LockMutex(properties->lock);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = SDL_strtoll(property->value.string_value, NULL, 0);
@@ -638,30 +865,36 @@ Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 de
     return value;
 }
 
-float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
+Sint64 SDL_GetNumberProperty(SDL_PropertiesID props, const char *name, Sint64 default_value)
 {
-    SDL_Properties *properties = NULL;
-    float value = default_value;
+    SDL_Properties *properties;
+    SDL_PropertyKey key = 0;
 
-    if (!props) {
-        return value;
-    }
     if (!name || !*name) {
-        return value;
+        return default_value;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
+    properties = SDL_FindProperties(props, name, &key);
+    return SDL_PrivateGetNumberProperty(properties, key, default_value);
+}
 
-    if (!properties) {
+Sint64 SDL_GetNumberPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, Sint64 default_value)
+{
+    return SDL_PrivateGetNumberProperty(SDL_FindProperties(props, NULL, NULL), key, default_value);
+}
+
+static float SDL_PrivateGetFloatProperty(SDL_Properties *properties, SDL_PropertyKey key, float default_value)
+{
+    float value = default_value;
+
+    if (!properties || !key) {
         return value;
     }
 
     SDL_LockMutex(properties->lock);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = (float)SDL_atof(property->value.string_value);
@@ -685,30 +918,36 @@ float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float defau
     return value;
 }
 
-SDL_bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, SDL_bool default_value)
+float SDL_GetFloatProperty(SDL_PropertiesID props, const char *name, float default_value)
 {
-    SDL_Properties *properties = NULL;
-    SDL_bool value = default_value;
+    SDL_Properties *properties;
+    SDL_PropertyKey key = 0;
 
-    if (!props) {
-        return value;
-    }
     if (!name || !*name) {
-        return value;
+        return default_value;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
+    properties = SDL_FindProperties(props, name, &key);
+    return SDL_PrivateGetFloatProperty(properties, key, default_value);
+}
 
-    if (!properties) {
+float SDL_GetFloatPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, float default_value)
+{
+    return SDL_PrivateGetFloatProperty(SDL_FindProperties(props, NULL, NULL), key, default_value);
+}
+
+static SDL_bool SDL_PrivateGetBooleanProperty(SDL_Properties *properties, SDL_PropertyKey key, SDL_bool default_value)
+{
+    SDL_bool value = default_value;
+
+    if (!properties || !key) {
         return value;
     }
 
     SDL_LockMutex(properties->lock);
     {
         SDL_Property *property = NULL;
-        if (SDL_FindInHashTable(properties->props, name, (const void **)&property)) {
+        if (SDL_FindInHashTable(properties->props, (const void *)(uintptr_t)key, (const void **)&property)) {
             switch (property->type) {
             case SDL_PROPERTY_TYPE_STRING:
                 value = SDL_GetStringBoolean(property->value.string_value, default_value);
@@ -732,6 +971,24 @@ SDL_bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, SDL_bo
     return value;
 }
 
+SDL_bool SDL_GetBooleanProperty(SDL_PropertiesID props, const char *name, SDL_bool default_value)
+{
+    SDL_Properties *properties;
+    SDL_PropertyKey key = 0;
+
+    if (!name || !*name) {
+        return default_value;
+    }
+
+    properties = SDL_FindProperties(props, name, &key);
+    return SDL_PrivateGetBooleanProperty(properties, key, default_value);
+}
+
+SDL_bool SDL_GetBooleanPropertyByKey(SDL_PropertiesID props, SDL_PropertyKey key, SDL_bool default_value)
+{
+    return SDL_PrivateGetBooleanProperty(SDL_FindProperties(props, NULL, NULL), key, default_value);
+}
+
 int SDL_ClearProperty(SDL_PropertiesID props, const char *name)
 {
     return SDL_PrivateSetProperty(props, name, NULL);
@@ -748,10 +1005,7 @@ int SDL_EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCallb
         return SDL_InvalidParamError("callback");
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties);
-    SDL_UnlockMutex(SDL_properties_lock);
-
+    properties = SDL_FindProperties(props, NULL, NULL);
     if (!properties) {
         return SDL_InvalidParamError("props");
     }
@@ -763,7 +1017,7 @@ int SDL_EnumerateProperties(SDL_PropertiesID props, SDL_EnumeratePropertiesCallb
 
         iter = NULL;
         while (SDL_IterateHashTable(properties->props, &key, &value, &iter)) {
-            callback(userdata, props, (const char *)key);
+            callback(userdata, props, ((const SDL_Property *)value)->name);
         }
     }
     SDL_UnlockMutex(properties->lock);
@@ -809,7 +1063,14 @@ void SDL_DestroyProperties(SDL_PropertiesID props)
         return;
     }
 
-    SDL_LockMutex(SDL_properties_lock);
-    SDL_RemoveFromHashTable(SDL_properties, (const void *)(uintptr_t)props);
-    SDL_UnlockMutex(SDL_properties_lock);
+    SDL_Properties *properties = NULL;
+
+    SDL_LockRWLockForWriting(SDL_properties_lock);
+    if (SDL_FindInHashTable(SDL_properties, (const void *)(uintptr_t)props, (const void **)&properties)) {
+        SDL_RemoveFromHashTable(SDL_properties, (const void *)(uintptr_t)props);
+    }
+    SDL_UnlockRWLock(SDL_properties_lock);
+
+    // Cleanup callbacks may destroy other properties, and SDL_properties_lock isn't recursive
+    SDL_FreeProperties(NULL, properties, NULL);
 }
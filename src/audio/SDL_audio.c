@@ -499,6 +499,8 @@ static void DestroyLogicalAudioDevice(SDL_LogicalAudioDevice *logdev)
 
     UpdateAudioStreamFormatsPhysical(logdev->physical_device);
     SDL_free(logdev);
+
+    WakeOfflineAudioDevices();
 }
 
 // this must not be called while `device` is still in a device list, or while a device's audio thread is still running.
@@ -520,6 +522,7 @@ static void DestroyPhysicalAudioDevice(SDL_AudioDevice *device)
 
     SDL_UnlockMutex(device->lock);  // don't use ReleaseAudioDevice because we don't want to change refcounts while destroying.
 
+    SDL_DestroyProperties(device->props);
     SDL_DestroyMutex(device->lock);
     SDL_DestroyCondition(device->close_cond);
     SDL_free(device->work_buffer);
@@ -990,6 +993,51 @@ int SDL_InitAudio(const char *driver_name)
     return 0;
 }
 
+// Devices rendering offline sleep on this until something changes that might let them render. Every change bumps the serial,
+// so one that happens between a device checking its streams and going to sleep isn't missed. The lock and condition are
+// shared by all devices, since lock-free puts can't safely look up which device their stream is bound to.
+static SDL_SpinLock offline_wakeup_spinlock;
+static SDL_Mutex *offline_wakeup_lock = NULL;
+static SDL_Condition *offline_wakeup_cond = NULL;
+static SDL_AtomicInt offline_wakeup_serial;
+static SDL_AtomicInt offline_waiters;
+
+static SDL_bool InitOfflineWakeup(void)
+{
+    SDL_bool retval;
+
+    SDL_LockSpinlock(&offline_wakeup_spinlock);
+    if (!offline_wakeup_lock) {
+        offline_wakeup_lock = SDL_CreateMutex();
+    }
+    if (!offline_wakeup_cond) {
+        offline_wakeup_cond = SDL_CreateCondition();
+    }
+    retval = (offline_wakeup_lock && offline_wakeup_cond) ? SDL_TRUE : SDL_FALSE;
+    SDL_UnlockSpinlock(&offline_wakeup_spinlock);
+
+    return retval;
+}
+
+static void QuitOfflineWakeup(void)
+{
+    SDL_assert(SDL_AtomicGet(&offline_waiters) == 0);
+    SDL_DestroyCondition(offline_wakeup_cond);
+    offline_wakeup_cond = NULL;
+    SDL_DestroyMutex(offline_wakeup_lock);
+    offline_wakeup_lock = NULL;
+}
+
+void WakeOfflineAudioDevices(void)
+{
+    SDL_AtomicIncRef(&offline_wakeup_serial);
+    if (SDL_AtomicGet(&offline_waiters) > 0) {  // a waiter only counts itself once the lock and condition exist.
+        SDL_LockMutex(offline_wakeup_lock);
+        SDL_BroadcastCondition(offline_wakeup_cond);
+        SDL_UnlockMutex(offline_wakeup_lock);
+    }
+}
+
 void SDL_QuitAudio(void)
 {
     if (!current_audio.name) {  // not initialized?!
@@ -1034,6 +1082,8 @@ void SDL_QuitAudio(void)
     // Free the driver data
     current_audio.impl.Deinitialize();
 
+    QuitOfflineWakeup();  // no device threads are left to wait on it.
+
     SDL_DestroyRWLock(current_audio.device_hash_lock);
     SDL_DestroyHashTable(device_hash);
 
@@ -1053,6 +1103,236 @@ static void MixFloat32Audio(float *dst, const float *src, const int buffer_size)
 }
 
 
+// Optional worker threads that pull from a playback device's bound streams in parallel.
+
+#define SDL_MAX_AUDIO_MIXING_THREADS 64
+#define SDL_MIN_STREAMS_FOR_MIXING_THREADS 8  // below this, waking the workers costs more than it saves.
+
+typedef struct SDL_AudioMixJob
+{
+    SDL_AudioStream *stream;
+    float *buffer;
+    int result;
+    SDL_AudioStreamTimes times;
+} SDL_AudioMixJob;
+
+typedef struct SDL_AudioMixThreads
+{
+    int num_threads;
+    SDL_Thread **threads;
+    SDL_Semaphore *work_sem;
+    SDL_Semaphore *done_sem;
+    SDL_AtomicInt shutdown;
+    SDL_AtomicInt next_job;
+    SDL_AudioMixJob *jobs;
+    int num_jobs;
+    int max_jobs;
+    Uint8 *buffers;  // max_jobs scratch buffers, `buffer_size` bytes each.
+    int buffer_size;
+    int job_size;    // bytes to request from each stream this iteration.
+} SDL_AudioMixThreads;
+
+// Runs jobs until there are none left. Called from the workers and the device thread at the same time.
+static void RunAudioMixJobs(SDL_AudioMixThreads *mixer)
+{
+    for (;;) {
+        const int i = SDL_AtomicAdd(&mixer->next_job, 1);
+        if (i >= mixer->num_jobs) {
+            break;
+        }
+        SDL_AudioMixJob *job = &mixer->jobs[i];
+        job->result = GetAudioStreamDataForDevice(job->stream, job->buffer, mixer->job_size, &job->times);
+    }
+}
+
+static int SDLCALL AudioMixThread(void *data)
+{
+    SDL_AudioMixThreads *mixer = (SDL_AudioMixThreads *) data;
+
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_TIME_CRITICAL);
+
+    for (;;) {
+        SDL_WaitSemaphore(mixer->work_sem);
+        if (SDL_AtomicGet(&mixer->shutdown)) {
+            break;
+        }
+        RunAudioMixJobs(mixer);
+        SDL_PostSemaphore(mixer->done_sem);
+    }
+    return 0;
+}
+
+static void DestroyAudioMixThreads(SDL_AudioMixThreads *mixer)
+{
+    if (!mixer) {
+        return;
+    }
+
+    SDL_AtomicSet(&mixer->shutdown, 1);
+    for (int i = 0; i < mixer->num_threads; i++) {
+        SDL_PostSemaphore(mixer->work_sem);
+    }
+    for (int i = 0; i < mixer->num_threads; i++) {
+        SDL_WaitThread(mixer->threads[i], NULL);
+    }
+
+    SDL_DestroySemaphore(mixer->work_sem);
+    SDL_DestroySemaphore(mixer->done_sem);
+    SDL_aligned_free(mixer->buffers);
+    SDL_free(mixer->jobs);
+    SDL_free(mixer->threads);
+    SDL_free(mixer);
+}
+
+static int GetMixingThreadCountFromHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_MIXING_THREADS);
+    if (hint) {
+        const int val = SDL_atoi(hint);
+        if (val > 0) {
+            return SDL_min(val, SDL_MAX_AUDIO_MIXING_THREADS);
+        }
+    }
+    return 0;
+}
+
+static SDL_AudioMixThreads *CreateAudioMixThreads(SDL_AudioDevice *device, int num_threads)
+{
+    SDL_AudioMixThreads *mixer = (SDL_AudioMixThreads *) SDL_calloc(1, sizeof (*mixer));
+    if (!mixer) {
+        return NULL;
+    }
+
+    mixer->threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (*mixer->threads));
+    mixer->work_sem = SDL_CreateSemaphore(0);
+    mixer->done_sem = SDL_CreateSemaphore(0);
+    if (!mixer->threads || !mixer->work_sem || !mixer->done_sem) {
+        DestroyAudioMixThreads(mixer);
+        return NULL;
+    }
+
+    for (int i = 0; i < num_threads; i++) {
+        char threadname[64];
+        (void)SDL_snprintf(threadname, sizeof (threadname), "SDLAudioMix%d-%d", (int) device->instance_id, i);
+        mixer->threads[i] = SDL_CreateThread(AudioMixThread, threadname, mixer);
+        if (!mixer->threads[i]) {
+            DestroyAudioMixThreads(mixer);
+            return NULL;
+        }
+        mixer->num_threads++;
+    }
+
+    return mixer;
+}
+
+// Pulls every stream that the serial mixing loop would visit, in the same order. Returns SDL_FALSE if the caller should pull them itself.
+static SDL_bool GetAudioStreamDataThreaded(SDL_AudioDevice *device, int work_buffer_size)
+{
+    SDL_AudioMixThreads *mixer = device->mix_threads;
+    int num_jobs = 0;
+
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (!SDL_AtomicGet(&logdev->paused)) {
+            for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                num_jobs++;
+            }
+        }
+    }
+
+    if (num_jobs < SDL_MIN_STREAMS_FOR_MIXING_THREADS) {
+        return SDL_FALSE;
+    }
+
+    if ((num_jobs > mixer->max_jobs) || (work_buffer_size > mixer->buffer_size)) {
+        const int max_jobs = SDL_max(num_jobs, mixer->max_jobs);
+        const int buffer_size = SDL_max(work_buffer_size, device->work_buffer_size);
+        SDL_AudioMixJob *jobs = (SDL_AudioMixJob *) SDL_realloc(mixer->jobs, max_jobs * sizeof (*jobs));
+        if (!jobs) {
+            return SDL_FALSE;
+        }
+        mixer->jobs = jobs;
+
+        Uint8 *buffers = (Uint8 *) SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t) max_jobs * buffer_size);
+        if (!buffers) {
+            return SDL_FALSE;
+        }
+        SDL_aligned_free(mixer->buffers);
+        mixer->buffers = buffers;
+        mixer->buffer_size = buffer_size;
+        mixer->max_jobs = max_jobs;
+    }
+
+    num_jobs = 0;
+    for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+        if (!SDL_AtomicGet(&logdev->paused)) {
+            for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                SDL_AudioMixJob *job = &mixer->jobs[num_jobs];
+                job->stream = stream;
+                job->buffer = (float *) (mixer->buffers + ((size_t) num_jobs * mixer->buffer_size));
+                job->result = 0;
+                SDL_zero(job->times);
+                num_jobs++;
+            }
+        }
+    }
+
+    mixer->num_jobs = num_jobs;
+    mixer->job_size = work_buffer_size;
+    SDL_AtomicSet(&mixer->next_job, 0);
+
+    for (int i = 0; i < mixer->num_threads; i++) {
+        SDL_PostSemaphore(mixer->work_sem);
+    }
+    RunAudioMixJobs(mixer);  // this thread works too, instead of just waiting.
+    for (int i = 0; i < mixer->num_threads; i++) {
+        SDL_WaitSemaphore(mixer->done_sem);
+    }
+
+    return SDL_TRUE;
+}
+
+
+// Updates the device's instrumentation at the end of an iteration that played or recorded a buffer. You must hold the device lock.
+// `start` is when the iteration began, right after the device woke up; `short_reads` is how many reads came up short this time.
+static void UpdateAudioDeviceStats(SDL_AudioDevice *device, Uint64 start, int short_reads, SDL_AudioStreamTimes *times)
+{
+    SDL_AudioDeviceStats *stats = &device->stats;
+    const Uint64 period_ns = ((Uint64) device->sample_frames * SDL_NS_PER_SECOND) / (Uint64) device->spec.freq;
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+
+    // how much later than one period after the previous wakeup did we get to run?
+    if (stats->last_iterate_start) {
+        const Uint64 interval = start - stats->last_iterate_start;
+        if (interval > period_ns) {
+            const Uint64 lateness = interval - period_ns;
+            stats->max_lateness_ns = SDL_max(stats->max_lateness_ns, lateness);
+            if (lateness > (period_ns / 2)) {
+                stats->late_wakeups++;
+            }
+        }
+    }
+    stats->last_iterate_start = start;
+
+    int bucket = 0;
+    while ((bucket < (SDL_AUDIO_DEVICE_HISTOGRAM_BUCKETS - 1)) && (elapsed >= (period_ns >> (SDL_AUDIO_DEVICE_HISTOGRAM_BUCKETS - 2 - bucket)))) {
+        bucket++;
+    }
+    stats->iterate_histogram[bucket]++;
+    stats->max_iterate_ns = SDL_max(stats->max_iterate_ns, elapsed);
+
+    stats->periods++;
+    stats->short_reads += short_reads;
+    if (short_reads > 0) {
+        stats->underruns++;
+    }
+
+    if (times) {
+        stats->resample_ns += times->resample_ns;
+        stats->convert_ns += times->convert_ns;
+    }
+}
+
+
 // Playback device thread. This is split into chunks, so backends that need to control this directly can use the pieces they need without duplicating effort.
 
 void SDL_PlaybackAudioThreadSetup(SDL_AudioDevice *device)
@@ -1065,6 +1345,8 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
 {
     SDL_assert(!device->recording);
 
+    const Uint64 start = SDL_GetTicksNS();
+
     SDL_LockMutex(device->lock);
 
     if (SDL_AtomicGet(&device->shutdown)) {
@@ -1073,6 +1355,10 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
     }
 
     SDL_bool failed = SDL_FALSE;
+    SDL_AudioStreamTimes times;
+    int short_reads = 0;
+    SDL_zero(times);
+
     int buffer_size = device->buffer_size;
     Uint8 *device_buffer = device->GetDeviceBuf(device, &buffer_size);
     if (buffer_size == 0) {
@@ -1091,12 +1377,16 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             // We should have updated this elsewhere if the format changed!
             SDL_assert(AUDIO_SPECS_EQUAL(stream->dst_spec, device->spec));
 
-            const int br = SDL_AtomicGet(&logdev->paused) ? 0 : SDL_GetAudioStreamData(stream, device_buffer, buffer_size);
+            const SDL_bool paused = SDL_AtomicGet(&logdev->paused) ? SDL_TRUE : SDL_FALSE;
+            const int br = paused ? 0 : GetAudioStreamDataForDevice(stream, device_buffer, buffer_size, &times);
             if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
                 failed = SDL_TRUE;
                 SDL_memset(device_buffer, device->silence_value, buffer_size);  // just supply silence to the device before we die.
             } else if (br < buffer_size) {
                 SDL_memset(device_buffer + br, device->silence_value, buffer_size - br);  // silence whatever we didn't write to.
+                if (!paused) {
+                    short_reads++;
+                }
             }
         } else {  // need to actually mix (or silence the buffer)
             float *final_mix_buffer = (float *) ((device->spec.format == SDL_AUDIO_F32) ? device_buffer : device->mix_buffer);
@@ -1112,6 +1402,10 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
 
             SDL_memset(final_mix_buffer, '\0', work_buffer_size);  // start with silence.
 
+            // if there are worker threads, pull all the streams up front; the mixing below is still serial and in order, so results don't change.
+            const SDL_bool threaded = device->mix_threads && GetAudioStreamDataThreaded(device, work_buffer_size);
+            int job = 0;
+
             for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_AtomicGet(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
@@ -1132,12 +1426,25 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
                        for iterating here because the binding linked list can only change while the device lock is held.
                        (we _do_ lock the stream during binding/unbinding to make sure that two threads can't try to bind
                        the same stream to different devices at the same time, though.) */
-                    const int br = SDL_GetAudioStreamData(stream, device->work_buffer, work_buffer_size);
+                    int br;
+                    if (threaded) {
+                        SDL_assert(device->mix_threads->jobs[job].stream == stream);
+                        br = device->mix_threads->jobs[job].result;
+                        times.resample_ns += device->mix_threads->jobs[job].times.resample_ns;
+                        times.convert_ns += device->mix_threads->jobs[job].times.convert_ns;
+                        if (br > 0) {  // it's okay if we get less than requested, we mix what we have. The gain was already applied.
+                            MixFloat32Audio(mix_buffer, device->mix_threads->jobs[job].buffer, br);
+                        }
+                        job++;
+                    } else {
+                        // the stream adds its output to the mix buffer itself, applying its gain as it goes. Output that can't be mixed in place goes through work_buffer.
+                        br = MixAudioStreamData(stream, mix_buffer, work_buffer_size, device->work_buffer, &times);
+                    }
+
                     if (br < 0) {  // Probably OOM. Kill the audio device; the whole thing is likely dying soon anyhow.
-                        failed = SDL_TRUE;
-                        break;
-                    } else if (br > 0) {  // it's okay if we get less than requested, we mix what we have.
-                        MixFloat32Audio(mix_buffer, (float *) device->work_buffer, br);
+                        failed = SDL_TRUE;  // keep going, though, so `job` stays in sync with the streams we walk.
+                    } else if (br < work_buffer_size) {
+                        short_reads++;
                     }
                 }
 
@@ -1151,7 +1458,7 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
             if (((Uint8 *) final_mix_buffer) != device_buffer) {
                 // !!! FIXME: we can't promise the device buf is aligned/padded for SIMD.
                 //ConvertAudio(needed_samples * device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device_buffer, device->spec.format, device->spec.channels, device->work_buffer);
-                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL);
+                ConvertAudio(needed_samples / device->spec.channels, final_mix_buffer, SDL_AUDIO_F32, device->spec.channels, device->work_buffer, device->spec.format, device->spec.channels, NULL, 1.0f);
                 SDL_memcpy(device_buffer, device->work_buffer, buffer_size);
             }
         }
@@ -1160,6 +1467,8 @@ SDL_bool SDL_PlaybackAudioThreadIterate(SDL_AudioDevice *device)
         if (device->PlayDevice(device, device_buffer, buffer_size) < 0) {
             failed = SDL_TRUE;
         }
+
+        UpdateAudioDeviceStats(device, start, short_reads, &times);
     }
 
     SDL_UnlockMutex(device->lock);
@@ -1183,6 +1492,53 @@ void SDL_PlaybackAudioThreadShutdown(SDL_AudioDevice *device)
     SDL_AudioThreadFinalize(device);
 }
 
+int SDL_WaitAudioDeviceOffline(SDL_AudioDevice *device)
+{
+    SDL_assert(!device->recording);
+
+    if (!InitOfflineWakeup()) {
+        return -1;
+    }
+
+    // Time only moves forward when there's something to render, so the output doesn't depend on how fast the app feeds the streams.
+    while (!SDL_AtomicGet(&device->shutdown)) {
+        const int serial = SDL_AtomicGet(&offline_wakeup_serial);
+        SDL_bool ready = SDL_FALSE;
+
+        SDL_LockMutex(device->lock);
+        for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
+            if (SDL_AtomicGet(&logdev->paused)) {
+                continue;  // paused? Skip this logical device.
+            }
+
+            for (SDL_AudioStream *stream = logdev->bound_streams; stream; stream = stream->next_binding) {
+                if (!AudioStreamCanProvideFrames(stream, device->sample_frames)) {
+                    ready = SDL_FALSE;
+                    goto done;
+                }
+                ready = SDL_TRUE;
+            }
+        }
+done:
+        SDL_UnlockMutex(device->lock);
+
+        if (ready) {
+            break;
+        }
+
+        // the app is still producing; sleep until it puts, flushes or binds something, or we're told to shut down.
+        SDL_LockMutex(offline_wakeup_lock);
+        SDL_AtomicIncRef(&offline_waiters);
+        while ((SDL_AtomicGet(&offline_wakeup_serial) == serial) && !SDL_AtomicGet(&device->shutdown)) {
+            SDL_WaitCondition(offline_wakeup_cond, offline_wakeup_lock);
+        }
+        SDL_AtomicDecRef(&offline_waiters);
+        SDL_UnlockMutex(offline_wakeup_lock);
+    }
+
+    return 0;
+}
+
 static int SDLCALL PlaybackAudioThread(void *devicep)  // thread entry point
 {
     SDL_AudioDevice *device = (SDL_AudioDevice *)devicep;
@@ -1214,6 +1570,8 @@ SDL_bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
 {
     SDL_assert(device->recording);
 
+    const Uint64 start = SDL_GetTicksNS();
+
     SDL_LockMutex(device->lock);
 
     if (SDL_AtomicGet(&device->shutdown)) {
@@ -1230,7 +1588,11 @@ SDL_bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
         int br = device->RecordDevice(device, device->work_buffer, device->buffer_size);
         if (br < 0) {  // uhoh, device failed for some reason!
             failed = SDL_TRUE;
-        } else if (br > 0) {  // queue the new data to each bound stream.
+        } else {
+            UpdateAudioDeviceStats(device, start, (br < device->buffer_size) ? 1 : 0, NULL);
+        }
+
+        if (br > 0) {  // queue the new data to each bound stream.
             for (SDL_LogicalAudioDevice *logdev = device->logical_devices; logdev; logdev = logdev->next) {
                 if (SDL_AtomicGet(&logdev->paused)) {
                     continue;  // paused? Skip this logical device.
@@ -1248,7 +1610,7 @@ SDL_bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device)
                     output_buffer = device->postmix_buffer;
                     const int frames = br / SDL_AUDIO_FRAMESIZE(device->spec);
                     br = frames * SDL_AUDIO_FRAMESIZE(outspec);
-                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL);
+                    ConvertAudio(frames, device->work_buffer, device->spec.format, outspec.channels, device->postmix_buffer, SDL_AUDIO_F32, outspec.channels, NULL, 1.0f);
                     logdev->postmix(logdev->postmix_userdata, &outspec, device->postmix_buffer, br);
                 }
 
@@ -1436,6 +1798,41 @@ int SDL_GetAudioDeviceFormat(SDL_AudioDeviceID devid, SDL_AudioSpec *spec, int *
     return retval;
 }
 
+SDL_PropertiesID SDL_GetAudioDeviceProperties(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDeviceStats stats;
+    Sint64 *histogram = NULL;
+    SDL_PropertiesID props = 0;
+
+    SDL_AudioDevice *device = ObtainPhysicalAudioDeviceDefaultAllowed(devid);
+    if (device) {
+        if (device->props == 0) {
+            device->props = SDL_CreateProperties();
+        }
+        props = device->props;
+        SDL_copyp(&stats, &device->stats);
+        histogram = device->stats_histogram;
+        SDL_memcpy(histogram, stats.iterate_histogram, sizeof (stats.iterate_histogram));
+    }
+    ReleaseAudioDevice(device);
+
+    // don't hold the device lock while setting these; the audio thread shouldn't wait on the properties lock.
+    if (props) {
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER, stats.periods);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_UNDERRUNS_NUMBER, stats.underruns);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_SHORT_READS_NUMBER, stats.short_reads);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_LATE_WAKEUPS_NUMBER, stats.late_wakeups);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_MAX_LATENESS_NS_NUMBER, (Sint64) stats.max_lateness_ns);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_MAX_ITERATE_NS_NUMBER, (Sint64) stats.max_iterate_ns);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_RESAMPLE_NS_NUMBER, (Sint64) stats.resample_ns);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_CONVERT_NS_NUMBER, (Sint64) stats.convert_ns);
+        SDL_SetProperty(props, SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_POINTER, histogram);
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_BUCKETS_NUMBER, SDL_AUDIO_DEVICE_HISTOGRAM_BUCKETS);
+    }
+
+    return props;
+}
+
 // this is awkward, but this makes sure we can release the device lock
 //  so the device thread can terminate but also not have two things
 //  race to close or open the device while the lock is unprotected.
@@ -1455,6 +1852,7 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
     SerializePhysicalDeviceClose(device);
 
     SDL_AtomicSet(&device->shutdown, 1);
+    WakeOfflineAudioDevices();
 
     // YOU MUST PROTECT KEY POINTS WITH SerializePhysicalDeviceClose() WHILE THE THREAD JOINS
     SDL_UnlockMutex(device->lock);
@@ -1470,6 +1868,10 @@ static void ClosePhysicalAudioDevice(SDL_AudioDevice *device)
         device->hidden = NULL;  // just in case.
     }
 
+    // nothing can be iterating the device now, so the mixing threads are idle.
+    DestroyAudioMixThreads(device->mix_threads);
+    device->mix_threads = NULL;
+
     SDL_LockMutex(device->lock);
     SDL_AtomicSet(&device->shutdown, 0);  // ready to go again.
     SDL_BroadcastCondition(device->close_cond);  // release anyone waiting in SerializePhysicalDeviceClose; they'll still block until we release device->lock, though.
@@ -1609,6 +2011,8 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
     device->sample_frames = GetDefaultSampleFramesFromFreq(device->spec.freq);
     SDL_UpdatedAudioDeviceFormat(device);  // start this off sane.
 
+    SDL_zero(device->stats);
+
     device->currently_opened = SDL_TRUE;  // mark this true even if impl.OpenDevice fails, so we know to clean up.
     if (current_audio.impl.OpenDevice(device) < 0) {
         ClosePhysicalAudioDevice(device);  // clean up anything the backend left half-initialized.
@@ -1632,6 +2036,13 @@ static int OpenPhysicalAudioDevice(SDL_AudioDevice *device, const SDL_AudioSpec
         }
     }
 
+    if (!device->recording) {
+        const int num_threads = GetMixingThreadCountFromHint();
+        if (num_threads > 0) {
+            device->mix_threads = CreateAudioMixThreads(device, num_threads);  // if this fails, we just mix on the device thread.
+        }
+    }
+
     // Start the audio thread if necessary
     if (!current_audio.impl.ProvidesOwnCallbackThread) {
         char threadname[64];
@@ -1716,6 +2127,9 @@ static int SetLogicalAudioDevicePauseState(SDL_AudioDeviceID devid, int value)
         SDL_AtomicSet(&logdev->paused, value);
     }
     ReleaseAudioDevice(device);
+    if (logdev) {
+        WakeOfflineAudioDevices();
+    }
     return logdev ? 0 : -1;  // ObtainLogicalAudioDevice will have set an error.
 }
 
@@ -1864,6 +2278,10 @@ int SDL_BindAudioStreams(SDL_AudioDeviceID devid, SDL_AudioStream **streams, int
 
     ReleaseAudioDevice(device);
 
+    if (retval == 0) {
+        WakeOfflineAudioDevices();
+    }
+
     return retval;
 }
 
@@ -1938,6 +2356,8 @@ void SDL_UnbindAudioStreams(SDL_AudioStream **streams, int num_streams)
             }
         }
     }
+
+    WakeOfflineAudioDevices();
 }
 
 void SDL_UnbindAudioStream(SDL_AudioStream *stream)
@@ -1066,3 +1066,1383 @@ static const SDL_AudioChannelConverter channel_converters[8][8] = {   /* [from][
     { SDL_Convert71ToMono, SDL_Convert71ToStereo, SDL_Convert71To21, SDL_Convert71ToQuad, SDL_Convert71To41, SDL_Convert71To51, SDL_Convert71To61, NULL }
 };
 
+// SIMD versions of the above, built from the same matrices. Each output register is a sum of lane shuffles
+// of the input frame, scaled by constant coefficients, with the zero terms left out.
+
+#ifdef SDL_SSE_INTRINSICS
+// Load `count` (1 to 4) channels, zeroing the unused lanes; the SIMD converters never touch memory past the end of a frame, so they can run in-place.
+SDL_FORCE_INLINE __m128 SDL_TARGETING("sse") SDL_LoadChannels_SSE(const float *src, const int count)
+{
+    if (count == 4) {
+        return _mm_loadu_ps(src);
+    } else if (count == 1) {
+        return _mm_load_ss(src);
+    } else if (count == 2) {
+        return _mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)src);
+    }
+    return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), (const __m64 *)src), _mm_load_ss(src + 2));
+}
+
+// Store the first `count` (1 to 4) lanes of `v`.
+SDL_FORCE_INLINE void SDL_TARGETING("sse") SDL_StoreChannels_SSE(float *dst, const __m128 v, const int count)
+{
+    if (count == 4) {
+        _mm_storeu_ps(dst, v);
+    } else if (count == 1) {
+        _mm_store_ss(dst, v);
+    } else {
+        _mm_storel_pi((__m64 *)dst, v);
+        if (count == 3) {
+            _mm_store_ss(dst + 2, _mm_movehl_ps(v, v));
+        }
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertMonoTo21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "2.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 3;
+    for (i = num_frames; i; i--, src--, dst -= 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 1);
+        const __m128 out0 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 0, 0));
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertMonoToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "quad (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 4;
+    for (i = num_frames; i; i--, src--, dst -= 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 1);
+        const __m128 out0 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 0, 0));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertMonoTo41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "4.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src--, dst -= 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 1);
+        const __m128 out0 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 0, 0));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertMonoTo51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "5.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src--, dst -= 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 1);
+        const __m128 out0 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 0, 0));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertMonoTo61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "6.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src--, dst -= 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 1);
+        const __m128 out0 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 0, 0));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertMonoTo71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src--, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 1);
+        const __m128 out0 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 0, 0));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertStereoTo21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "2.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 3;
+    for (i = num_frames; i; i--, src -= 2, dst -= 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 2);
+        const __m128 out0 = in0;
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertStereoToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "quad (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 4;
+    for (i = num_frames; i; i--, src -= 2, dst -= 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 2);
+        const __m128 out0 = in0;
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertStereoTo41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "4.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src -= 2, dst -= 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 2);
+        const __m128 out0 = in0;
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertStereoTo51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "5.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 2, dst -= 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 2);
+        const __m128 out0 = in0;
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertStereoTo61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "6.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 2, dst -= 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 2);
+        const __m128 out0 = in0;
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertStereoTo71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 2, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 2);
+        const __m128 out0 = in0;
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert21ToStereo_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "stereo (using SSE)");
+
+    for (i = num_frames; i; i--, src += 3, dst += 2) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 3);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.800000012f, 0.800000012f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.200000003f, 0.200000003f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert21ToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "quad (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 4;
+    for (i = num_frames; i; i--, src -= 3, dst -= 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 3);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(0.888888896f, 0.888888896f, 0.111111112f, 0.111111112f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.111111112f, 0.111111112f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert21To41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "4.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src -= 3, dst -= 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 3);
+        const __m128 out0 = in0;
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert21To51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "5.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 3, dst -= 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 3);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert21To61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "6.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 3, dst -= 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 3);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert21To71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 3, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 3);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f));
+        const __m128 out1 = _mm_setzero_ps();
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertQuadToStereo_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "stereo (using SSE)");
+
+    for (i = num_frames; i; i--, src += 4, dst += 2) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.421000004f, 0.421000004f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.358999997f, 0.219999999f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.219999999f, 0.358999997f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertQuadTo21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "2.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 4, dst += 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.421000004f, 0.421000004f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.358999997f, 0.219999999f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.219999999f, 0.358999997f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertQuadTo41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "4.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src -= 4, dst -= 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f));
+        const __m128 out1 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 1, 3));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertQuadTo51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "5.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 4, dst -= 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        const __m128 out1 = _mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 2));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertQuadTo61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "6.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 4, dst -= 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.939999998f, 0.939999998f, 0.000000000f, 0.000000000f));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 2, 2)), _mm_setr_ps(0.500000000f, 0.796000004f, 0.796000004f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 1, 3)), _mm_setr_ps(0.500000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_ConvertQuadTo71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 4, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        const __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 2)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert41ToStereo_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "stereo (using SSE)");
+
+    for (i = num_frames; i; i--, src += 5, dst += 2) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 1);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.374222219f, 0.374222219f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.111111112f, 0.111111112f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.319111109f, 0.195555553f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.195555553f, 0.319111109f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert41To21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "2.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 5, dst += 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 1);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.421000004f, 0.421000004f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.358999997f, 0.219999999f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.219999999f, 0.358999997f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert41ToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "quad (using SSE)");
+
+    for (i = num_frames; i; i--, src += 5, dst += 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 1);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(0.941176474f, 0.941176474f, 0.058823530f, 0.058823530f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 2, 2)), _mm_setr_ps(0.058823530f, 0.058823530f, 0.941176474f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(0, 2, 1, 0)), _mm_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.941176474f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert41To51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "5.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 5;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 5, dst -= 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 1);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 1, 3)), _mm_setr_ps(1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert41To61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "6.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 5;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 5, dst -= 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 1);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(0.939999998f, 0.939999998f, 0.000000000f, 1.000000000f));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.500000000f, 0.796000004f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 0, 1, 0)), _mm_setr_ps(0.500000000f, 0.000000000f, 0.796000004f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert41To71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 5;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 5, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 1);
+        const __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 1, 3)), _mm_setr_ps(1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert51ToStereo_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "stereo (using SSE)");
+
+    for (i = num_frames; i; i--, src += 6, dst += 2) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 2);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.294545442f, 0.294545442f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.208181813f, 0.208181813f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.090909094f, 0.090909094f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.251818180f, 0.154545456f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.154545456f, 0.251818180f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert51To21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "2.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 6, dst += 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 2);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.324000001f, 0.324000001f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.229000002f, 0.229000002f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.277000010f, 0.170000002f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.170000002f, 0.277000010f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert51ToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "quad (using SSE)");
+
+    for (i = num_frames; i; i--, src += 6, dst += 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 2);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.558095276f, 0.558095276f, 0.047619049f, 0.047619049f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.394285709f, 0.394285709f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.047619049f, 0.047619049f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(1, 0, 1, 0)), _mm_setr_ps(0.000000000f, 0.000000000f, 0.558095276f, 0.558095276f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert51To41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "4.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 6, dst += 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 2);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.586000025f, 0.586000025f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.414000005f, 0.414000005f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(0, 2, 1, 0)), _mm_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.586000025f)));
+        const __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.586000025f, 0.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert51To61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "6.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 6;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 6, dst -= 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 2);
+        const __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.939999998f, 0.939999998f, 0.939999998f, 1.000000000f));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 1, 0, 0)), _mm_setr_ps(0.500000000f, 0.796000004f, 0.796000004f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.500000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert51To71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 6;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 6, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 2);
+        const __m128 out0 = in0;
+        const __m128 out1 = in1;
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert61ToStereo_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "stereo (using SSE)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 2) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 3);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.247384623f, 0.247384623f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.174461529f, 0.174461529f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.076923080f, 0.076923080f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.174461529f, 0.174461529f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.226153851f, 0.100615382f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.100615382f, 0.226153851f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert61To21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "2.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 3);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.268000007f, 0.268000007f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.188999996f, 0.188999996f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.188999996f, 0.188999996f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.245000005f, 0.108999997f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.108999997f, 0.245000005f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert61ToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "quad (using SSE)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 3);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.463679999f, 0.463679999f, 0.040000003f, 0.040000003f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.327360004f, 0.327360004f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.040000003f, 0.040000003f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(0, 0, 2, 1)), _mm_setr_ps(0.168960005f, 0.168960005f, 0.327360004f, 0.327360004f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(2, 1, 1, 0)), _mm_setr_ps(0.000000000f, 0.000000000f, 0.431039989f, 0.431039989f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert61To41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "4.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 3);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.483000010f, 0.483000010f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.340999991f, 0.340999991f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(0, 2, 2, 1)), _mm_setr_ps(0.175999999f, 0.175999999f, 0.000000000f, 0.340999991f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(1, 2, 1, 0)), _mm_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.449000001f)));
+        __m128 out1 = _mm_mul_ps(in1, _mm_setr_ps(0.340999991f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 2)), _mm_setr_ps(0.449000001f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert61To51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "5.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 3);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.611000001f, 0.611000001f, 0.611000001f, 1.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 2, 1)), _mm_setr_ps(0.223000005f, 0.223000005f, 0.000000000f, 0.000000000f)));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.432000011f, 0.432000011f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 2, 1)), _mm_setr_ps(0.568000019f, 0.568000019f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert61To71_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "7.1 (using SSE)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 7;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 7, dst -= 8) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 3);
+        const __m128 out0 = in0;
+        const __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(2, 1, 0, 0)), _mm_setr_ps(0.707000017f, 0.707000017f, 1.000000000f, 1.000000000f));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert71ToStereo_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "stereo (using SSE)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 2) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 4);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.211866662f, 0.211866662f, 0.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.150266662f, 0.150266662f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.066666670f, 0.066666670f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.181066677f, 0.111066669f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.111066669f, 0.181066677f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.194133341f, 0.085866667f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.085866667f, 0.194133341f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert71To21_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "2.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 3) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 4);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.226999998f, 0.226999998f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.160999998f, 0.160999998f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 0, 0)), _mm_setr_ps(0.194000006f, 0.119000003f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.119000003f, 0.194000006f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.208000004f, 0.092000000f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.092000000f, 0.208000004f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 3);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert71ToQuad_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "quad (using SSE)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 4) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 4);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.466344833f, 0.466344833f, 0.034482758f, 0.034482758f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.329241365f, 0.329241365f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 3, 3)), _mm_setr_ps(0.034482758f, 0.034482758f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(1, 0, 3, 2)), _mm_setr_ps(0.169931039f, 0.169931039f, 0.466344833f, 0.466344833f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(in1, _mm_setr_ps(0.000000000f, 0.000000000f, 0.433517247f, 0.433517247f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert71To41_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "4.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 5) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 4);
+        __m128 out0 = _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 3, 1, 0)), _mm_setr_ps(0.483000010f, 0.483000010f, 1.000000000f, 0.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in0, in0, _MM_SHUFFLE(3, 2, 2, 2)), _mm_setr_ps(0.340999991f, 0.340999991f, 0.000000000f, 0.000000000f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(0, 2, 3, 2)), _mm_setr_ps(0.175999999f, 0.175999999f, 0.000000000f, 0.483000010f)));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(2, 2, 1, 0)), _mm_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.449000001f)));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 1)), _mm_setr_ps(0.483000010f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 1, 3)), _mm_setr_ps(0.449000001f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 1);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert71To51_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "5.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 6) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 4);
+        __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.518000007f, 0.518000007f, 0.518000007f, 1.000000000f));
+        out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 3, 2)), _mm_setr_ps(0.188999996f, 0.188999996f, 0.000000000f, 0.000000000f)));
+        __m128 out1 = _mm_mul_ps(in1, _mm_setr_ps(0.518000007f, 0.518000007f, 0.000000000f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 2, 3, 2)), _mm_setr_ps(0.481999993f, 0.481999993f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 2);
+    }
+}
+
+static void SDL_TARGETING("sse") SDL_Convert71To61_SSE(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "6.1 (using SSE)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 7) {
+        const __m128 in0 = SDL_LoadChannels_SSE(src, 4);
+        const __m128 in1 = SDL_LoadChannels_SSE(src + 4, 4);
+        const __m128 out0 = _mm_mul_ps(in0, _mm_setr_ps(0.541000009f, 0.541000009f, 0.541000009f, 1.000000000f));
+        __m128 out1 = _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 1, 0, 0)), _mm_setr_ps(0.287999988f, 0.458999991f, 0.458999991f, 0.000000000f));
+        out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_shuffle_ps(in1, in1, _MM_SHUFFLE(3, 3, 2, 1)), _mm_setr_ps(0.287999988f, 0.541000009f, 0.541000009f, 0.000000000f)));
+        SDL_StoreChannels_SSE(dst, out0, 4);
+        SDL_StoreChannels_SSE(dst + 4, out1, 3);
+    }
+}
+
+static const SDL_AudioChannelConverter channel_converters_SSE[8][8] = {   /* [from][to] */
+    { NULL, NULL, SDL_ConvertMonoTo21_SSE, SDL_ConvertMonoToQuad_SSE, SDL_ConvertMonoTo41_SSE, SDL_ConvertMonoTo51_SSE, SDL_ConvertMonoTo61_SSE, SDL_ConvertMonoTo71_SSE },
+    { NULL, NULL, SDL_ConvertStereoTo21_SSE, SDL_ConvertStereoToQuad_SSE, SDL_ConvertStereoTo41_SSE, SDL_ConvertStereoTo51_SSE, SDL_ConvertStereoTo61_SSE, SDL_ConvertStereoTo71_SSE },
+    { NULL, SDL_Convert21ToStereo_SSE, NULL, SDL_Convert21ToQuad_SSE, SDL_Convert21To41_SSE, SDL_Convert21To51_SSE, SDL_Convert21To61_SSE, SDL_Convert21To71_SSE },
+    { NULL, SDL_ConvertQuadToStereo_SSE, SDL_ConvertQuadTo21_SSE, NULL, SDL_ConvertQuadTo41_SSE, SDL_ConvertQuadTo51_SSE, SDL_ConvertQuadTo61_SSE, SDL_ConvertQuadTo71_SSE },
+    { NULL, SDL_Convert41ToStereo_SSE, SDL_Convert41To21_SSE, SDL_Convert41ToQuad_SSE, NULL, SDL_Convert41To51_SSE, SDL_Convert41To61_SSE, SDL_Convert41To71_SSE },
+    { NULL, SDL_Convert51ToStereo_SSE, SDL_Convert51To21_SSE, SDL_Convert51ToQuad_SSE, SDL_Convert51To41_SSE, NULL, SDL_Convert51To61_SSE, SDL_Convert51To71_SSE },
+    { NULL, SDL_Convert61ToStereo_SSE, SDL_Convert61To21_SSE, SDL_Convert61ToQuad_SSE, SDL_Convert61To41_SSE, SDL_Convert61To51_SSE, NULL, SDL_Convert61To71_SSE },
+    { NULL, SDL_Convert71ToStereo_SSE, SDL_Convert71To21_SSE, SDL_Convert71ToQuad_SSE, SDL_Convert71To41_SSE, SDL_Convert71To51_SSE, SDL_Convert71To61_SSE, NULL }
+};
+
+#ifdef SDL_AVX2_INTRINSICS
+// Load `count` (1 to 8) channels, zeroing the unused lanes.
+SDL_FORCE_INLINE __m256 SDL_TARGETING("avx2") SDL_LoadChannels_AVX2(const float *src, const int count)
+{
+    if (count == 8) {
+        return _mm256_loadu_ps(src);
+    } else if (count > 4) {
+        return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(src)), SDL_LoadChannels_SSE(src + 4, count - 4), 1);
+    }
+    return _mm256_insertf128_ps(_mm256_setzero_ps(), SDL_LoadChannels_SSE(src, count), 0);
+}
+
+// Store the first `count` (1 to 8) lanes of `v`.
+SDL_FORCE_INLINE void SDL_TARGETING("avx2") SDL_StoreChannels_AVX2(float *dst, const __m256 v, const int count)
+{
+    if (count == 8) {
+        _mm256_storeu_ps(dst, v);
+    } else if (count > 4) {
+        _mm_storeu_ps(dst, _mm256_castps256_ps128(v));
+        SDL_StoreChannels_SSE(dst + 4, _mm256_extractf128_ps(v, 1), count - 4);
+    } else {
+        SDL_StoreChannels_SSE(dst, _mm256_castps256_ps128(v), count);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertMonoTo41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "4.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src--, dst -= 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 1);
+        const __m256 out0 = _mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 0, 2, 3, 4, 5, 6, 7));
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertMonoTo51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "5.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src--, dst -= 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 1);
+        const __m256 out0 = _mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 0, 2, 3, 4, 5, 6, 7));
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertMonoTo61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "6.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src--, dst -= 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 1);
+        const __m256 out0 = _mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 0, 2, 3, 4, 5, 6, 7));
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertMonoTo71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("mono", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1);
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src--, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 1);
+        const __m256 out0 = _mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 0, 2, 3, 4, 5, 6, 7));
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertStereoTo41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "4.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src -= 2, dst -= 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 2);
+        const __m256 out0 = in0;
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertStereoTo51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "5.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 2, dst -= 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 2);
+        const __m256 out0 = in0;
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertStereoTo61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "6.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 2, dst -= 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 2);
+        const __m256 out0 = in0;
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertStereoTo71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("stereo", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 2;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 2, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 2);
+        const __m256 out0 = in0;
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert21To41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "4.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src -= 3, dst -= 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 3);
+        const __m256 out0 = in0;
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert21To51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "5.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 3, dst -= 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 3);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 4, 5, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert21To61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "6.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 3, dst -= 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 3);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 4, 5, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert21To71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("2.1", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 3;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 3, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 3);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 4, 5, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertQuadTo41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "4.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 5;
+    for (i = num_frames; i; i--, src -= 4, dst -= 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 4);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 3, 5, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertQuadTo51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "5.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 4, dst -= 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 4);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 2, 3, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertQuadTo61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "6.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 4, dst -= 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 4);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 2, 2, 3, 7)), _mm256_setr_ps(0.939999998f, 0.939999998f, 0.000000000f, 0.000000000f, 0.500000000f, 0.796000004f, 0.796000004f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 3, 5, 6, 7)), _mm256_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.500000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_ConvertQuadTo71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("quad", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 4;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 4, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 4);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 2, 3, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f, 1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert41To51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "5.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 5;
+    dst += (num_frames-1) * 6;
+    for (i = num_frames; i; i--, src -= 5, dst -= 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 5);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 3, 4, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f, 1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert41To61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "6.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 5;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 5, dst -= 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 5);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 3, 3, 4, 7)), _mm256_setr_ps(0.939999998f, 0.939999998f, 0.000000000f, 1.000000000f, 0.500000000f, 0.796000004f, 0.796000004f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(in0, _mm256_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.500000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert41To71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("4.1", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 5;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 5, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 5);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 2, 3, 4, 6, 7)), _mm256_setr_ps(1.000000000f, 1.000000000f, 0.000000000f, 1.000000000f, 1.000000000f, 1.000000000f, 0.000000000f, 0.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert51To41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "4.1 (using AVX2)");
+
+    for (i = num_frames; i; i--, src += 6, dst += 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 6);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 3, 4, 5, 5, 6, 7)), _mm256_setr_ps(0.586000025f, 0.586000025f, 1.000000000f, 0.586000025f, 0.586000025f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(2, 2, 2, 3, 4, 5, 6, 7)), _mm256_setr_ps(0.414000005f, 0.414000005f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert51To61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "6.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 6;
+    dst += (num_frames-1) * 7;
+    for (i = num_frames; i; i--, src -= 6, dst -= 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 6);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 4, 4, 5, 7)), _mm256_setr_ps(0.939999998f, 0.939999998f, 0.939999998f, 1.000000000f, 0.500000000f, 0.796000004f, 0.796000004f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 5, 5, 6, 7)), _mm256_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.500000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert51To71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("5.1", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 6;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 6, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 6);
+        const __m256 out0 = in0;
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert61To41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "4.1 (using AVX2)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 7);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 3, 4, 4, 5, 6, 7)), _mm256_setr_ps(0.483000010f, 0.483000010f, 1.000000000f, 0.340999991f, 0.340999991f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(2, 2, 2, 5, 6, 5, 6, 7)), _mm256_setr_ps(0.340999991f, 0.340999991f, 0.000000000f, 0.449000001f, 0.449000001f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(5, 6, 2, 3, 4, 5, 6, 7)), _mm256_setr_ps(0.175999999f, 0.175999999f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert61To51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "5.1 (using AVX2)");
+
+    for (i = num_frames; i; i--, src += 7, dst += 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 7);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 4, 4, 6, 7)), _mm256_setr_ps(0.611000001f, 0.611000001f, 0.611000001f, 1.000000000f, 0.432000011f, 0.432000011f, 0.000000000f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(5, 6, 2, 3, 5, 6, 6, 7)), _mm256_setr_ps(0.223000005f, 0.223000005f, 0.000000000f, 0.000000000f, 0.568000019f, 0.568000019f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert61To71_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("6.1", "7.1 (using AVX2)");
+
+    // convert backwards, since output is growing in-place.
+    src += (num_frames-1) * 7;
+    dst += (num_frames-1) * 8;
+    for (i = num_frames; i; i--, src -= 7, dst -= 8) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 7);
+        const __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 4, 4, 5, 6)), _mm256_setr_ps(1.000000000f, 1.000000000f, 1.000000000f, 1.000000000f, 0.707000017f, 0.707000017f, 1.000000000f, 1.000000000f));
+        SDL_StoreChannels_AVX2(dst, out0, 8);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert71To41_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "4.1 (using AVX2)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 5) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 8);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 3, 4, 5, 5, 6, 7)), _mm256_setr_ps(0.483000010f, 0.483000010f, 1.000000000f, 0.483000010f, 0.483000010f, 0.000000000f, 0.000000000f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(2, 2, 2, 6, 7, 5, 6, 7)), _mm256_setr_ps(0.340999991f, 0.340999991f, 0.000000000f, 0.449000001f, 0.449000001f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(6, 7, 2, 3, 4, 5, 6, 7)), _mm256_setr_ps(0.175999999f, 0.175999999f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 5);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert71To51_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "5.1 (using AVX2)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 6) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 8);
+        __m256 out0 = _mm256_mul_ps(in0, _mm256_setr_ps(0.518000007f, 0.518000007f, 0.518000007f, 1.000000000f, 0.518000007f, 0.518000007f, 0.000000000f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(6, 7, 2, 3, 6, 7, 6, 7)), _mm256_setr_ps(0.188999996f, 0.188999996f, 0.000000000f, 0.000000000f, 0.481999993f, 0.481999993f, 0.000000000f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 6);
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Convert71To61_AVX2(float *dst, const float *src, int num_frames)
+{
+    int i;
+
+    LOG_DEBUG_AUDIO_CONVERT("7.1", "6.1 (using AVX2)");
+
+    for (i = num_frames; i; i--, src += 8, dst += 7) {
+        const __m256 in0 = SDL_LoadChannels_AVX2(src, 8);
+        __m256 out0 = _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 4, 4, 5, 7)), _mm256_setr_ps(0.541000009f, 0.541000009f, 0.541000009f, 1.000000000f, 0.287999988f, 0.458999991f, 0.458999991f, 0.000000000f));
+        out0 = _mm256_add_ps(out0, _mm256_mul_ps(_mm256_permutevar8x32_ps(in0, _mm256_setr_epi32(0, 1, 2, 3, 5, 6, 7, 7)), _mm256_setr_ps(0.000000000f, 0.000000000f, 0.000000000f, 0.000000000f, 0.287999988f, 0.541000009f, 0.541000009f, 0.000000000f)));
+        SDL_StoreChannels_AVX2(dst, out0, 7);
+    }
+}
+
+static const SDL_AudioChannelConverter channel_converters_AVX2[8][8] = {   /* [from][to] */
+    { NULL, NULL, NULL, NULL, SDL_ConvertMonoTo41_AVX2, SDL_ConvertMonoTo51_AVX2, SDL_ConvertMonoTo61_AVX2, SDL_ConvertMonoTo71_AVX2 },
+    { NULL, NULL, NULL, NULL, SDL_ConvertStereoTo41_AVX2, SDL_ConvertStereoTo51_AVX2, SDL_ConvertStereoTo61_AVX2, SDL_ConvertStereoTo71_AVX2 },
+    { NULL, NULL, NULL, NULL, SDL_Convert21To41_AVX2, SDL_Convert21To51_AVX2, SDL_Convert21To61_AVX2, SDL_Convert21To71_AVX2 },
+    { NULL, NULL, NULL, NULL, SDL_ConvertQuadTo41_AVX2, SDL_ConvertQuadTo51_AVX2, SDL_ConvertQuadTo61_AVX2, SDL_ConvertQuadTo71_AVX2 },
+    { NULL, NULL, NULL, NULL, NULL, SDL_Convert41To51_AVX2, SDL_Convert41To61_AVX2, SDL_Convert41To71_AVX2 },
+    { NULL, NULL, NULL, NULL, SDL_Convert51To41_AVX2, NULL, SDL_Convert51To61_AVX2, SDL_Convert51To71_AVX2 },
+    { NULL, NULL, NULL, NULL, SDL_Convert61To41_AVX2, SDL_Convert61To51_AVX2, NULL, SDL_Convert61To71_AVX2 },
+    { NULL, NULL, NULL, NULL, SDL_Convert71To41_AVX2, SDL_Convert71To51_AVX2, SDL_Convert71To61_AVX2, NULL }
+};
+
+#endif // SDL_AVX2_INTRINSICS
+
+#endif // SDL_SSE_INTRINSICS
+
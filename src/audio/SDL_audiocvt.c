@@ -164,8 +164,11 @@ static SDL_bool SDL_IsSupportedChannelCount(const int channels)
 //
 // The scratch buffer must be able to store `num_frames * CalculateMaxSampleFrameSize(src_format, src_channels, dst_format, dst_channels)` bytes.
 // If the scratch buffer is NULL, this restriction applies to the output buffer instead.
+//
+// The gain is applied to the float32 data after any channel conversion, which is the same place SDL_MixAudio
+// would apply it, so gaining here and mixing later gets exactly the same results as mixing with the gain as volume.
 void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
-                  void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch)
+                  void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch, float gain)
 {
     SDL_assert(src != NULL);
     SDL_assert(dst != NULL);
@@ -202,7 +205,7 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
        it was a bloat on SDL compile times and final library size. */
 
     // see if we can skip float conversion entirely.
-    if (src_channels == dst_channels) {
+    if ((src_channels == dst_channels) && (gain == 1.0f)) {
         if (src_format == dst_format) {
             // nothing to do, we're already in the right format, just copy it over if necessary.
             if (src != dst) {
@@ -225,10 +228,11 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
     const SDL_bool srcconvert = src_format != SDL_AUDIO_F32;
     const SDL_bool channelconvert = src_channels != dst_channels;
     const SDL_bool dstconvert = dst_format != SDL_AUDIO_F32;
+    const SDL_bool gainconvert = gain != 1.0f;
 
     // get us to float format.
     if (srcconvert) {
-        void* buf = (channelconvert || dstconvert) ? scratch : dst;
+        void* buf = (channelconvert || gainconvert || dstconvert) ? scratch : dst;
         ConvertAudioToFloat((float *) buf, src, num_frames * src_channels, src_format);
         src = buf;
     }
@@ -257,15 +261,38 @@ void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, i
             #endif
         }
 
+        // otherwise use the generated SIMD converters, where there is one for this layout.
+        #ifdef SDL_SSE_INTRINSICS
+        #ifdef SDL_AVX2_INTRINSICS
+        if (!override && SDL_HasAVX2()) { override = channel_converters_AVX2[src_channels - 1][dst_channels - 1]; }
+        #endif
+        if (!override && SDL_HasSSE()) { override = channel_converters_SSE[src_channels - 1][dst_channels - 1]; }
+        #endif
+        #ifdef SDL_NEON_CHANNEL_CONVERTERS
+        if (!override && SDL_HasNEON()) { override = channel_converters_NEON[src_channels - 1][dst_channels - 1]; }
+        #endif
+
         if (override) {
             channel_converter = override;
         }
 
-        void* buf = dstconvert ? scratch : dst;
+        void* buf = (gainconvert || dstconvert) ? scratch : dst;
         channel_converter((float *) buf, (const float *) src, num_frames);
         src = buf;
     }
 
+    // Gain adjustment
+    if (gainconvert) {
+        float *buf = (float *) (dstconvert ? scratch : dst);
+        const float *fsrc = (const float *) src;
+        const int total_samples = num_frames * dst_channels;
+
+        for (int i = 0; i < total_samples; i++) {
+            buf[i] = fsrc[i] * gain;
+        }
+        src = buf;
+    }
+
     // Resampling is not done in here. SDL_AudioStream handles that.
 
     // Move to final data type.
@@ -302,6 +329,56 @@ static Sint64 GetAudioStreamResampleRate(SDL_AudioStream* stream, int src_freq,
     return resample_rate;
 }
 
+// Only fixed ratios get a filter bank; SDL_SetAudioStreamFrequencyRatio is often used to smoothly vary the pitch,
+// and rebuilding the bank every time would cost far more than it saves.
+static const SDL_ResamplerFilterBank *GetAudioStreamResamplerBank(SDL_AudioStream *stream, int src_freq)
+{
+    const SDL_AudioResamplingQuality quality = stream->resampling_quality;
+    const int dst_freq = stream->dst_spec.freq;
+
+    if ((stream->freq_ratio != 1.0f) || (quality == SDL_AUDIO_RESAMPLING_LOW)) {
+        return NULL;
+    }
+
+    // If the rates need too many phases for a bank, remember that too, so we don't try again for every chunk.
+    if ((stream->resampler_bank_quality != quality) || (stream->resampler_bank_src_freq != src_freq) || (stream->resampler_bank_dst_freq != dst_freq)) {
+        SDL_DestroyResamplerFilterBank(stream->resampler_bank);
+        stream->resampler_bank = SDL_CreateResamplerFilterBank(quality, src_freq, dst_freq);
+        stream->resampler_bank_quality = quality;
+        stream->resampler_bank_src_freq = src_freq;
+        stream->resampler_bank_dst_freq = dst_freq;
+    }
+
+    return stream->resampler_bank;
+}
+
+static SDL_AudioResamplingQuality GetDefaultResamplingQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_RESAMPLING_QUALITY);
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "low") == 0) {
+            return SDL_AUDIO_RESAMPLING_LOW;
+        } else if (SDL_strcasecmp(hint, "high") == 0) {
+            return SDL_AUDIO_RESAMPLING_HIGH;
+        }
+    }
+
+    return SDL_AUDIO_RESAMPLING_MEDIUM;
+}
+
+// You must hold stream->lock. The quality can change between calls, but not while we're working out how much to resample.
+static void UpdateAudioStreamResamplingQuality(SDL_AudioStream *stream)
+{
+    Sint64 quality = stream->default_resampling_quality;
+
+    if (stream->props) {
+        quality = SDL_GetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_RESAMPLING_QUALITY_NUMBER, quality);
+    }
+
+    stream->resampling_quality = (SDL_AudioResamplingQuality)SDL_clamp(quality, SDL_AUDIO_RESAMPLING_LOW, SDL_AUDIO_RESAMPLING_HIGH);
+}
+
 static int UpdateAudioStreamInputSpec(SDL_AudioStream *stream, const SDL_AudioSpec *spec)
 {
     if (AUDIO_SPECS_EQUAL(stream->input_spec, *spec)) {
@@ -328,6 +405,9 @@ SDL_AudioStream *SDL_CreateAudioStream(const SDL_AudioSpec *src_spec, const SDL_
     }
 
     retval->freq_ratio = 1.0f;
+    retval->gain = 1.0f;
+    retval->default_resampling_quality = GetDefaultResamplingQuality();
+    retval->resampling_quality = retval->default_resampling_quality;
     retval->queue = SDL_CreateAudioQueue(8192);
 
     if (!retval->queue) {
@@ -360,7 +440,20 @@ SDL_PropertiesID SDL_GetAudioStreamProperties(SDL_AudioStream *stream)
     }
     if (stream->props == 0) {
         stream->props = SDL_CreateProperties();
+        if (stream->props == 0) {
+            return 0;
+        }
     }
+
+    SDL_LockMutex(stream->lock);
+    const Sint64 short_reads = stream->short_reads;
+    const Sint64 device_queued_frames = stream->device_queued_frames;
+    SDL_UnlockMutex(stream->lock);
+
+    // don't hold the stream lock while setting these, the app might be in the middle of a property callback of its own.
+    SDL_SetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_SHORT_READS_NUMBER, short_reads);
+    SDL_SetNumberProperty(stream->props, SDL_PROP_AUDIOSTREAM_DEVICE_QUEUED_FRAMES_NUMBER, device_queued_frames);
+
     return stream->props;
 }
 
@@ -373,6 +466,7 @@ int SDL_SetAudioStreamGetCallback(SDL_AudioStream *stream, SDL_AudioStreamCallba
     stream->get_callback = callback;
     stream->get_callback_userdata = userdata;
     SDL_UnlockMutex(stream->lock);
+    WakeOfflineAudioDevices();
     return 0;
 }
 
@@ -384,6 +478,7 @@ int SDL_SetAudioStreamPutCallback(SDL_AudioStream *stream, SDL_AudioStreamCallba
     SDL_LockMutex(stream->lock);
     stream->put_callback = callback;
     stream->put_callback_userdata = userdata;
+    SDL_AtomicIncRef(&stream->producer_serial);  // lock-free puts can't call this, so they have to notice.
     SDL_UnlockMutex(stream->lock);
     return 0;
 }
@@ -487,8 +582,12 @@ int SDL_SetAudioStreamFormat(SDL_AudioStream *stream, const SDL_AudioSpec *src_s
         SDL_copyp(&stream->dst_spec, dst_spec);
     }
 
+    SDL_AtomicIncRef(&stream->producer_serial);  // lock-free puts have to pick up the new format.
+
     SDL_UnlockMutex(stream->lock);
 
+    WakeOfflineAudioDevices();
+
     return 0;
 }
 
@@ -529,6 +628,35 @@ int SDL_SetAudioStreamFrequencyRatio(SDL_AudioStream *stream, float freq_ratio)
     return 0;
 }
 
+float SDL_GetAudioStreamGain(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return -1.0f;
+    }
+
+    SDL_LockMutex(stream->lock);
+    const float gain = stream->gain;
+    SDL_UnlockMutex(stream->lock);
+
+    return gain;
+}
+
+int SDL_SetAudioStreamGain(SDL_AudioStream *stream, float gain)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!(gain >= 0.0f)) {  // this also catches NaN.
+        return SDL_InvalidParamError("gain");
+    }
+
+    SDL_LockMutex(stream->lock);
+    stream->gain = gain;
+    SDL_UnlockMutex(stream->lock);
+
+    return 0;
+}
+
 static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
 {
     if (stream->src_spec.format == 0) {
@@ -540,6 +668,12 @@ static int CheckAudioStreamIsFullySetup(SDL_AudioStream *stream)
     return 0;
 }
 
+// Moves anything put without the lock into the stream's queue, after everything put before it. You must hold stream->lock!
+static int DrainAudioStreamInbox(SDL_AudioStream *stream)
+{
+    return SDL_DrainAudioQueueInbox(stream->queue);
+}
+
 static int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void* userdata)
 {
 #if DEBUG_AUDIOSTREAM
@@ -553,6 +687,12 @@ static int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int le
         return -1;
     }
 
+    // anything put without the lock came first.
+    if (DrainAudioStreamInbox(stream) != 0) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
+    }
+
     if ((len % SDL_AUDIO_FRAMESIZE(stream->src_spec)) != 0) {
         SDL_UnlockMutex(stream->lock);
         return SDL_SetError("Can't add partial sample frames");
@@ -588,6 +728,10 @@ static int PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int le
 
     SDL_UnlockMutex(stream->lock);
 
+    if (retval == 0) {
+        WakeOfflineAudioDevices();
+    }
+
     return retval;
 }
 
@@ -596,6 +740,42 @@ static void SDLCALL FreeAllocatedAudioBuffer(void *userdata, const void *buf, in
     SDL_free((void*) buf);
 }
 
+static void SDLCALL DontFreeThisAudioBuffer(void *userdata, const void *buf, int len)
+{
+    // We don't own the buffer, but know it will outlive the stream
+}
+
+// With SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN, the data goes into the queue's inbox without taking the stream lock,
+// so a thread reading from the stream never waits for this one. Returns 1 if the put needs the lock after all.
+static int PutAudioStreamDataLockFree(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const int serial = SDL_AtomicGet(&stream->producer_serial);
+
+    // Something changed since the last put (or this is the first one): take the lock once to see what.
+    if (serial != stream->producer_cached_serial) {
+        SDL_LockMutex(stream->lock);
+        stream->producer_cached_serial = SDL_AtomicGet(&stream->producer_serial);
+        SDL_copyp(&stream->producer_spec, &stream->src_spec);
+        stream->producer_lock_free = (stream->src_spec.format && stream->dst_spec.format && !stream->put_callback) ? SDL_TRUE : SDL_FALSE;
+        SDL_UnlockMutex(stream->lock);
+    }
+
+    if (!stream->producer_lock_free) {
+        return 1;
+    }
+
+    if ((len % SDL_AUDIO_FRAMESIZE(stream->producer_spec)) != 0) {
+        return SDL_SetError("Can't add partial sample frames");
+    }
+
+    if (SDL_WriteToAudioQueueInbox(stream->queue, &stream->producer_spec, (const Uint8 *)buf, len) < 0) {
+        return -1;
+    }
+
+    WakeOfflineAudioDevices();
+    return 0;
+}
+
 int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
 {
     if (!stream) {
@@ -608,6 +788,13 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
         return 0; // nothing to do.
     }
 
+    if (stream->props && SDL_GetBooleanProperty(stream->props, SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN, SDL_FALSE)) {
+        const int retval = PutAudioStreamDataLockFree(stream, buf, len);
+        if (retval <= 0) {
+            return retval;
+        }
+    }
+
     // When copying in large amounts of data, try and do as much work as possible
     // outside of the stream lock, otherwise the output device is likely to be starved.
     const int large_input_thresh = 64 * 1024;
@@ -634,6 +821,25 @@ int SDL_PutAudioStreamData(SDL_AudioStream *stream, const void *buf, int len)
     return PutAudioStreamBuffer(stream, buf, len, NULL, NULL);
 }
 
+int SDL_PutAudioStreamBuffer(SDL_AudioStream *stream, const void *buf, int len, SDL_ReleaseAudioBufferCallback callback, void *userdata)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        if (callback) {
+            callback(userdata, buf, len);  // nothing to do, so we're already done with it.
+        }
+        return 0;
+    }
+
+    // the queue reads straight out of `buf` until it's been consumed, then calls `callback`.
+    return PutAudioStreamBuffer(stream, buf, len, callback ? callback : DontFreeThisAudioBuffer, userdata);
+}
+
 int SDL_FlushAudioStream(SDL_AudioStream *stream)
 {
     if (!stream) {
@@ -641,10 +847,13 @@ int SDL_FlushAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_LockMutex(stream->lock);
+    const int retval = DrainAudioStreamInbox(stream);  // the flush goes after anything put without the lock.
     SDL_FlushAudioQueue(stream->queue);
     SDL_UnlockMutex(stream->lock);
 
-    return 0;
+    WakeOfflineAudioDevices();
+
+    return retval;
 }
 
 /* this does not save the previous contents of stream->work_buffer. It's a work buffer!!
@@ -697,7 +906,7 @@ static Sint64 NextAudioStreamIter(SDL_AudioStream* stream, void** inout_iter,
         // Past the end of the track, the right padding is filled with silence.
         // But we only want to do that if the track is actually finished (flushed).
         if (!flushed) {
-            output_frames -= SDL_GetResamplerPaddingFrames(resample_rate);
+            output_frames -= SDL_GetResamplerPaddingFrames(stream->resampling_quality, resample_rate);
         }
 
         output_frames = SDL_GetResamplerOutputFrames(output_frames, resample_rate, &resample_offset);
@@ -754,9 +963,20 @@ static Sint64 GetAudioStreamHead(SDL_AudioStream* stream, SDL_AudioSpec* out_spe
     return NextAudioStreamIter(stream, &iter, &resample_offset, out_spec, out_flushed);
 }
 
+// Adds float32 data to a mix buffer, the same way the audio device threads mix streams.
+static void MixFloat32AudioStreamData(void *mix_buffer, const void *src, int num_samples, float gain)
+{
+    if (SDL_MixAudio((Uint8 *) mix_buffer, (const Uint8 *) src, SDL_AUDIO_F32, (Uint32) (num_samples * sizeof (float)), gain) < 0) {
+        SDL_assert(!"This shouldn't happen.");
+    }
+}
+
 // You must hold stream->lock and validate your parameters before calling this!
 // Enough input data MUST be available!
-static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames)
+// If `mix_scratch` isn't NULL, the output is added to `buf` (which is float32 data in the output spec) instead of overwriting it.
+// `mix_scratch` must be able to hold `output_frames` in the output spec; output that can't be mixed in place is staged there.
+// If `resample_ns` isn't NULL, the time spent resampling is added to it.
+static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int output_frames, Uint8 *mix_scratch, Uint64 *resample_ns)
 {
     const SDL_AudioSpec* src_spec = &stream->input_spec;
     const SDL_AudioSpec* dst_spec = &stream->dst_spec;
@@ -770,6 +990,16 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     const int max_frame_size = CalculateMaxFrameSize(src_format, src_channels, dst_format, dst_channels);
     const Sint64 resample_rate = GetAudioStreamResampleRate(stream, src_spec->freq, stream->resample_offset);
 
+    // When mixing, the gain is applied as the data is added to the mix buffer, so it doesn't need a pass of its own.
+    // SDL_MixAudio treats a volume that rounds to zero (out of 128) as silence, though, so tiny gains are applied while converting.
+    const float gain = stream->gain;
+    const SDL_bool mix = (mix_scratch != NULL);
+    const SDL_bool gain_while_mixing = mix && ((gain == 0.0f) || (SDL_roundf(gain * 128.0f) != 0.0f));
+    const float convert_gain = gain_while_mixing ? 1.0f : gain;
+    const float mix_gain = gain_while_mixing ? gain : 1.0f;
+
+    SDL_assert(!mix || (dst_format == SDL_AUDIO_F32));
+
 #if DEBUG_AUDIOSTREAM
     SDL_Log("AUDIOSTREAM: asking for %d frames.", output_frames);
 #endif
@@ -778,10 +1008,11 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
     // Not resampling? It's an easy conversion (and maybe not even that!)
     if (resample_rate == 0) {
+        const SDL_bool convert = (src_format != dst_format) || (src_channels != dst_channels) || (convert_gain != 1.0f);
         Uint8* work_buffer = NULL;
 
         // Ensure we have enough scratch space for any conversions
-        if ((src_format != dst_format) || (src_channels != dst_channels)) {
+        if (convert) {
             work_buffer = EnsureAudioStreamWorkBufferSize(stream, output_frames * max_frame_size);
 
             if (!work_buffer) {
@@ -789,7 +1020,22 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
             }
         }
 
-        if (SDL_ReadFromAudioQueue(stream->queue, buf, dst_format, dst_channels, 0, output_frames, 0, work_buffer) != buf) {
+        if (mix) {
+            // If no conversion is needed, and the data doesn't straddle two chunks of the queue, this hands back
+            // a pointer into the queue, and we mix from there without copying it anywhere first.
+            const Uint8 *output_buffer = convert ?
+                SDL_ReadFromAudioQueue(stream->queue, mix_scratch, dst_format, dst_channels, 0, output_frames, 0, work_buffer, convert_gain) :
+                SDL_ReadFromAudioQueue(stream->queue, NULL, dst_format, dst_channels, 0, output_frames, 0, mix_scratch, 1.0f);
+
+            if (!output_buffer) {
+                return SDL_SetError("Not enough data in queue");
+            }
+
+            MixFloat32AudioStreamData(buf, output_buffer, output_frames * dst_channels, mix_gain);
+            return 0;
+        }
+
+        if (SDL_ReadFromAudioQueue(stream->queue, buf, dst_format, dst_channels, 0, output_frames, 0, work_buffer, gain) != buf) {
             return SDL_SetError("Not enough data in queue");
         }
 
@@ -803,7 +1049,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     // Infact, input_frames can sometimes even be zero when upsampling.
     const int input_frames = (int) SDL_GetResamplerInputFrames(output_frames, resample_rate, stream->resample_offset);
 
-    const int padding_frames = SDL_GetResamplerPaddingFrames(resample_rate);
+    const int padding_frames = SDL_GetResamplerPaddingFrames(stream->resampling_quality, resample_rate);
 
     const SDL_AudioFormat resample_format = SDL_AUDIO_F32;
 
@@ -832,7 +1078,8 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     // Check if we can resample directly into the output buffer.
     // Note, this is just to avoid extra copies.
     // Some other formats may fit directly into the output buffer, but i'd rather process data in a SIMD-aligned buffer.
-    if ((dst_format != resample_format) || (dst_channels != resample_channels)) {
+    // When mixing, the output buffer already holds data, so we resample into the mix scratch buffer instead.
+    if (!mix && ((dst_format != resample_format) || (dst_channels != resample_channels))) {
         // Allocate space for converting the resampled output to the destination format
         int resample_convert_bytes = output_frames * max_frame_size;
         work_buffer_capacity = SDL_max(work_buffer_capacity, resample_convert_bytes);
@@ -856,7 +1103,7 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
 
     const Uint8* input_buffer = SDL_ReadFromAudioQueue(stream->queue,
         NULL, resample_format, resample_channels,
-        padding_frames, input_frames, padding_frames, work_buffer);
+        padding_frames, input_frames, padding_frames, work_buffer, 1.0f);
 
     if (!input_buffer) {
         return SDL_SetError("Not enough data in queue (resample)");
@@ -865,41 +1112,51 @@ static int GetAudioStreamDataInternal(SDL_AudioStream *stream, void *buf, int ou
     input_buffer += padding_frames * resample_frame_size;
 
     // Decide where the resampled output goes
-    void* resample_buffer = (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : buf;
+    void* resample_buffer = mix ? mix_scratch : (resample_buffer_offset != -1) ? (work_buffer + resample_buffer_offset) : buf;
+
+    const Uint64 resample_start = resample_ns ? SDL_GetTicksNS() : 0;
 
     SDL_ResampleAudio(resample_channels,
                   (const float *) input_buffer, input_frames,
                   (float*) resample_buffer, output_frames,
-                  resample_rate, &stream->resample_offset);
+                  resample_rate, &stream->resample_offset,
+                  stream->resampling_quality, GetAudioStreamResamplerBank(stream, src_spec->freq));
+
+    if (resample_ns) {
+        *resample_ns += SDL_GetTicksNS() - resample_start;
+    }
 
-    // Convert to the final format, if necessary
-    ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, buf, dst_format, dst_channels, work_buffer);
+    if (mix) {
+        // Change the channel count in place, if necessary. The gain is usually left for the mix.
+        if ((dst_channels != resample_channels) || (convert_gain != 1.0f)) {
+            ConvertAudio(output_frames, mix_scratch, resample_format, resample_channels, mix_scratch, dst_format, dst_channels, NULL, convert_gain);
+        }
+
+        MixFloat32AudioStreamData(buf, mix_scratch, output_frames * dst_channels, mix_gain);
+        return 0;
+    }
+
+    // Convert to the final format (and apply the gain), if necessary
+    ConvertAudio(output_frames, resample_buffer, resample_format, resample_channels, buf, dst_format, dst_channels, work_buffer, gain);
 
     return 0;
 }
 
-// get converted/resampled data from the stream
-int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
+// You must validate your parameters before calling this! This locks the stream.
+// If `times` isn't NULL, the time spent processing (but not in the app's callback) is added to it, and
+// the number of frames left over is recorded for SDL_PROP_AUDIOSTREAM_DEVICE_QUEUED_FRAMES_NUMBER.
+static int GetAudioStreamData(SDL_AudioStream *stream, Uint8 *buf, int len, Uint8 *mix_scratch, SDL_AudioStreamTimes *times)
 {
-    Uint8 *buf = (Uint8 *) voidbuf;
-
-#if DEBUG_AUDIOSTREAM
-    SDL_Log("AUDIOSTREAM: want to get %d converted bytes", len);
-#endif
+    SDL_LockMutex(stream->lock);
 
-    if (!stream) {
-        return SDL_InvalidParamError("stream");
-    } else if (!buf) {
-        return SDL_InvalidParamError("buf");
-    } else if (len < 0) {
-        return SDL_InvalidParamError("len");
-    } else if (len == 0) {
-        return 0; // nothing to do.
+    if (CheckAudioStreamIsFullySetup(stream) != 0) {
+        SDL_UnlockMutex(stream->lock);
+        return -1;
     }
 
-    SDL_LockMutex(stream->lock);
+    UpdateAudioStreamResamplingQuality(stream);
 
-    if (CheckAudioStreamIsFullySetup(stream) != 0) {
+    if (DrainAudioStreamInbox(stream) != 0) {
         SDL_UnlockMutex(stream->lock);
         return -1;
     }
@@ -933,6 +1190,8 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
     // Process the data in chunks to avoid allocating too much memory (and potential integer overflows)
     const int chunk_size = 4096;
 
+    const Uint64 start = times ? SDL_GetTicksNS() : 0;
+    Uint64 resample_ns = 0;
     int total = 0;
 
     while (total < len) {
@@ -963,7 +1222,7 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         output_frames = SDL_min(output_frames, chunk_size);
         output_frames = (int) SDL_min(output_frames, available_frames);
 
-        if (GetAudioStreamDataInternal(stream, &buf[total], output_frames) != 0) {
+        if (GetAudioStreamDataInternal(stream, &buf[total], output_frames, mix_scratch, times ? &resample_ns : NULL) != 0) {
             total = total ? total : -1;
             break;
         }
@@ -971,6 +1230,20 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
         total += output_frames * dst_frame_size;
     }
 
+    // if we read the last of a buffer from SDL_PutAudioStreamBuffer, let the app have it back now, instead of on the next read.
+    SDL_ReleaseConsumedAudioQueueHead(stream->queue);
+
+    if ((total >= 0) && (total < len)) {
+        stream->short_reads++;
+    }
+
+    if (times) {
+        const Uint64 elapsed = SDL_GetTicksNS() - start;
+        times->resample_ns += resample_ns;
+        times->convert_ns += (elapsed > resample_ns) ? (elapsed - resample_ns) : 0;
+        stream->device_queued_frames = GetAudioStreamAvailableFrames(stream, NULL);
+    }
+
     SDL_UnlockMutex(stream->lock);
 
 #if DEBUG_AUDIOSTREAM
@@ -980,6 +1253,88 @@ int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
     return total;
 }
 
+// SDL_TRUE if reading `frames` output frames from the stream right now wouldn't come up short for lack of input:
+// it has a get callback to ask for more, has that much queued, or the app flushed it to say no more is coming.
+SDL_bool AudioStreamCanProvideFrames(SDL_AudioStream *stream, int frames)
+{
+    SDL_bool retval = SDL_FALSE;
+
+    SDL_LockMutex(stream->lock);
+
+    if (stream->get_callback) {
+        retval = SDL_TRUE;
+    } else if (stream->src_spec.format && stream->dst_spec.format) {  // don't set an error, this gets called over and over.
+        DrainAudioStreamInbox(stream);
+
+        void *iter = SDL_BeginAudioQueueIter(stream->queue);
+        Sint64 resample_offset = stream->resample_offset;
+        Sint64 output_frames = 0;
+        SDL_bool flushed = SDL_FALSE;
+
+        while (iter && (output_frames < frames)) {
+            output_frames += NextAudioStreamIter(stream, &iter, &resample_offset, NULL, &flushed);
+        }
+
+        retval = ((output_frames >= frames) || flushed) ? SDL_TRUE : SDL_FALSE;
+    }
+
+    SDL_UnlockMutex(stream->lock);
+
+    return retval;
+}
+
+// get converted/resampled data from the stream
+int SDL_GetAudioStreamData(SDL_AudioStream *stream, void *voidbuf, int len)
+{
+    Uint8 *buf = (Uint8 *) voidbuf;
+
+#if DEBUG_AUDIOSTREAM
+    SDL_Log("AUDIOSTREAM: want to get %d converted bytes", len);
+#endif
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len < 0) {
+        return SDL_InvalidParamError("len");
+    } else if (len == 0) {
+        return 0; // nothing to do.
+    }
+
+    return GetAudioStreamData(stream, buf, len, NULL, NULL);
+}
+
+// SDL_GetAudioStreamData for the audio device threads, which also keeps track of where the time went.
+int GetAudioStreamDataForDevice(SDL_AudioStream *stream, void *buf, int len, SDL_AudioStreamTimes *times)
+{
+    SDL_assert(stream != NULL);
+    SDL_assert(buf != NULL);
+    SDL_assert(len >= 0);
+
+    if (len == 0) {
+        return 0; // nothing to do.
+    }
+
+    return GetAudioStreamData(stream, (Uint8 *) buf, len, NULL, times);
+}
+
+// add converted/resampled data from the stream to a float32 mix buffer, with the stream's gain applied.
+// The stream's output format must be float32; the audio device threads make sure of this for bound streams.
+int MixAudioStreamData(SDL_AudioStream *stream, float *mix_buffer, int len, void *scratch, SDL_AudioStreamTimes *times)
+{
+    SDL_assert(stream != NULL);
+    SDL_assert(mix_buffer != NULL);
+    SDL_assert(scratch != NULL);
+    SDL_assert(len >= 0);
+
+    if (len == 0) {
+        return 0; // nothing to do.
+    }
+
+    return GetAudioStreamData(stream, (Uint8 *) mix_buffer, len, (Uint8 *) scratch, times);
+}
+
 // number of converted/resampled bytes available for output
 int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
 {
@@ -994,6 +1349,9 @@ int SDL_GetAudioStreamAvailable(SDL_AudioStream *stream)
         return 0;
     }
 
+    UpdateAudioStreamResamplingQuality(stream);
+    DrainAudioStreamInbox(stream);
+
     Sint64 count = GetAudioStreamAvailableFrames(stream, NULL);
 
     // convert from sample frames to bytes in destination format.
@@ -1014,6 +1372,7 @@ int SDL_GetAudioStreamQueued(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamInbox(stream);
     size_t total = SDL_GetAudioQueueQueued(stream->queue);
 
     SDL_UnlockMutex(stream->lock);
@@ -1030,6 +1389,7 @@ int SDL_ClearAudioStream(SDL_AudioStream *stream)
 
     SDL_LockMutex(stream->lock);
 
+    DrainAudioStreamInbox(stream);  // so the data put without the lock gets cleared, too.
     SDL_ClearAudioQueue(stream->queue);
     SDL_zero(stream->input_spec);
     stream->resample_offset = 0;
@@ -1059,17 +1419,13 @@ void SDL_DestroyAudioStream(SDL_AudioStream *stream)
     }
 
     SDL_aligned_free(stream->work_buffer);
+    SDL_DestroyResamplerFilterBank(stream->resampler_bank);
     SDL_DestroyAudioQueue(stream->queue);
     SDL_DestroyMutex(stream->lock);
 
     SDL_free(stream);
 }
 
-static void SDLCALL DontFreeThisAudioBuffer(void *userdata, const void *buf, int len)
-{
-    // We don't own the buffer, but know it will outlive the stream
-}
-
 int SDL_ConvertAudioSamples(const SDL_AudioSpec *src_spec, const Uint8 *src_data, int src_len,
                             const SDL_AudioSpec *dst_spec, Uint8 **dst_data, int *dst_len)
 {
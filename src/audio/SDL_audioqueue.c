@@ -50,11 +50,31 @@ struct SDL_AudioTrack
     size_t capacity;
 };
 
+// Data written to the inbox by a producer that doesn't hold the owner's lock. See SDL_WriteToAudioQueueInbox.
+typedef struct SDL_AudioInboxChunk SDL_AudioInboxChunk;
+
+struct SDL_AudioInboxChunk
+{
+    SDL_AudioInboxChunk *next;
+    SDL_AudioSpec spec;
+    size_t len;
+    size_t capacity;
+    // `capacity` bytes of audio data follow.
+};
+
 struct SDL_AudioQueue
 {
     SDL_AudioTrack *head;
     SDL_AudioTrack *tail;
 
+    // Chunks published by the producer, newest first. The producer pushes, the consumer takes the whole list at once.
+    void *inbox;
+    // Chunks the consumer is done with, newest first. The consumer pushes, the producer takes the whole list at once.
+    void *inbox_free;
+    // Chunks only the producer touches.
+    SDL_AudioInboxChunk *producer_free;
+    size_t producer_num_free;
+
     Uint8 *history_buffer;
     size_t history_length;
     size_t history_capacity;
@@ -137,10 +157,24 @@ static int ReserveMemoryPoolBlocks(SDL_MemoryPool *pool, size_t num_blocks)
     return 0;
 }
 
+static void FreeAudioInboxChunks(SDL_AudioInboxChunk *chunk)
+{
+    while (chunk) {
+        SDL_AudioInboxChunk *next = chunk->next;
+        SDL_free(chunk);
+        chunk = next;
+    }
+}
+
 void SDL_DestroyAudioQueue(SDL_AudioQueue *queue)
 {
     SDL_ClearAudioQueue(queue);
 
+    // Nothing can be writing to the inbox anymore, so anything left in it just gets thrown away.
+    FreeAudioInboxChunks((SDL_AudioInboxChunk *)SDL_AtomicSetPtr(&queue->inbox, NULL));
+    FreeAudioInboxChunks((SDL_AudioInboxChunk *)SDL_AtomicSetPtr(&queue->inbox_free, NULL));
+    FreeAudioInboxChunks(queue->producer_free);
+
     DestroyMemoryPool(&queue->track_pool);
     DestroyMemoryPool(&queue->chunk_pool);
     SDL_aligned_free(queue->history_buffer);
@@ -169,7 +203,9 @@ SDL_AudioQueue *SDL_CreateAudioQueue(size_t chunk_size)
 
 static void DestroyAudioTrack(SDL_AudioQueue *queue, SDL_AudioTrack *track)
 {
-    track->callback(track->userdata, track->data, (int)track->capacity);
+    if (track->callback) {  // NULL if SDL_ReleaseConsumedAudioQueueHead already released the data.
+        track->callback(track->userdata, track->data, (int)track->capacity);
+    }
 
     FreeMemoryPoolBlock(&queue->track_pool, track);
 }
@@ -310,6 +346,127 @@ static size_t WriteToAudioTrack(SDL_AudioTrack *track, const Uint8 *data, size_t
     return len;
 }
 
+// Push a chunk onto one of the lock-free lists. Only one thread may push to a given list, and the other side only ever
+// takes the whole list, so a chunk can't be popped and pushed again between our read and the swap (no ABA problem).
+static void PushAudioInboxChunk(void **list, SDL_AudioInboxChunk *chunk)
+{
+    void *head;
+
+    do {
+        head = SDL_AtomicGetPtr(list);
+        chunk->next = (SDL_AudioInboxChunk *)head;
+    } while (!SDL_AtomicCompareAndSwapPointer(list, head, chunk));
+}
+
+static void SDLCALL FreeAudioInboxChunk(void *userdata, const void *buf, int len)
+{
+    SDL_AudioQueue *queue = (SDL_AudioQueue *)userdata;
+    SDL_AudioInboxChunk *chunk = (SDL_AudioInboxChunk *)((Uint8 *)buf - sizeof(SDL_AudioInboxChunk));
+
+    if (chunk->capacity == queue->chunk_pool.block_size) {
+        PushAudioInboxChunk(&queue->inbox_free, chunk);  // give it back to the producer to reuse.
+    } else {
+        SDL_free(chunk);  // oversized chunks from large writes aren't worth keeping around.
+    }
+}
+
+static SDL_AudioInboxChunk *AllocAudioInboxChunk(SDL_AudioQueue *queue, size_t len)
+{
+    const size_t capacity = SDL_max(len, queue->chunk_pool.block_size);
+    SDL_AudioInboxChunk *chunk;
+
+    if (capacity == queue->chunk_pool.block_size) {
+        if (!queue->producer_free) {
+            queue->producer_free = (SDL_AudioInboxChunk *)SDL_AtomicSetPtr(&queue->inbox_free, NULL);
+            queue->producer_num_free = 0;
+            for (chunk = queue->producer_free; chunk; chunk = chunk->next) {
+                queue->producer_num_free++;
+            }
+        }
+
+        chunk = queue->producer_free;
+        if (chunk) {
+            queue->producer_free = chunk->next;
+            queue->producer_num_free--;
+            return chunk;
+        }
+    }
+
+    chunk = (SDL_AudioInboxChunk *)SDL_malloc(sizeof(SDL_AudioInboxChunk) + capacity);
+    if (chunk) {
+        chunk->capacity = capacity;
+    }
+    return chunk;
+}
+
+int SDL_WriteToAudioQueueInbox(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const Uint8 *data, size_t len)
+{
+    if (len == 0) {
+        return 0;
+    }
+
+    // A write that doesn't fit in a single chunk gets a chunk of its own, so it can be read back in one piece.
+    SDL_AudioInboxChunk *chunk = AllocAudioInboxChunk(queue, len);
+
+    if (!chunk) {
+        return -1;
+    }
+
+    SDL_copyp(&chunk->spec, spec);
+    chunk->len = len;
+    SDL_memcpy(chunk + 1, data, len);
+
+    // The compare-and-swap is a full barrier, so the consumer sees the data before it sees the chunk.
+    PushAudioInboxChunk(&queue->inbox, chunk);
+
+    // Don't hoard chunks the consumer has given back after a burst of writes.
+    while (queue->producer_num_free > (size_t)queue->chunk_pool.max_free) {
+        SDL_AudioInboxChunk *extra = queue->producer_free;
+        queue->producer_free = extra->next;
+        queue->producer_num_free--;
+        SDL_free(extra);
+    }
+
+    return 0;
+}
+
+int SDL_DrainAudioQueueInbox(SDL_AudioQueue *queue)
+{
+    if (!SDL_AtomicGetPtr(&queue->inbox)) {
+        return 0;  // the usual case: nothing new, and nothing to write to.
+    }
+
+    SDL_AudioInboxChunk *chunk = (SDL_AudioInboxChunk *)SDL_AtomicSetPtr(&queue->inbox, NULL);
+    SDL_AudioInboxChunk *fifo = NULL;
+
+    // The list is newest first; flip it so the data is queued in the order it was written.
+    while (chunk) {
+        SDL_AudioInboxChunk *next = chunk->next;
+        chunk->next = fifo;
+        fifo = chunk;
+        chunk = next;
+    }
+
+    int retval = 0;
+
+    for (chunk = fifo; chunk; chunk = fifo) {
+        fifo = chunk->next;
+
+        SDL_AudioTrack *track = SDL_CreateAudioTrack(queue, &chunk->spec, (Uint8 *)(chunk + 1), chunk->len, chunk->len, FreeAudioInboxChunk, queue);
+
+        if (!track) {
+            // Out of memory. The data is lost either way, but give the chunks back so they don't leak.
+            FreeAudioInboxChunk(queue, chunk + 1, (int)chunk->len);
+            retval = -1;
+            continue;
+        }
+
+        SDL_AddTrackToAudioQueue(queue, track);
+    }
+
+    return retval;
+}
+
 int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const Uint8 *data, size_t len)
 {
     if (len == 0) {
@@ -424,6 +581,10 @@ static void UpdateAudioQueueHistory(SDL_AudioQueue *queue,
     Uint8 *history_buffer = queue->history_buffer;
     size_t history_bytes = queue->history_length;
 
+    if (len == 0) {
+        return;  // nothing to add (and `data` might be NULL, if the track's data was already released).
+    }
+
     if (len >= history_bytes) {
         SDL_memcpy(history_buffer, &data[len - history_bytes], history_bytes);
     } else {
@@ -447,7 +608,9 @@ static const Uint8 *ReadFromAudioQueue(SDL_AudioQueue *queue, Uint8 *data, size_
 
     for (;;) {
         size_t avail = SDL_min(len - total, track->tail - track->head);
-        SDL_memcpy(&data[total], &track->data[track->head], avail);
+        if (avail) {
+            SDL_memcpy(&data[total], &track->data[track->head], avail);
+        }
         track->head += avail;
         total += avail;
 
@@ -489,7 +652,9 @@ static const Uint8 *PeekIntoAudioQueueFuture(SDL_AudioQueue *queue, Uint8 *data,
 
     for (;;) {
         size_t avail = SDL_min(len - total, track->tail - track->head);
-        SDL_memcpy(&data[total], &track->data[track->head], avail);
+        if (avail) {
+            SDL_memcpy(&data[total], &track->data[track->head], avail);
+        }
         total += avail;
 
         if (total == len) {
@@ -516,7 +681,7 @@ static const Uint8 *PeekIntoAudioQueueFuture(SDL_AudioQueue *queue, Uint8 *data,
 const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
                                     Uint8 *dst, SDL_AudioFormat dst_format, int dst_channels,
                                     int past_frames, int present_frames, int future_frames,
-                                    Uint8 *scratch)
+                                    Uint8 *scratch, float gain)
 {
     SDL_AudioTrack *track = queue->head;
 
@@ -538,7 +703,7 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
     size_t dst_present_bytes = present_frames * dst_frame_size;
     size_t dst_future_bytes = future_frames * dst_frame_size;
 
-    SDL_bool convert = (src_format != dst_format) || (src_channels != dst_channels);
+    SDL_bool convert = (src_format != dst_format) || (src_channels != dst_channels) || (gain != 1.0f);
 
     if (convert && !dst) {
         // The user didn't ask for the data to be copied, but we need to convert it, so store it in the scratch buffer
@@ -553,7 +718,7 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
         // Do we still need to copy/convert the data?
         if (dst) {
             ConvertAudio(past_frames + present_frames + future_frames, ptr,
-                         src_format, src_channels, dst, dst_format, dst_channels, scratch);
+                         src_format, src_channels, dst, dst_format, dst_channels, scratch, gain);
             ptr = dst;
         }
 
@@ -571,19 +736,19 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
     Uint8 *ptr = dst;
 
     if (src_past_bytes) {
-        ConvertAudio(past_frames, PeekIntoAudioQueuePast(queue, scratch, src_past_bytes), src_format, src_channels, dst, dst_format, dst_channels, scratch);
+        ConvertAudio(past_frames, PeekIntoAudioQueuePast(queue, scratch, src_past_bytes), src_format, src_channels, dst, dst_format, dst_channels, scratch, gain);
         dst += dst_past_bytes;
         scratch += dst_past_bytes;
     }
 
     if (src_present_bytes) {
-        ConvertAudio(present_frames, ReadFromAudioQueue(queue, scratch, src_present_bytes), src_format, src_channels, dst, dst_format, dst_channels, scratch);
+        ConvertAudio(present_frames, ReadFromAudioQueue(queue, scratch, src_present_bytes), src_format, src_channels, dst, dst_format, dst_channels, scratch, gain);
         dst += dst_present_bytes;
         scratch += dst_present_bytes;
     }
 
     if (src_future_bytes) {
-        ConvertAudio(future_frames, PeekIntoAudioQueueFuture(queue, scratch, src_future_bytes), src_format, src_channels, dst, dst_format, dst_channels, scratch);
+        ConvertAudio(future_frames, PeekIntoAudioQueueFuture(queue, scratch, src_future_bytes), src_format, src_channels, dst, dst_format, dst_channels, scratch, gain);
         dst += dst_future_bytes;
         scratch += dst_future_bytes;
     }
@@ -591,6 +756,34 @@ const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
     return ptr;
 }
 
+void SDL_ReleaseConsumedAudioQueueHead(SDL_AudioQueue *queue)
+{
+    SDL_AudioTrack *track = queue->head;
+
+    // A track with room left might still get more data written to it, so leave that alone.
+    if (!track || !track->callback || (track->head != track->tail) || (track->tail != track->capacity)) {
+        return;
+    }
+
+    // Resampling might still need the end of this data, so it goes into the history, like when a read moves past it.
+    UpdateAudioQueueHistory(queue, track->data, track->tail);
+
+    // If there's more data after this track, move on to it, just like a read would have.
+    if (track->next && !track->flushed) {
+        queue->head = track->next;
+        DestroyAudioTrack(queue, track);
+        return;
+    }
+
+    // Otherwise keep the track itself (it's the tail, or flushed), just without any data.
+    track->callback(track->userdata, track->data, (int)track->capacity);
+    track->callback = NULL;
+    track->data = NULL;
+    track->head = 0;
+    track->tail = 0;
+    track->capacity = 0;
+}
+
 size_t SDL_GetAudioQueueQueued(SDL_AudioQueue *queue)
 {
     size_t total = 0;
@@ -25,8 +25,6 @@
 
 // Internal functions used by SDL_AudioStream for queueing audio.
 
-typedef void(SDLCALL *SDL_ReleaseAudioBufferCallback)(void *userdata, const void *buffer, int buflen);
-
 typedef struct SDL_AudioQueue SDL_AudioQueue;
 typedef struct SDL_AudioTrack SDL_AudioTrack;
 
@@ -50,6 +48,14 @@ void SDL_PopAudioQueueHead(SDL_AudioQueue *queue);
 // REQUIRES: If the spec has changed, the last track must have been flushed
 int SDL_WriteToAudioQueue(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const Uint8 *data, size_t len);
 
+// Write data to the queue's inbox, without any locking.
+// Only one thread may write to the inbox at a time. The data isn't part of the queue until SDL_DrainAudioQueueInbox.
+int SDL_WriteToAudioQueueInbox(SDL_AudioQueue *queue, const SDL_AudioSpec *spec, const Uint8 *data, size_t len);
+
+// Move everything written to the inbox so far to the end of the queue.
+// This is the consumer side of the inbox: call it with the same lock held as for any other change to the queue.
+int SDL_DrainAudioQueueInbox(SDL_AudioQueue *queue);
+
 // Create a track where the input data is owned by the caller
 SDL_AudioTrack *SDL_CreateAudioTrack(SDL_AudioQueue *queue,
                                      const SDL_AudioSpec *spec, Uint8 *data, size_t len, size_t capacity,
@@ -69,7 +75,12 @@ size_t SDL_NextAudioQueueIter(SDL_AudioQueue *queue, void **inout_iter, SDL_Audi
 const Uint8 *SDL_ReadFromAudioQueue(SDL_AudioQueue *queue,
                                     Uint8 *dst, SDL_AudioFormat dst_format, int dst_channels,
                                     int past_frames, int present_frames, int future_frames,
-                                    Uint8 *scratch);
+                                    Uint8 *scratch, float gain);
+
+// Release the head track's data if it has all been read and no more can be written to it,
+// instead of waiting for a later read to move past it. Call this once you are done with any
+// pointers SDL_ReadFromAudioQueue returned, since they might point into that data.
+void SDL_ReleaseConsumedAudioQueueHead(SDL_AudioQueue *queue);
 
 // Get the total number of bytes currently queued
 size_t SDL_GetAudioQueueQueued(SDL_AudioQueue *queue);
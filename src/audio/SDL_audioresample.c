@@ -48,6 +48,26 @@
 #define RESAMPLER_FILTER_INTERP_BITS        (32 - RESAMPLER_BITS_PER_ZERO_CROSSING)
 #define RESAMPLER_FILTER_INTERP_RANGE       (1 << RESAMPLER_FILTER_INTERP_BITS)
 
+// SDL_AUDIO_RESAMPLING_HIGH uses a longer filter, with a window that attenuates its stopband more.
+#define RESAMPLER_HIGH_ZERO_CROSSINGS       16
+#define RESAMPLER_HIGH_SAMPLES_PER_FRAME    (RESAMPLER_HIGH_ZERO_CROSSINGS * 2)
+#define RESAMPLER_HIGH_MAX_PADDING_FRAMES   (RESAMPLER_HIGH_ZERO_CROSSINGS + 1)
+
+// Filter banks are only made for ratios with at most this many phases. 44100Hz <-> 48000Hz needs 160 (or 147).
+#define RESAMPLER_MAX_BANK_PHASES 512
+
+// Without a bank, SDL_AUDIO_RESAMPLING_HIGH interpolates linearly between this many precalculated phases of its filter.
+#define RESAMPLER_HIGH_TABLE_PHASES 512
+
+struct SDL_ResamplerFilterBank
+{
+    int zero_crossings;
+    int taps;               // zero_crossings * 2
+    int stride;             // floats per phase, padded to a multiple of 4 to keep every phase SIMD aligned.
+    int num_phases;
+    float *coefficients;    // num_phases + 1 rows of `stride` floats; the last is the next frame's phase 0.
+};
+
 // ResampleFrame is just a vector/matrix/matrix multiplication.
 // It performs cubic interpolation of the filter, then multiplies that with the input.
 // dst = [1, frac, frac^2, frac^3] * filter * src
@@ -68,6 +88,22 @@ typedef union Cubic
 
 } Cubic;
 
+static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
+
+// The first input frame sampled for a given srcpos (relative to `src - (RESAMPLER_ZERO_CROSSINGS - 1) * chans`)
+SDL_FORCE_INLINE int GetResamplerIndex(Sint64 srcpos)
+{
+    return (int)(Sint32)(srcpos >> 32);
+}
+
+// The filter to use for a given srcpos, and how far to interpolate between its points
+SDL_FORCE_INLINE const Cubic *GetResamplerFilter(Sint64 srcpos, float *frac)
+{
+    const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+    *frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+    return ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+}
+
 static void ResampleFrame_Generic(const float *src, float *dst, const Cubic *filter, float frac, int chans)
 {
     const float frac2 = frac * frac;
@@ -395,6 +431,626 @@ static void ResampleFrame_Generic_NEON(const float *src, float *dst, const Cubic
 }
 #endif
 
+// Resample whole blocks of output frames, instead of calling through a function pointer for each one.
+#define RESAMPLE_FRAMES(name)                                                                                                     \
+    static void ResampleFrames_##name(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans) \
+    {                                                                                                                             \
+        int i;                                                                                                                    \
+        for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {                                                  \
+            float frac;                                                                                                           \
+            const Cubic *filter = GetResamplerFilter(srcpos, &frac);                                                              \
+            ResampleFrame_##name(&src[GetResamplerIndex(srcpos) * chans], dst, filter, frac, chans);                             \
+        }                                                                                                                         \
+    }
+
+RESAMPLE_FRAMES(Generic)
+RESAMPLE_FRAMES(Mono)
+RESAMPLE_FRAMES(Stereo)
+#ifdef SDL_SSE_INTRINSICS
+RESAMPLE_FRAMES(Generic_SSE)
+#endif
+#ifdef SDL_NEON_INTRINSICS
+RESAMPLE_FRAMES(Generic_NEON)
+#endif
+
+#undef RESAMPLE_FRAMES
+
+// The AVX2 and AVX-512 versions work like the SSE one, but each 128-bit lane handles a different output frame.
+// They use the same transposed filter, and let the SSE version deal with any leftover frames.
+#if defined(SDL_SSE_INTRINSICS) && defined(SDL_AVX2_INTRINSICS)
+#define sdl_madd256_ps(a, b, c) _mm256_add_ps(a, _mm256_mul_ps(b, c)) // Not-so-fused multiply-add
+
+// Load 4 floats from each of two frames into the low and high lanes
+#define sdl_loadu2_m128(lo, hi) _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(lo)), _mm_loadu_ps(hi), 1)
+
+static void SDL_TARGETING("avx2") ResampleFrame2_AVX2(const float *src0, const float *src1, float *dst, const Cubic *filter0, const Cubic *filter1, float frac0, float frac1, int chans)
+{
+#if RESAMPLER_SAMPLES_PER_FRAME != 12
+#error Invalid samples per frame
+#endif
+
+    __m256 f0, f1, f2;
+
+    {
+        const __m256 fracs1 = _mm256_setr_ps(frac0, frac0, frac0, frac0, frac1, frac1, frac1, frac1);
+        const __m256 fracs2 = _mm256_mul_ps(fracs1, fracs1);
+        const __m256 fracs3 = _mm256_mul_ps(fracs1, fracs2);
+
+#define X(out)                                                                          \
+    out = sdl_loadu2_m128(filter0[0].v, filter1[0].v);                                  \
+    out = sdl_madd256_ps(out, fracs1, sdl_loadu2_m128(filter0[1].v, filter1[1].v));     \
+    out = sdl_madd256_ps(out, fracs2, sdl_loadu2_m128(filter0[2].v, filter1[2].v));     \
+    out = sdl_madd256_ps(out, fracs3, sdl_loadu2_m128(filter0[3].v, filter1[3].v));     \
+    filter0 += 4;                                                                       \
+    filter1 += 4
+
+        X(f0);
+        X(f1);
+        X(f2);
+
+#undef X
+    }
+
+    if (chans == 2) {
+        __m256 out0 = _mm256_mul_ps(sdl_loadu2_m128(src0 + 0, src1 + 0), _mm256_unpacklo_ps(f0, f0));
+        __m256 out1 = _mm256_mul_ps(sdl_loadu2_m128(src0 + 4, src1 + 4), _mm256_unpackhi_ps(f0, f0));
+        out0 = sdl_madd256_ps(out0, sdl_loadu2_m128(src0 + 8, src1 + 8), _mm256_unpacklo_ps(f1, f1));
+        out1 = sdl_madd256_ps(out1, sdl_loadu2_m128(src0 + 12, src1 + 12), _mm256_unpackhi_ps(f1, f1));
+        out0 = sdl_madd256_ps(out0, sdl_loadu2_m128(src0 + 16, src1 + 16), _mm256_unpacklo_ps(f2, f2));
+        out1 = sdl_madd256_ps(out1, sdl_loadu2_m128(src0 + 20, src1 + 20), _mm256_unpackhi_ps(f2, f2));
+
+        __m256 out = _mm256_add_ps(out0, out1);
+
+        // Add the lower and upper pairs of each lane together
+        out = _mm256_add_ps(out, _mm256_shuffle_ps(out, out, _MM_SHUFFLE(3, 2, 3, 2)));
+
+        // Pack both frames into the low lane, and store them
+        out = _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(out), _MM_SHUFFLE(3, 1, 2, 0)));
+        _mm_storeu_ps(dst, _mm256_castps256_ps128(out));
+        return;
+    }
+
+    if (chans == 1) {
+        __m256 out = _mm256_mul_ps(f0, sdl_loadu2_m128(src0 + 0, src1 + 0));
+        out = sdl_madd256_ps(out, f1, sdl_loadu2_m128(src0 + 4, src1 + 4));
+        out = sdl_madd256_ps(out, f2, sdl_loadu2_m128(src0 + 8, src1 + 8));
+
+        // Horizontal sum of each lane
+        out = _mm256_add_ps(out, _mm256_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1)));
+        out = _mm256_add_ps(out, _mm256_shuffle_ps(out, out, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        _mm_store_ss(dst + 0, _mm256_castps256_ps128(out));
+        _mm_store_ss(dst + 1, _mm256_extractf128_ps(out, 1));
+        return;
+    }
+
+    int chan = 0;
+
+    // Process 4 channels of both frames at once
+    for (; chan + 4 <= chans; chan += 4) {
+        const float *in0 = &src0[chan];
+        const float *in1 = &src1[chan];
+        __m256 out0 = _mm256_setzero_ps();
+        __m256 out1 = _mm256_setzero_ps();
+
+#define X(a, b, out)                                                                                             \
+    out = sdl_madd256_ps(out, sdl_loadu2_m128(in0, in1), _mm256_shuffle_ps(a, a, _MM_SHUFFLE(b, b, b, b)));     \
+    in0 += chans;                                                                                                \
+    in1 += chans
+
+#define Y(a)       \
+    X(a, 0, out0); \
+    X(a, 1, out1); \
+    X(a, 2, out0); \
+    X(a, 3, out1)
+
+        Y(f0);
+        Y(f1);
+        Y(f2);
+
+#undef X
+#undef Y
+
+        __m256 out = _mm256_add_ps(out0, out1);
+
+        _mm_storeu_ps(&dst[chan], _mm256_castps256_ps128(out));
+        _mm_storeu_ps(&dst[chans + chan], _mm256_extractf128_ps(out, 1));
+    }
+
+    // Gather the remaining channels one at a time; 4 samples of each frame.
+    if (chan < chans) {
+        const int offset = (int)(src1 - src0);
+        const __m256i indices = _mm256_setr_epi32(0, chans, chans * 2, chans * 3,
+                                                  offset, offset + chans, offset + chans * 2, offset + chans * 3);
+
+        for (; chan < chans; ++chan) {
+            const float *in = &src0[chan];
+
+            __m256 out = _mm256_mul_ps(f0, _mm256_i32gather_ps(in, indices, 4));
+            out = sdl_madd256_ps(out, f1, _mm256_i32gather_ps(in + chans * 4, indices, 4));
+            out = sdl_madd256_ps(out, f2, _mm256_i32gather_ps(in + chans * 8, indices, 4));
+
+            out = _mm256_add_ps(out, _mm256_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1)));
+            out = _mm256_add_ps(out, _mm256_shuffle_ps(out, out, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            _mm_store_ss(&dst[chan], _mm256_castps256_ps128(out));
+            _mm_store_ss(&dst[chans + chan], _mm256_extractf128_ps(out, 1));
+        }
+    }
+}
+
+static void SDL_TARGETING("avx2") ResampleFrames_AVX2(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i = 0;
+
+    for (; i + 2 <= outframes; i += 2, dst += chans * 2) {
+        float frac0, frac1;
+        const Cubic *filter0 = GetResamplerFilter(srcpos, &frac0);
+        const float *src0 = &src[GetResamplerIndex(srcpos) * chans];
+        srcpos += resample_rate;
+        const Cubic *filter1 = GetResamplerFilter(srcpos, &frac1);
+        const float *src1 = &src[GetResamplerIndex(srcpos) * chans];
+        srcpos += resample_rate;
+
+        ResampleFrame2_AVX2(src0, src1, dst, filter0, filter1, frac0, frac1, chans);
+    }
+
+    ResampleFrames_Generic_SSE(src, dst, outframes - i, srcpos, resample_rate, chans);
+}
+
+#undef sdl_loadu2_m128
+#undef sdl_madd256_ps
+#endif
+
+#if defined(SDL_SSE_INTRINSICS) && defined(SDL_AVX2_INTRINSICS) && defined(SDL_AVX512F_INTRINSICS)
+#define sdl_madd512_ps(a, b, c) _mm512_add_ps(a, _mm512_mul_ps(b, c)) // Not-so-fused multiply-add
+
+// Load 4 floats from each of four frames into the four lanes
+#define sdl_loadu4_m128(p0, p1, p2, p3)                                                                 \
+    _mm512_insertf32x4(_mm512_insertf32x4(_mm512_insertf32x4(_mm512_castps128_ps512(_mm_loadu_ps(p0)), \
+                                                             _mm_loadu_ps(p1), 1),                     \
+                                          _mm_loadu_ps(p2), 2),                                        \
+                       _mm_loadu_ps(p3), 3)
+
+// Store the low float (or pair of floats) of each lane to consecutive frames
+#define sdl_store4_ss(dst, stride, x)                                   \
+    _mm_store_ss((dst), _mm512_castps512_ps128(x));                     \
+    _mm_store_ss((dst) + (stride), _mm512_extractf32x4_ps(x, 1));       \
+    _mm_store_ss((dst) + (stride) * 2, _mm512_extractf32x4_ps(x, 2));   \
+    _mm_store_ss((dst) + (stride) * 3, _mm512_extractf32x4_ps(x, 3))
+
+static void SDL_TARGETING("avx512f") ResampleFrame4_AVX512F(const float *const *srcs, float *dst, const Cubic *const *filters, __m128 fracs, int chans)
+{
+#if RESAMPLER_SAMPLES_PER_FRAME != 12
+#error Invalid samples per frame
+#endif
+
+    const float *src0 = srcs[0];
+    const float *src1 = srcs[1];
+    const float *src2 = srcs[2];
+    const float *src3 = srcs[3];
+    __m512 f0, f1, f2;
+
+    {
+        const Cubic *filter0 = filters[0];
+        const Cubic *filter1 = filters[1];
+        const Cubic *filter2 = filters[2];
+        const Cubic *filter3 = filters[3];
+
+        const __m512 fracs1 = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3), _mm512_castps128_ps512(fracs));
+        const __m512 fracs2 = _mm512_mul_ps(fracs1, fracs1);
+        const __m512 fracs3 = _mm512_mul_ps(fracs1, fracs2);
+
+#define L(i) sdl_loadu4_m128(filter0[i].v, filter1[i].v, filter2[i].v, filter3[i].v)
+#define X(out)                                  \
+    out = L(0);                                 \
+    out = sdl_madd512_ps(out, fracs1, L(1));    \
+    out = sdl_madd512_ps(out, fracs2, L(2));    \
+    out = sdl_madd512_ps(out, fracs3, L(3));    \
+    filter0 += 4;                               \
+    filter1 += 4;                               \
+    filter2 += 4;                               \
+    filter3 += 4
+
+        X(f0);
+        X(f1);
+        X(f2);
+
+#undef X
+#undef L
+    }
+
+#define L(i) sdl_loadu4_m128(src0 + (i), src1 + (i), src2 + (i), src3 + (i))
+
+    if (chans == 2) {
+        __m512 out0 = _mm512_mul_ps(L(0), _mm512_unpacklo_ps(f0, f0));
+        __m512 out1 = _mm512_mul_ps(L(4), _mm512_unpackhi_ps(f0, f0));
+        out0 = sdl_madd512_ps(out0, L(8), _mm512_unpacklo_ps(f1, f1));
+        out1 = sdl_madd512_ps(out1, L(12), _mm512_unpackhi_ps(f1, f1));
+        out0 = sdl_madd512_ps(out0, L(16), _mm512_unpacklo_ps(f2, f2));
+        out1 = sdl_madd512_ps(out1, L(20), _mm512_unpackhi_ps(f2, f2));
+
+        __m512 out = _mm512_add_ps(out0, out1);
+
+        // Add the lower and upper pairs of each lane together
+        out = _mm512_add_ps(out, _mm512_shuffle_ps(out, out, _MM_SHUFFLE(3, 2, 3, 2)));
+
+        // Pack the four frames into the low 256 bits, and store them
+        out = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 1, 4, 5, 8, 9, 12, 13, 0, 1, 4, 5, 8, 9, 12, 13), out);
+        _mm256_storeu_ps(dst, _mm512_castps512_ps256(out));
+        return;
+    }
+
+    if (chans == 1) {
+        __m512 out = _mm512_mul_ps(f0, L(0));
+        out = sdl_madd512_ps(out, f1, L(4));
+        out = sdl_madd512_ps(out, f2, L(8));
+
+        // Horizontal sum of each lane
+        out = _mm512_add_ps(out, _mm512_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1)));
+        out = _mm512_add_ps(out, _mm512_shuffle_ps(out, out, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        // Pack the four frames together, and store them
+        out = _mm512_permutexvar_ps(_mm512_setr_epi32(0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12, 0, 4, 8, 12), out);
+        _mm_storeu_ps(dst, _mm512_castps512_ps128(out));
+        return;
+    }
+
+#undef L
+
+    int chan = 0;
+
+    // Process 4 channels of all four frames at once
+    for (; chan + 4 <= chans; chan += 4) {
+        const float *in0 = &src0[chan];
+        const float *in1 = &src1[chan];
+        const float *in2 = &src2[chan];
+        const float *in3 = &src3[chan];
+        __m512 out0 = _mm512_setzero_ps();
+        __m512 out1 = _mm512_setzero_ps();
+
+#define X(a, b, out)                                                                                                   \
+    out = sdl_madd512_ps(out, sdl_loadu4_m128(in0, in1, in2, in3), _mm512_shuffle_ps(a, a, _MM_SHUFFLE(b, b, b, b))); \
+    in0 += chans;                                                                                                      \
+    in1 += chans;                                                                                                      \
+    in2 += chans;                                                                                                      \
+    in3 += chans
+
+#define Y(a)       \
+    X(a, 0, out0); \
+    X(a, 1, out1); \
+    X(a, 2, out0); \
+    X(a, 3, out1)
+
+        Y(f0);
+        Y(f1);
+        Y(f2);
+
+#undef X
+#undef Y
+
+        __m512 out = _mm512_add_ps(out0, out1);
+
+        _mm_storeu_ps(&dst[chan], _mm512_castps512_ps128(out));
+        _mm_storeu_ps(&dst[chans + chan], _mm512_extractf32x4_ps(out, 1));
+        _mm_storeu_ps(&dst[chans * 2 + chan], _mm512_extractf32x4_ps(out, 2));
+        _mm_storeu_ps(&dst[chans * 3 + chan], _mm512_extractf32x4_ps(out, 3));
+    }
+
+    // Gather the remaining channels one at a time; 4 samples of each frame.
+    if (chan < chans) {
+        const int offset1 = (int)(src1 - src0);
+        const int offset2 = (int)(src2 - src0);
+        const int offset3 = (int)(src3 - src0);
+        const __m512i indices = _mm512_add_epi32(_mm512_setr_epi32(0, 0, 0, 0, offset1, offset1, offset1, offset1,
+                                                                   offset2, offset2, offset2, offset2, offset3, offset3, offset3, offset3),
+                                                 _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3),
+                                                                    _mm512_set1_epi32(chans)));
+
+        for (; chan < chans; ++chan) {
+            const float *in = &src0[chan];
+
+            __m512 out = _mm512_mul_ps(f0, _mm512_i32gather_ps(indices, in, 4));
+            out = sdl_madd512_ps(out, f1, _mm512_i32gather_ps(indices, in + chans * 4, 4));
+            out = sdl_madd512_ps(out, f2, _mm512_i32gather_ps(indices, in + chans * 8, 4));
+
+            out = _mm512_add_ps(out, _mm512_shuffle_ps(out, out, _MM_SHUFFLE(2, 3, 0, 1)));
+            out = _mm512_add_ps(out, _mm512_shuffle_ps(out, out, _MM_SHUFFLE(1, 0, 3, 2)));
+
+            sdl_store4_ss(&dst[chan], chans, out);
+        }
+    }
+}
+
+static void SDL_TARGETING("avx512f") ResampleFrames_AVX512F(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i = 0;
+
+    for (; i + 4 <= outframes; i += 4, dst += chans * 4) {
+        const float *srcs[4];
+        const Cubic *filters[4];
+        float fracs[4];
+        int j;
+
+        for (j = 0; j < 4; ++j, srcpos += resample_rate) {
+            filters[j] = GetResamplerFilter(srcpos, &fracs[j]);
+            srcs[j] = &src[GetResamplerIndex(srcpos) * chans];
+        }
+
+        ResampleFrame4_AVX512F(srcs, dst, filters, _mm_loadu_ps(fracs), chans);
+    }
+
+    ResampleFrames_AVX2(src, dst, outframes - i, srcpos, resample_rate, chans);
+}
+
+#undef sdl_store4_ss
+#undef sdl_loadu4_m128
+#undef sdl_madd512_ps
+#endif
+
+// SDL_AUDIO_RESAMPLING_LOW: plain linear interpolation between the two nearest input frames.
+static void ResampleFrames_Linear(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i, c;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const float *in = &src[GetResamplerIndex(srcpos) * chans];
+        const float frac = (float)(Uint32)(srcpos & 0xFFFFFFFF) * (1.0f / 4294967296.0f);
+
+        for (c = 0; c < chans; ++c) {
+            dst[c] = in[c] + (in[c + chans] - in[c]) * frac;
+        }
+    }
+}
+
+// Filter banks and the SDL_AUDIO_RESAMPLING_HIGH table store each phase of the filter as plain taps,
+// so resampling a frame is just a dot product of `taps` input frames with one row of coefficients.
+// They're only called from ResampleFrames_Bank_* and ResampleFrames_Interpolated_*, below, which inline them.
+typedef void (*ApplyResamplerFilterFunc)(const float *src, float *dst, const float *filter, int taps, int chans);
+
+SDL_FORCE_INLINE void ApplyResamplerFilter_Generic(const float *src, float *dst, const float *filter, int taps, int chans)
+{
+    int i, c;
+
+    if (chans == 1) {
+        float out = 0.0f;
+
+        for (i = 0; i < taps; ++i) {
+            out += filter[i] * src[i];
+        }
+
+        dst[0] = out;
+    } else if (chans == 2) {
+        float out0 = 0.0f;
+        float out1 = 0.0f;
+
+        for (i = 0; i < taps; ++i, src += 2) {
+            out0 += filter[i] * src[0];
+            out1 += filter[i] * src[1];
+        }
+
+        dst[0] = out0;
+        dst[1] = out1;
+    } else {
+        // Every filter has an even number of taps, so split them over two sums, to keep each one from waiting on the last.
+        for (c = 0; c < chans; ++c) {
+            float out0 = 0.0f;
+            float out1 = 0.0f;
+
+            for (i = 0; i < taps; i += 2) {
+                out0 += filter[i] * src[i * chans + c];
+                out1 += filter[i + 1] * src[(i + 1) * chans + c];
+            }
+
+            dst[c] = out0 + out1;
+        }
+    }
+}
+
+#ifdef SDL_SSE_INTRINSICS
+// The filter is always aligned, and its length is a multiple of 4.
+SDL_FORCE_INLINE void SDL_TARGETING("sse") ApplyResamplerFilter_SSE(const float *src, float *dst, const float *filter, int taps, int chans)
+{
+    int i, c;
+
+    if (chans == 1) {
+        __m128 out = _mm_setzero_ps();
+
+        for (i = 0; i < taps; i += 4) {
+            out = _mm_add_ps(out, _mm_mul_ps(_mm_load_ps(&filter[i]), _mm_loadu_ps(&src[i])));
+        }
+
+        out = _mm_add_ps(out, _mm_movehl_ps(out, out));
+        out = _mm_add_ss(out, _mm_shuffle_ps(out, out, _MM_SHUFFLE(1, 1, 1, 1)));
+        _mm_store_ss(dst, out);
+    } else if (chans == 2) {
+        __m128 out0 = _mm_setzero_ps();
+        __m128 out1 = _mm_setzero_ps();
+
+        // Each tap covers an interleaved pair of samples, so duplicate each coefficient: [f0, f0, f1, f1], [f2, f2, f3, f3]
+        for (i = 0; i < taps; i += 4, src += 8) {
+            const __m128 f = _mm_load_ps(&filter[i]);
+            out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_unpacklo_ps(f, f), _mm_loadu_ps(&src[0])));
+            out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_unpackhi_ps(f, f), _mm_loadu_ps(&src[4])));
+        }
+
+        out0 = _mm_add_ps(out0, out1);
+        out0 = _mm_add_ps(out0, _mm_movehl_ps(out0, out0));
+        _mm_storel_pi((__m64 *)dst, out0);
+    } else {
+        // Work on groups of 4 channels, summing 4 taps at a time in separate registers.
+        // If the channels don't divide evenly, the last group overlaps the one before it.
+        // With 3 channels, each load picks up a sample of the next frame too (the padding covers the last one), which is just ignored.
+        for (c = 0; c < chans; c += 4) {
+            const float *in = &src[SDL_max(SDL_min(c, chans - 4), 0)];
+            __m128 out0 = _mm_setzero_ps();
+            __m128 out1 = _mm_setzero_ps();
+            __m128 out2 = _mm_setzero_ps();
+            __m128 out3 = _mm_setzero_ps();
+
+            for (i = 0; i < taps; i += 4, in += chans * 4) {
+                out0 = _mm_add_ps(out0, _mm_mul_ps(_mm_set1_ps(filter[i + 0]), _mm_loadu_ps(&in[0 * chans])));
+                out1 = _mm_add_ps(out1, _mm_mul_ps(_mm_set1_ps(filter[i + 1]), _mm_loadu_ps(&in[1 * chans])));
+                out2 = _mm_add_ps(out2, _mm_mul_ps(_mm_set1_ps(filter[i + 2]), _mm_loadu_ps(&in[2 * chans])));
+                out3 = _mm_add_ps(out3, _mm_mul_ps(_mm_set1_ps(filter[i + 3]), _mm_loadu_ps(&in[3 * chans])));
+            }
+
+            out0 = _mm_add_ps(_mm_add_ps(out0, out1), _mm_add_ps(out2, out3));
+
+            if (chans == 3) {
+                _mm_storel_pi((__m64 *)dst, out0);
+                _mm_store_ss(&dst[2], _mm_movehl_ps(out0, out0));
+            } else {
+                _mm_storeu_ps(&dst[SDL_min(c, chans - 4)], out0);
+            }
+        }
+    }
+}
+#endif
+
+// The NEON filter bank kernels haven't been built or checked with testaudioresampler on ARM yet, so they're left out
+// unless SDL_NEON_AUDIO_RESAMPLERS is defined. The cubic NEON resampler doesn't depend on them.
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_AUDIO_RESAMPLERS)
+SDL_FORCE_INLINE void ApplyResamplerFilter_NEON(const float *src, float *dst, const float *filter, int taps, int chans)
+{
+    int i, c;
+
+    if (chans == 1) {
+        float32x4_t out = vdupq_n_f32(0.0f);
+        float32x2_t sum;
+
+        for (i = 0; i < taps; i += 4) {
+            out = vmlaq_f32(out, vld1q_f32(&filter[i]), vld1q_f32(&src[i]));
+        }
+
+        sum = vadd_f32(vget_low_f32(out), vget_high_f32(out));
+        sum = vpadd_f32(sum, sum);
+        vst1_lane_f32(dst, sum, 0);
+    } else if (chans == 2) {
+        float32x4_t out0 = vdupq_n_f32(0.0f);
+        float32x4_t out1 = vdupq_n_f32(0.0f);
+
+        for (i = 0; i < taps; i += 4, src += 8) {
+            const float32x4_t f = vld1q_f32(&filter[i]);
+            const float32x4x2_t ff = vzipq_f32(f, f);
+            out0 = vmlaq_f32(out0, ff.val[0], vld1q_f32(&src[0]));
+            out1 = vmlaq_f32(out1, ff.val[1], vld1q_f32(&src[4]));
+        }
+
+        out0 = vaddq_f32(out0, out1);
+        vst1_f32(dst, vadd_f32(vget_low_f32(out0), vget_high_f32(out0)));
+    } else {
+        // Same as the SSE version.
+        for (c = 0; c < chans; c += 4) {
+            const float *in = &src[SDL_max(SDL_min(c, chans - 4), 0)];
+            float32x4_t out0 = vdupq_n_f32(0.0f);
+            float32x4_t out1 = vdupq_n_f32(0.0f);
+            float32x4_t out2 = vdupq_n_f32(0.0f);
+            float32x4_t out3 = vdupq_n_f32(0.0f);
+
+            for (i = 0; i < taps; i += 4, in += chans * 4) {
+                out0 = vmlaq_n_f32(out0, vld1q_f32(&in[0 * chans]), filter[i + 0]);
+                out1 = vmlaq_n_f32(out1, vld1q_f32(&in[1 * chans]), filter[i + 1]);
+                out2 = vmlaq_n_f32(out2, vld1q_f32(&in[2 * chans]), filter[i + 2]);
+                out3 = vmlaq_n_f32(out3, vld1q_f32(&in[3 * chans]), filter[i + 3]);
+            }
+
+            out0 = vaddq_f32(vaddq_f32(out0, out1), vaddq_f32(out2, out3));
+
+            if (chans == 3) {
+                vst1_f32(dst, vget_low_f32(out0));
+                vst1q_lane_f32(&dst[2], out0, 2);
+            } else {
+                vst1q_f32(&dst[SDL_min(c, chans - 4)], out0);
+            }
+        }
+    }
+}
+#endif
+
+// For a fixed ratio, output frames only ever land on `num_phases` different positions between input frames,
+// so there's no need to interpolate the filter: round to the nearest phase and use its precomputed taps.
+// `src` is relative to `src - (bank->zero_crossings - 1) * chans`
+SDL_FORCE_INLINE void ResampleFramesWithBank(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans,
+                                             const SDL_ResamplerFilterBank *bank, int taps, ApplyResamplerFilterFunc apply)
+{
+    const Uint64 num_phases = (Uint64)bank->num_phases;
+    const float *coefficients = bank->coefficients;
+    const int stride = bank->stride;
+    int i;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        // Rounding up to the next frame uses the extra phase at the end, so the same input frames are used either way.
+        const int phase = (int)((((Uint64)(Uint32)(srcpos & 0xFFFFFFFF) * num_phases) + 0x80000000) >> 32);
+        apply(&src[GetResamplerIndex(srcpos) * chans], dst, &coefficients[phase * stride], taps, chans);
+    }
+}
+
+// SDL_AUDIO_RESAMPLING_HIGH, for ratios without a filter bank: the filter is precalculated at
+// RESAMPLER_HIGH_TABLE_PHASES (+1, for the end) points, and linearly interpolated in between.
+// Stored as Cubic only to keep each row aligned.
+#define RESAMPLER_HIGH_TABLE_BITS (32 - 9)
+SDL_COMPILE_TIME_ASSERT(resampler_high_table_phases, (1 << (32 - RESAMPLER_HIGH_TABLE_BITS)) == RESAMPLER_HIGH_TABLE_PHASES);
+static Cubic HighResamplerTable[RESAMPLER_HIGH_TABLE_PHASES + 1][RESAMPLER_HIGH_SAMPLES_PER_FRAME / 4];
+
+// `src` is relative to `src - (RESAMPLER_HIGH_ZERO_CROSSINGS - 1) * chans`
+SDL_FORCE_INLINE void ResampleFramesInterpolated(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans,
+                                                 ApplyResamplerFilterFunc apply)
+{
+    Cubic aligned_filter[RESAMPLER_HIGH_SAMPLES_PER_FRAME / 4];
+    float *filter = (float *)aligned_filter;
+    int i, j;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float frac = (float)(srcfraction & ((1 << RESAMPLER_HIGH_TABLE_BITS) - 1)) * (1.0f / (1 << RESAMPLER_HIGH_TABLE_BITS));
+        const float *row0 = (const float *)HighResamplerTable[srcfraction >> RESAMPLER_HIGH_TABLE_BITS];
+        const float *row1 = row0 + RESAMPLER_HIGH_SAMPLES_PER_FRAME;
+
+        for (j = 0; j < RESAMPLER_HIGH_SAMPLES_PER_FRAME; ++j) {
+            filter[j] = row0[j] + (row1[j] - row0[j]) * frac;
+        }
+
+        apply(&src[GetResamplerIndex(srcpos) * chans], dst, filter, RESAMPLER_HIGH_SAMPLES_PER_FRAME, chans);
+    }
+}
+
+typedef void (*ResampleFramesBankFunc)(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans, const SDL_ResamplerFilterBank *bank);
+typedef void (*ResampleFramesInterpolatedFunc)(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans);
+static ResampleFramesBankFunc ResampleFrames_Bank;
+static ResampleFramesInterpolatedFunc ResampleFrames_Interpolated;
+
+// The AVX2 and AVX-512 kernels interpolate the medium quality filter about as fast as a bank can apply it.
+static SDL_bool UseMediumResamplerBanks;
+
+// Like RESAMPLE_FRAMES, bind each kernel into whole blocks of frames, so the compiler can inline it.
+// A bank only ever has one of two filter lengths, so pass them as constants to let the kernels be unrolled.
+#define RESAMPLE_FRAMES_WITH_TAPS(name, target)                                                                                                               \
+    static void target ResampleFrames_Bank_##name(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans,               \
+                                                  const SDL_ResamplerFilterBank *bank)                                                                      \
+    {                                                                                                                                                         \
+        if (bank->taps == RESAMPLER_HIGH_SAMPLES_PER_FRAME) {                                                                                                 \
+            ResampleFramesWithBank(src, dst, outframes, srcpos, resample_rate, chans, bank, RESAMPLER_HIGH_SAMPLES_PER_FRAME, ApplyResamplerFilter_##name); \
+        } else {                                                                                                                                              \
+            SDL_assert(bank->taps == RESAMPLER_SAMPLES_PER_FRAME);                                                                                            \
+            ResampleFramesWithBank(src, dst, outframes, srcpos, resample_rate, chans, bank, RESAMPLER_SAMPLES_PER_FRAME, ApplyResamplerFilter_##name);      \
+        }                                                                                                                                                     \
+    }                                                                                                                                                         \
+    static void target ResampleFrames_Interpolated_##name(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)       \
+    {                                                                                                                                                         \
+        ResampleFramesInterpolated(src, dst, outframes, srcpos, resample_rate, chans, ApplyResamplerFilter_##name);                                          \
+    }
+
+RESAMPLE_FRAMES_WITH_TAPS(Generic, )
+#ifdef SDL_SSE_INTRINSICS
+RESAMPLE_FRAMES_WITH_TAPS(SSE, SDL_TARGETING("sse"))
+#endif
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_AUDIO_RESAMPLERS)
+RESAMPLE_FRAMES_WITH_TAPS(NEON, )
+#endif
+
+#undef RESAMPLE_FRAMES_WITH_TAPS
+
 // Calculate the cubic equation which passes through all four points.
 // https://en.wikipedia.org/wiki/Ordinary_least_squares
 // https://en.wikipedia.org/wiki/Polynomial_regression
@@ -451,8 +1107,6 @@ static float Sinc(float *table, int x, int y)
     return (s * y) / x;
 }
 
-static Cubic ResamplerFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
-
 static void GenerateResamplerFilter()
 {
     enum
@@ -513,8 +1167,52 @@ static void GenerateResamplerFilter()
     }
 }
 
-typedef void (*ResampleFrameFunc)(const float *src, float *dst, const Cubic *filter, float frac, int chans);
-static ResampleFrameFunc ResampleFrame[8];
+// A Kaiser-windowed sinc, `x` input frames away from its center, spanning `zero_crossings` on either side.
+static float WindowedSinc(double x, int zero_crossings, float beta, float bessel_beta)
+{
+    const double ratio = x / zero_crossings;
+
+    if (x == 0.0) {
+        return 1.0f;
+    } else if (ratio <= -1.0 || ratio >= 1.0) {
+        return 0.0f;
+    }
+
+    return (float)((BesselI0(beta * (float)SDL_sqrt(1.0 - ratio * ratio)) / bessel_beta) *
+                   (SDL_sin(SDL_PI_D * x) / (SDL_PI_D * x)));
+}
+
+// Fill in one phase of a filter, `frac` of the way between two input frames.
+static void GenerateResamplerFilterPhase(float *filter, double frac, int zero_crossings, float beta, float bessel_beta)
+{
+    int i;
+
+    for (i = 0; i < zero_crossings * 2; ++i) {
+        filter[i] = WindowedSinc((i - (zero_crossings - 1)) - frac, zero_crossings, beta, bessel_beta);
+    }
+}
+
+static float GetResamplerBeta(SDL_AudioResamplingQuality quality)
+{
+    // Same as GenerateResamplerFilter, but the high quality filter can afford a stronger stopband.
+    const float dB = (quality == SDL_AUDIO_RESAMPLING_HIGH) ? 100.0f : 80.0f;
+    return 0.1102f * (dB - 8.7f);
+}
+
+static void GenerateHighResamplerTable(void)
+{
+    const float beta = GetResamplerBeta(SDL_AUDIO_RESAMPLING_HIGH);
+    const float bessel_beta = BesselI0(beta);
+    int i;
+
+    for (i = 0; i <= RESAMPLER_HIGH_TABLE_PHASES; ++i) {
+        GenerateResamplerFilterPhase((float *)HighResamplerTable[i], (double)i / RESAMPLER_HIGH_TABLE_PHASES,
+                                     RESAMPLER_HIGH_ZERO_CROSSINGS, beta, bessel_beta);
+    }
+}
+
+typedef void (*ResampleFramesFunc)(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans);
+static ResampleFramesFunc ResampleFrames[8];
 
 // Transpose 4x4 floats
 static void Transpose4x4(Cubic *data)
@@ -536,30 +1234,56 @@ static void SetupAudioResampler(void)
     SDL_bool transpose = SDL_FALSE;
 
     GenerateResamplerFilter();
+    GenerateHighResamplerTable();
+
+    ResampleFrames_Bank = ResampleFrames_Bank_Generic;
+    ResampleFrames_Interpolated = ResampleFrames_Interpolated_Generic;
+    UseMediumResamplerBanks = SDL_TRUE;
 
 #ifdef SDL_SSE_INTRINSICS
     if (SDL_HasSSE()) {
+        ResampleFramesFunc func = ResampleFrames_Generic_SSE;
+#ifdef SDL_AVX2_INTRINSICS
+        if (SDL_HasAVX2()) {
+            func = ResampleFrames_AVX2;
+            UseMediumResamplerBanks = SDL_FALSE;
+        }
+#ifdef SDL_AVX512F_INTRINSICS
+        if (SDL_HasAVX2() && SDL_HasAVX512F()) {
+            func = ResampleFrames_AVX512F;
+        }
+#endif
+#endif
         for (i = 0; i < 8; ++i) {
-            ResampleFrame[i] = ResampleFrame_Generic_SSE;
+            ResampleFrames[i] = func;
         }
+        ResampleFrames_Bank = ResampleFrames_Bank_SSE;
+        ResampleFrames_Interpolated = ResampleFrames_Interpolated_SSE;
         transpose = SDL_TRUE;
     } else
 #endif
 #ifdef SDL_NEON_INTRINSICS
     if (SDL_HasNEON()) {
         for (i = 0; i < 8; ++i) {
-            ResampleFrame[i] = ResampleFrame_Generic_NEON;
+            ResampleFrames[i] = ResampleFrames_Generic_NEON;
         }
+#ifdef SDL_NEON_AUDIO_RESAMPLERS
+        ResampleFrames_Bank = ResampleFrames_Bank_NEON;
+        ResampleFrames_Interpolated = ResampleFrames_Interpolated_NEON;
+#else
+        // The scalar bank kernels are slower than the NEON cubic ones, so only the high tier uses them.
+        UseMediumResamplerBanks = SDL_FALSE;
+#endif
         transpose = SDL_TRUE;
     } else
 #endif
     {
         for (i = 0; i < 8; ++i) {
-            ResampleFrame[i] = ResampleFrame_Generic;
+            ResampleFrames[i] = ResampleFrames_Generic;
         }
 
-        ResampleFrame[0] = ResampleFrame_Mono;
-        ResampleFrame[1] = ResampleFrame_Stereo;
+        ResampleFrames[0] = ResampleFrames_Mono;
+        ResampleFrames[1] = ResampleFrames_Stereo;
     }
 
     if (transpose) {
@@ -576,10 +1300,10 @@ void SDL_SetupAudioResampler(void)
 {
     static SDL_SpinLock running = 0;
 
-    if (!ResampleFrame[0]) {
+    if (!ResampleFrames[0]) {
         SDL_LockSpinlock(&running);
 
-        if (!ResampleFrame[0]) {
+        if (!ResampleFrames[0]) {
             SetupAudioResampler();
         }
 
@@ -598,18 +1322,90 @@ Sint64 SDL_GetResampleRate(int src_rate, int dst_rate)
     return sample_rate;
 }
 
+SDL_ResamplerFilterBank *SDL_CreateResamplerFilterBank(SDL_AudioResamplingQuality quality, int src_rate, int dst_rate)
+{
+    SDL_ResamplerFilterBank *bank;
+    float beta, bessel_beta;
+    int a, b, i;
+
+    SDL_assert(src_rate > 0);
+    SDL_assert(dst_rate > 0);
+
+    if ((quality == SDL_AUDIO_RESAMPLING_LOW) || ((quality == SDL_AUDIO_RESAMPLING_MEDIUM) && !UseMediumResamplerBanks)) {
+        return NULL;
+    }
+
+    // Output frames repeat the same positions between input frames every dst_rate / gcd(src_rate, dst_rate) frames.
+    a = src_rate;
+    b = dst_rate;
+    while (b) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+
+    if ((dst_rate / a) > RESAMPLER_MAX_BANK_PHASES) {
+        return NULL;
+    }
+
+    bank = (SDL_ResamplerFilterBank *)SDL_malloc(sizeof(*bank));
+    if (!bank) {
+        return NULL;
+    }
+
+    bank->zero_crossings = (quality == SDL_AUDIO_RESAMPLING_HIGH) ? RESAMPLER_HIGH_ZERO_CROSSINGS : RESAMPLER_ZERO_CROSSINGS;
+    bank->taps = bank->zero_crossings * 2;
+    bank->stride = (bank->taps + 3) & ~3;
+    bank->num_phases = dst_rate / a;
+    bank->coefficients = (float *)SDL_aligned_alloc(SDL_GetSIMDAlignment(), (size_t)(bank->num_phases + 1) * bank->stride * sizeof(float));
+    if (!bank->coefficients) {
+        SDL_free(bank);
+        return NULL;
+    }
+
+    beta = GetResamplerBeta(quality);
+    bessel_beta = BesselI0(beta);
+
+    for (i = 0; i <= bank->num_phases; ++i) {
+        float *filter = &bank->coefficients[i * bank->stride];
+        GenerateResamplerFilterPhase(filter, (double)i / bank->num_phases, bank->zero_crossings, beta, bessel_beta);
+        SDL_memset(&filter[bank->taps], 0, (bank->stride - bank->taps) * sizeof(float));
+    }
+
+    return bank;
+}
+
+void SDL_DestroyResamplerFilterBank(SDL_ResamplerFilterBank *bank)
+{
+    if (bank) {
+        SDL_aligned_free(bank->coefficients);
+        SDL_free(bank);
+    }
+}
+
 int SDL_GetResamplerHistoryFrames(void)
 {
     // Even if we aren't currently resampling, make sure to keep enough history in case we need to later.
 
-    return RESAMPLER_MAX_PADDING_FRAMES;
+    return SDL_max(RESAMPLER_MAX_PADDING_FRAMES, RESAMPLER_HIGH_MAX_PADDING_FRAMES);
 }
 
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate)
+int SDL_GetResamplerPaddingFrames(SDL_AudioResamplingQuality quality, Sint64 resample_rate)
 {
     // This must always be <= SDL_GetResamplerHistoryFrames()
 
-    return resample_rate ? RESAMPLER_MAX_PADDING_FRAMES : 0;
+    if (!resample_rate) {
+        return 0;
+    }
+
+    switch (quality) {
+    case SDL_AUDIO_RESAMPLING_LOW:
+        return 1;
+    case SDL_AUDIO_RESAMPLING_HIGH:
+        return RESAMPLER_HIGH_MAX_PADDING_FRAMES;
+    default:
+        return RESAMPLER_MAX_PADDING_FRAMES;
+    }
 }
 
 // These are not general purpose. They do not check for all possible underflow/overflow
@@ -670,30 +1466,26 @@ Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, S
 }
 
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset)
+                       Sint64 resample_rate, Sint64 *inout_resample_offset,
+                       SDL_AudioResamplingQuality quality, const SDL_ResamplerFilterBank *bank)
 {
-    int i;
     Sint64 srcpos = *inout_resample_offset;
-    ResampleFrameFunc resample_frame = ResampleFrame[chans - 1];
 
     SDL_assert(resample_rate > 0);
-
-    src -= (RESAMPLER_ZERO_CROSSINGS - 1) * chans;
-
-    for (i = 0; i < outframes; ++i) {
-        int srcindex = (int)(Sint32)(srcpos >> 32);
-        Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
-        srcpos += resample_rate;
-
-        SDL_assert(srcindex >= -1 && srcindex < inframes);
-
-        const Cubic *filter = ResamplerFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
-        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
-
-        const float *frame = &src[srcindex * chans];
-        resample_frame(frame, dst, filter, frac, chans);
-
-        dst += chans;
+    SDL_assert(outframes <= 0 || GetResamplerIndex(srcpos) >= -1);
+    SDL_assert(outframes <= 0 || GetResamplerIndex(srcpos + (outframes - 1) * resample_rate) < inframes);
+
+    if (outframes > 0) {
+        if (quality == SDL_AUDIO_RESAMPLING_LOW) {
+            ResampleFrames_Linear(src, dst, outframes, srcpos, resample_rate, chans);
+        } else if (bank) {
+            ResampleFrames_Bank(src - (bank->zero_crossings - 1) * chans, dst, outframes, srcpos, resample_rate, chans, bank);
+        } else if (quality == SDL_AUDIO_RESAMPLING_HIGH) {
+            ResampleFrames_Interpolated(src - (RESAMPLER_HIGH_ZERO_CROSSINGS - 1) * chans, dst, outframes, srcpos, resample_rate, chans);
+        } else {
+            ResampleFrames[chans - 1](src - (RESAMPLER_ZERO_CROSSINGS - 1) * chans, dst, outframes, srcpos, resample_rate, chans);
+        }
+        srcpos += outframes * resample_rate;
     }
 
     *inout_resample_offset = srcpos - ((Sint64)inframes << 32);
@@ -28,16 +28,26 @@
 
 Sint64 SDL_GetResampleRate(int src_rate, int dst_rate);
 
+// A polyphase filter bank: the filter coefficients for every position an output frame can land on between two
+// input frames, precomputed for one exact ratio of sample rates.
+typedef struct SDL_ResamplerFilterBank SDL_ResamplerFilterBank;
+
+// Returns NULL if the ratio needs too many phases, or a bank wouldn't be any faster for `quality`; resample without one then.
+SDL_ResamplerFilterBank *SDL_CreateResamplerFilterBank(SDL_AudioResamplingQuality quality, int src_rate, int dst_rate);
+void SDL_DestroyResamplerFilterBank(SDL_ResamplerFilterBank *bank);
+
 int SDL_GetResamplerHistoryFrames(void);
-int SDL_GetResamplerPaddingFrames(Sint64 resample_rate);
+int SDL_GetResamplerPaddingFrames(SDL_AudioResamplingQuality quality, Sint64 resample_rate);
 
 Sint64 SDL_GetResamplerInputFrames(Sint64 output_frames, Sint64 resample_rate, Sint64 resample_offset);
 Sint64 SDL_GetResamplerOutputFrames(Sint64 input_frames, Sint64 resample_rate, Sint64 *inout_resample_offset);
 
 // Resample some audio.
 // REQUIRES: `inframes >= SDL_GetResamplerInputFrames(outframes)`
-// REQUIRES: At least `SDL_GetResamplerPaddingFrames(...)` extra frames to the left of src, and right of src+inframes
+// REQUIRES: At least `SDL_GetResamplerPaddingFrames(quality, ...)` extra frames to the left of src, and right of src+inframes
+// `bank` is optional, but if given, it must have been created with `quality` and the rates `resample_rate` came from.
 void SDL_ResampleAudio(int chans, const float *src, int inframes, float *dst, int outframes,
-                       Sint64 resample_rate, Sint64 *inout_resample_offset);
+                       Sint64 resample_rate, Sint64 *inout_resample_offset,
+                       SDL_AudioResamplingQuality quality, const SDL_ResamplerFilterBank *bank);
 
 #endif // SDL_audioresample_h_
@@ -921,5 +921,7 @@ void SDL_ChooseAudioConverters(void)
 
 #undef SET_CONVERTER_FUNCS
 
+    SDL_ChooseAudioMixers();
+
     converters_chosen = SDL_TRUE;
 }
@@ -82,10 +82,359 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(type, s, v) ((s) = (type)(((s) * (v)) / MIX_MAXVOLUME))
 #define ADJUST_VOLUME_U8(s, v)    ((s) = (Uint8)(((((s) - 128) * (v)) / MIX_MAXVOLUME) + 128))
 
-// !!! FIXME: This needs some SIMD magic.
-// !!! FIXME: Add fast-path for volume = 1
 // !!! FIXME: Use larger scales for 16-bit/32-bit integers
 
+/* The SIMD mixers only handle native-endian S16, S32 and F32, which is what the audio
+   device thread and most apps use. They give exactly the same results as the scalar
+   code below; integer mixers only take volumes up to MIX_MAXVOLUME, since the scalar
+   code wraps around above that instead of clamping. */
+
+// Scalar mixing of the samples left over at the end of the SIMD loops.
+static void MixAudio_S16_Tail(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+        const int sample = (((int)src[i] * volume) / MIX_MAXVOLUME) + dst[i];
+        dst[i] = (Sint16)SDL_clamp(sample, SDL_MIN_SINT16, SDL_MAX_SINT16);
+    }
+}
+
+static void MixAudio_S32_Tail(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+        const Sint64 sample = (((Sint64)src[i] * volume) / MIX_MAXVOLUME) + dst[i];
+        dst[i] = (Sint32)SDL_clamp(sample, SDL_MIN_SINT32, SDL_MAX_SINT32);
+    }
+}
+
+static void MixAudio_F32_Tail(float *dst, const float *src, int num_samples, float volume)
+{
+    int i;
+    for (i = 0; i < num_samples; ++i) {
+        const float sample = (src[i] * volume) + dst[i];
+        if (sample > 1.0f) {
+            dst[i] = 1.0f;
+        } else if (sample < -1.0f) {
+            dst[i] = -1.0f;
+        } else {
+            dst[i] = sample;
+        }
+    }
+}
+
+#ifdef SDL_SSE2_INTRINSICS
+// Saturating 32-bit add: if the sign of the sum differs from both inputs, it overflowed.
+#define sdl_adds_epi32(a, b, sum)                                                                       \
+    sum = _mm_add_epi32(a, b);                                                                          \
+    {                                                                                                   \
+        const __m128i overflow = _mm_srai_epi32(_mm_and_si128(_mm_xor_si128(a, sum), _mm_xor_si128(b, sum)), 31); \
+        const __m128i saturated = _mm_xor_si128(_mm_srai_epi32(a, 31), _mm_set1_epi32(SDL_MAX_SINT32)); \
+        sum = _mm_or_si128(_mm_andnot_si128(overflow, sum), _mm_and_si128(overflow, saturated));        \
+    }
+
+static void SDL_TARGETING("sse2") MixAudio_S16_SSE2(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    int i = 0;
+
+    if (volume == MIX_MAXVOLUME) {
+        for (; i + 8 <= num_samples; i += 8) {
+            const __m128i sum = _mm_adds_epi16(_mm_loadu_si128((const __m128i *)&src[i]), _mm_loadu_si128((const __m128i *)&dst[i]));
+            _mm_storeu_si128((__m128i *)&dst[i], sum);
+        }
+    } else {
+        const __m128i vol = _mm_set1_epi16((Sint16)volume);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            const __m128i samples = _mm_loadu_si128((const __m128i *)&src[i]);
+            const __m128i lo = _mm_mullo_epi16(samples, vol);
+            const __m128i hi = _mm_mulhi_epi16(samples, vol);
+            __m128i p0 = _mm_unpacklo_epi16(lo, hi);
+            __m128i p1 = _mm_unpackhi_epi16(lo, hi);
+
+            // Divide by MIX_MAXVOLUME, rounding towards zero like C does
+            p0 = _mm_srai_epi32(_mm_add_epi32(p0, _mm_srli_epi32(_mm_srai_epi32(p0, 31), 25)), 7);
+            p1 = _mm_srai_epi32(_mm_add_epi32(p1, _mm_srli_epi32(_mm_srai_epi32(p1, 31), 25)), 7);
+
+            const __m128i sum = _mm_adds_epi16(_mm_packs_epi32(p0, p1), _mm_loadu_si128((const __m128i *)&dst[i]));
+            _mm_storeu_si128((__m128i *)&dst[i], sum);
+        }
+    }
+
+    MixAudio_S16_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+static void SDL_TARGETING("sse2") MixAudio_S32_SSE2(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    int i = 0;
+
+    if (volume == MIX_MAXVOLUME) {
+        for (; i + 4 <= num_samples; i += 4) {
+            const __m128i a = _mm_loadu_si128((const __m128i *)&src[i]);
+            const __m128i b = _mm_loadu_si128((const __m128i *)&dst[i]);
+            __m128i sum;
+            sdl_adds_epi32(a, b, sum);
+            _mm_storeu_si128((__m128i *)&dst[i], sum);
+        }
+    } else {
+        // sample * volume needs up to 39 bits, which a double holds exactly
+        const __m128d vol = _mm_set1_pd((double)volume / MIX_MAXVOLUME);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            const __m128i samples = _mm_loadu_si128((const __m128i *)&src[i]);
+            const __m128i r0 = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(samples), vol));
+            const __m128i r1 = _mm_cvttpd_epi32(_mm_mul_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(samples, _MM_SHUFFLE(1, 0, 3, 2))), vol));
+            const __m128i a = _mm_unpacklo_epi64(r0, r1);
+            const __m128i b = _mm_loadu_si128((const __m128i *)&dst[i]);
+            __m128i sum;
+            sdl_adds_epi32(a, b, sum);
+            _mm_storeu_si128((__m128i *)&dst[i], sum);
+        }
+    }
+
+    MixAudio_S32_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+static void SDL_TARGETING("sse2") MixAudio_F32_SSE2(float *dst, const float *src, int num_samples, float volume)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minus_one = _mm_set1_ps(-1.0f);
+    int i = 0;
+
+    // max/min return the second operand for NaN, so keep the sum there to let NaN through like the scalar code.
+    if (volume == 1.0f) {
+        for (; i + 4 <= num_samples; i += 4) {
+            const __m128 sum = _mm_add_ps(_mm_loadu_ps(&src[i]), _mm_loadu_ps(&dst[i]));
+            _mm_storeu_ps(&dst[i], _mm_min_ps(one, _mm_max_ps(minus_one, sum)));
+        }
+    } else {
+        const __m128 vol = _mm_set1_ps(volume);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            const __m128 sum = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&src[i]), vol), _mm_loadu_ps(&dst[i]));
+            _mm_storeu_ps(&dst[i], _mm_min_ps(one, _mm_max_ps(minus_one, sum)));
+        }
+    }
+
+    MixAudio_F32_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+#undef sdl_adds_epi32
+#endif
+
+#ifdef SDL_AVX2_INTRINSICS
+#define sdl_adds_epi32(a, b, sum)                                                                                          \
+    sum = _mm256_add_epi32(a, b);                                                                                          \
+    {                                                                                                                      \
+        const __m256i overflow = _mm256_srai_epi32(_mm256_and_si256(_mm256_xor_si256(a, sum), _mm256_xor_si256(b, sum)), 31); \
+        const __m256i saturated = _mm256_xor_si256(_mm256_srai_epi32(a, 31), _mm256_set1_epi32(SDL_MAX_SINT32));          \
+        sum = _mm256_blendv_epi8(sum, saturated, overflow);                                                                \
+    }
+
+static void SDL_TARGETING("avx2") MixAudio_S16_AVX2(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    int i = 0;
+
+    if (volume == MIX_MAXVOLUME) {
+        for (; i + 16 <= num_samples; i += 16) {
+            const __m256i sum = _mm256_adds_epi16(_mm256_loadu_si256((const __m256i *)&src[i]), _mm256_loadu_si256((const __m256i *)&dst[i]));
+            _mm256_storeu_si256((__m256i *)&dst[i], sum);
+        }
+    } else {
+        const __m256i vol = _mm256_set1_epi16((Sint16)volume);
+
+        for (; i + 16 <= num_samples; i += 16) {
+            const __m256i samples = _mm256_loadu_si256((const __m256i *)&src[i]);
+            const __m256i lo = _mm256_mullo_epi16(samples, vol);
+            const __m256i hi = _mm256_mulhi_epi16(samples, vol);
+            __m256i p0 = _mm256_unpacklo_epi16(lo, hi);
+            __m256i p1 = _mm256_unpackhi_epi16(lo, hi);
+
+            // Divide by MIX_MAXVOLUME, rounding towards zero like C does
+            p0 = _mm256_srai_epi32(_mm256_add_epi32(p0, _mm256_srli_epi32(_mm256_srai_epi32(p0, 31), 25)), 7);
+            p1 = _mm256_srai_epi32(_mm256_add_epi32(p1, _mm256_srli_epi32(_mm256_srai_epi32(p1, 31), 25)), 7);
+
+            // unpack and pack both work within 128-bit lanes, so the samples end up back in order
+            const __m256i sum = _mm256_adds_epi16(_mm256_packs_epi32(p0, p1), _mm256_loadu_si256((const __m256i *)&dst[i]));
+            _mm256_storeu_si256((__m256i *)&dst[i], sum);
+        }
+    }
+
+    MixAudio_S16_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+static void SDL_TARGETING("avx2") MixAudio_S32_AVX2(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    int i = 0;
+
+    if (volume == MIX_MAXVOLUME) {
+        for (; i + 8 <= num_samples; i += 8) {
+            const __m256i a = _mm256_loadu_si256((const __m256i *)&src[i]);
+            const __m256i b = _mm256_loadu_si256((const __m256i *)&dst[i]);
+            __m256i sum;
+            sdl_adds_epi32(a, b, sum);
+            _mm256_storeu_si256((__m256i *)&dst[i], sum);
+        }
+    } else {
+        // sample * volume needs up to 39 bits, which a double holds exactly
+        const __m256d vol = _mm256_set1_pd((double)volume / MIX_MAXVOLUME);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            const __m128i r0 = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)&src[i])), vol));
+            const __m128i r1 = _mm256_cvttpd_epi32(_mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)&src[i + 4])), vol));
+            const __m256i a = _mm256_inserti128_si256(_mm256_castsi128_si256(r0), r1, 1);
+            const __m256i b = _mm256_loadu_si256((const __m256i *)&dst[i]);
+            __m256i sum;
+            sdl_adds_epi32(a, b, sum);
+            _mm256_storeu_si256((__m256i *)&dst[i], sum);
+        }
+    }
+
+    MixAudio_S32_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+static void SDL_TARGETING("avx2") MixAudio_F32_AVX2(float *dst, const float *src, int num_samples, float volume)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minus_one = _mm256_set1_ps(-1.0f);
+    int i = 0;
+
+    // max/min return the second operand for NaN, so keep the sum there to let NaN through like the scalar code.
+    if (volume == 1.0f) {
+        for (; i + 8 <= num_samples; i += 8) {
+            const __m256 sum = _mm256_add_ps(_mm256_loadu_ps(&src[i]), _mm256_loadu_ps(&dst[i]));
+            _mm256_storeu_ps(&dst[i], _mm256_min_ps(one, _mm256_max_ps(minus_one, sum)));
+        }
+    } else {
+        const __m256 vol = _mm256_set1_ps(volume);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            const __m256 sum = _mm256_add_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[i]), vol), _mm256_loadu_ps(&dst[i]));
+            _mm256_storeu_ps(&dst[i], _mm256_min_ps(one, _mm256_max_ps(minus_one, sum)));
+        }
+    }
+
+    MixAudio_F32_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+#undef sdl_adds_epi32
+#endif
+
+// The NEON mixers haven't been built or checked with audio_mixAudio on ARM yet, so they're left out unless SDL_NEON_AUDIO_MIXERS is defined.
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_AUDIO_MIXERS)
+static void MixAudio_S16_NEON(Sint16 *dst, const Sint16 *src, int num_samples, int volume)
+{
+    int i = 0;
+
+    if (volume == MIX_MAXVOLUME) {
+        for (; i + 8 <= num_samples; i += 8) {
+            vst1q_s16(&dst[i], vqaddq_s16(vld1q_s16(&src[i]), vld1q_s16(&dst[i])));
+        }
+    } else {
+        const int16x4_t vol = vdup_n_s16((Sint16)volume);
+
+        for (; i + 8 <= num_samples; i += 8) {
+            const int16x8_t samples = vld1q_s16(&src[i]);
+            int32x4_t p0 = vmull_s16(vget_low_s16(samples), vol);
+            int32x4_t p1 = vmull_s16(vget_high_s16(samples), vol);
+
+            // Divide by MIX_MAXVOLUME, rounding towards zero like C does
+            p0 = vshrq_n_s32(vaddq_s32(p0, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(p0, 31)), 25))), 7);
+            p1 = vshrq_n_s32(vaddq_s32(p1, vreinterpretq_s32_u32(vshrq_n_u32(vreinterpretq_u32_s32(vshrq_n_s32(p1, 31)), 25))), 7);
+
+            vst1q_s16(&dst[i], vqaddq_s16(vcombine_s16(vqmovn_s32(p0), vqmovn_s32(p1)), vld1q_s16(&dst[i])));
+        }
+    }
+
+    MixAudio_S16_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+static void MixAudio_S32_NEON(Sint32 *dst, const Sint32 *src, int num_samples, int volume)
+{
+    int i = 0;
+
+    if (volume == MIX_MAXVOLUME) {
+        for (; i + 4 <= num_samples; i += 4) {
+            vst1q_s32(&dst[i], vqaddq_s32(vld1q_s32(&src[i]), vld1q_s32(&dst[i])));
+        }
+    } else {
+        const int32x2_t vol = vdup_n_s32(volume);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            const int32x4_t samples = vld1q_s32(&src[i]);
+            int64x2_t p0 = vmull_s32(vget_low_s32(samples), vol);
+            int64x2_t p1 = vmull_s32(vget_high_s32(samples), vol);
+
+            // Divide by MIX_MAXVOLUME, rounding towards zero like C does
+            p0 = vshrq_n_s64(vaddq_s64(p0, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(p0, 63)), 57))), 7);
+            p1 = vshrq_n_s64(vaddq_s64(p1, vreinterpretq_s64_u64(vshrq_n_u64(vreinterpretq_u64_s64(vshrq_n_s64(p1, 63)), 57))), 7);
+
+            vst1q_s32(&dst[i], vqaddq_s32(vcombine_s32(vmovn_s64(p0), vmovn_s64(p1)), vld1q_s32(&dst[i])));
+        }
+    }
+
+    MixAudio_S32_Tail(dst + i, src + i, num_samples - i, volume);
+}
+
+static void MixAudio_F32_NEON(float *dst, const float *src, int num_samples, float volume)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+    int i = 0;
+
+    // NEON min/max return NaN if either operand is NaN, like the scalar code.
+    if (volume == 1.0f) {
+        for (; i + 4 <= num_samples; i += 4) {
+            const float32x4_t sum = vaddq_f32(vld1q_f32(&src[i]), vld1q_f32(&dst[i]));
+            vst1q_f32(&dst[i], vminq_f32(one, vmaxq_f32(minus_one, sum)));
+        }
+    } else {
+        const float32x4_t vol = vdupq_n_f32(volume);
+
+        for (; i + 4 <= num_samples; i += 4) {
+            const float32x4_t sum = vaddq_f32(vmulq_f32(vld1q_f32(&src[i]), vol), vld1q_f32(&dst[i]));
+            vst1q_f32(&dst[i], vminq_f32(one, vmaxq_f32(minus_one, sum)));
+        }
+    }
+
+    MixAudio_F32_Tail(dst + i, src + i, num_samples - i, volume);
+}
+#endif
+
+static void (*MixAudio_S16)(Sint16 *dst, const Sint16 *src, int num_samples, int volume) = NULL;
+static void (*MixAudio_S32)(Sint32 *dst, const Sint32 *src, int num_samples, int volume) = NULL;
+static void (*MixAudio_F32)(float *dst, const float *src, int num_samples, float volume) = NULL;
+
+// Called once by SDL_ChooseAudioConverters(). Until then, SDL_MixAudio uses the scalar code.
+void SDL_ChooseAudioMixers(void)
+{
+#define SET_MIXER_FUNCS(fntype)             \
+    MixAudio_S16 = MixAudio_S16_##fntype;   \
+    MixAudio_S32 = MixAudio_S32_##fntype;   \
+    MixAudio_F32 = MixAudio_F32_##fntype;
+
+#ifdef SDL_AVX2_INTRINSICS
+    if (SDL_HasAVX2()) {
+        SET_MIXER_FUNCS(AVX2);
+    } else
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+    if (SDL_HasSSE2()) {
+        SET_MIXER_FUNCS(SSE2);
+    } else
+#endif
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_AUDIO_MIXERS)
+    if (SDL_HasNEON()) {
+        SET_MIXER_FUNCS(NEON);
+    } else
+#endif
+    {
+        // No SIMD; the scalar code in SDL_MixAudio handles everything.
+    }
+
+#undef SET_MIXER_FUNCS
+}
+
 int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
                  Uint32 len, float fvolume)
 {
@@ -95,6 +444,17 @@ int SDL_MixAudio(Uint8 *dst, const Uint8 *src, SDL_AudioFormat format,
         return 0;
     }
 
+    if (format == SDL_AUDIO_F32 && MixAudio_F32) {
+        MixAudio_F32((float *)dst, (const float *)src, (int)(len / sizeof(float)), fvolume);
+        return 0;
+    } else if (format == SDL_AUDIO_S16 && MixAudio_S16 && volume <= MIX_MAXVOLUME) {
+        MixAudio_S16((Sint16 *)dst, (const Sint16 *)src, (int)(len / sizeof(Sint16)), volume);
+        return 0;
+    } else if (format == SDL_AUDIO_S32 && MixAudio_S32 && volume <= MIX_MAXVOLUME) {
+        MixAudio_S32((Sint32 *)dst, (const Sint32 *)src, (int)(len / sizeof(Sint32)), volume);
+        return 0;
+    }
+
     switch (format) {
 
     case SDL_AUDIO_U8:
@@ -64,6 +64,7 @@ const SDL_AudioFormat *SDL_ClosestAudioFormats(SDL_AudioFormat format);
 
 // Must be called at least once before using converters.
 extern void SDL_ChooseAudioConverters(void);
+extern void SDL_ChooseAudioMixers(void);
 extern void SDL_SetupAudioResampler(void);
 
 /* Backends should call this as devices are added to the system (such as
@@ -109,18 +110,44 @@ extern SDL_bool SDL_RecordingAudioThreadIterate(SDL_AudioDevice *device);
 extern void SDL_RecordingAudioThreadShutdown(SDL_AudioDevice *device);
 extern void SDL_AudioThreadFinalize(SDL_AudioDevice *device);
 
+// Backends that can render faster than real time (disk, dummy) call this from WaitDevice when SDL_HINT_AUDIO_OFFLINE_RENDERING is set.
+// It returns once every bound, unpaused stream can fill the next buffer (and at least one is bound), or the device is shutting down.
+extern int SDL_WaitAudioDeviceOffline(SDL_AudioDevice *device);
+
 extern void ConvertAudioToFloat(float *dst, const void *src, int num_samples, SDL_AudioFormat src_fmt);
 extern void ConvertAudioFromFloat(void *dst, const float *src, int num_samples, SDL_AudioFormat dst_fmt);
 extern void ConvertAudioSwapEndian(void* dst, const void* src, int num_samples, int bitsize);
 
 // this gets used from the audio device threads. It has rules, don't use this if you don't know how to use it!
 extern void ConvertAudio(int num_frames, const void *src, SDL_AudioFormat src_format, int src_channels,
-                         void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch);
+                         void *dst, SDL_AudioFormat dst_format, int dst_channels, void* scratch, float gain);
+
+// Time spent inside an audio stream's pipeline while the audio device thread pulled data from it.
+typedef struct SDL_AudioStreamTimes
+{
+    Uint64 resample_ns;
+    Uint64 convert_ns;  // everything else: format conversion, channel conversion, gain, mixing.
+} SDL_AudioStreamTimes;
+
+// this gets used from the audio device threads. It's SDL_GetAudioStreamData, but it adds to `times` and records how much the stream still had queued.
+extern int GetAudioStreamDataForDevice(SDL_AudioStream *stream, void *buf, int len, SDL_AudioStreamTimes *times);
+
+// this gets used from the audio device threads, too. It's SDL_GetAudioStreamData, but it adds the stream's output (with its gain) to a float32 mix buffer.
+// `scratch` must hold `len` bytes; output that can't be mixed straight out of the stream's queue is staged there.
+// `times` may be NULL.
+extern int MixAudioStreamData(SDL_AudioStream *stream, float *mix_buffer, int len, void *scratch, SDL_AudioStreamTimes *times);
+
+// this gets used from the audio device threads, too. SDL_TRUE if `frames` can be read from the stream without running dry.
+extern SDL_bool AudioStreamCanProvideFrames(SDL_AudioStream *stream, int frames);
 
 // Special case to let something in SDL_audiocvt.c access something in SDL_audio.c. Don't use this.
 extern void OnAudioStreamCreated(SDL_AudioStream *stream);
 extern void OnAudioStreamDestroy(SDL_AudioStream *stream);
 
+// Call this after anything that might let a device blocked in SDL_WaitAudioDeviceOffline render: data put into or flushed out of a stream,
+// a stream bound or unbound, a logical device paused, resumed or closed. It's cheap when nothing is waiting, and doesn't need any locks held.
+extern void WakeOfflineAudioDevices(void);
+
 typedef struct SDL_AudioDriverImpl
 {
     void (*DetectDevices)(SDL_AudioDevice **default_playback, SDL_AudioDevice **default_recording);
@@ -188,17 +215,35 @@ struct SDL_AudioStream
     SDL_AudioSpec src_spec;
     SDL_AudioSpec dst_spec;
     float freq_ratio;
+    float gain;
 
     struct SDL_AudioQueue* queue;
 
     SDL_AudioSpec input_spec; // The spec of input data currently being processed
     Sint64 resample_offset;
 
+    SDL_AudioResamplingQuality default_resampling_quality; // From SDL_HINT_AUDIO_RESAMPLING_QUALITY, when the stream was created.
+    SDL_AudioResamplingQuality resampling_quality;
+    struct SDL_ResamplerFilterBank *resampler_bank; // Built for the rates and quality below, if they allow one.
+    SDL_AudioResamplingQuality resampler_bank_quality;
+    int resampler_bank_src_freq;
+    int resampler_bank_dst_freq;
+
     Uint8 *work_buffer;    // used for scratch space during data conversion/resampling.
     size_t work_buffer_allocation;
 
     SDL_bool simplified;  // SDL_TRUE if created via SDL_OpenAudioDeviceStream
 
+    // For SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN: puts that skip the lock use a copy of the state they need,
+    // refreshed (with the lock held) whenever `producer_serial` changes. Only the producing thread touches the copy.
+    SDL_AtomicInt producer_serial;
+    int producer_cached_serial;
+    SDL_AudioSpec producer_spec;
+    SDL_bool producer_lock_free;  // SDL_FALSE if puts have to lock anyhow (not set up yet, or there's a put callback).
+
+    Sint64 short_reads;  // number of times a read returned less data than was asked for.
+    Sint64 device_queued_frames;  // output frames still available after the bound device last pulled from this stream.
+
     SDL_LogicalAudioDevice *bound_device;
     SDL_AudioStream *next_binding;
     SDL_AudioStream *prev_binding;
@@ -242,6 +287,23 @@ struct SDL_LogicalAudioDevice
     SDL_LogicalAudioDevice *prev;
 };
 
+#define SDL_AUDIO_DEVICE_HISTOGRAM_BUCKETS 8
+
+// Counters the audio device thread keeps about itself. Protected by the device lock.
+typedef struct SDL_AudioDeviceStats
+{
+    Sint64 periods;  // number of buffers played or recorded.
+    Sint64 underruns;  // periods where a bound stream (or the app's callback) couldn't provide enough data.
+    Sint64 short_reads;  // total number of stream reads that returned less data than requested.
+    Sint64 late_wakeups;  // periods that started more than half a period later than expected.
+    Uint64 max_lateness_ns;
+    Uint64 max_iterate_ns;
+    Uint64 resample_ns;
+    Uint64 convert_ns;
+    Sint64 iterate_histogram[SDL_AUDIO_DEVICE_HISTOGRAM_BUCKETS];  // time spent per iteration; bucket 0 is under 1/64 of a period, each bucket doubles that, the last is a full period or more.
+    Uint64 last_iterate_start;
+} SDL_AudioDeviceStats;
+
 struct SDL_AudioDevice
 {
     // A mutex for locking access to this struct
@@ -303,6 +365,9 @@ struct SDL_AudioDevice
     // Size of work_buffer (and mix_buffer) in bytes.
     int work_buffer_size;
 
+    // Worker threads that pull from bound streams in parallel, if SDL_HINT_AUDIO_MIXING_THREADS asked for them.
+    struct SDL_AudioMixThreads *mix_threads;
+
     // A thread to feed the audio device
     SDL_Thread *thread;
 
@@ -314,6 +379,11 @@ struct SDL_AudioDevice
 
     // All logical devices associated with this physical device.
     SDL_LogicalAudioDevice *logical_devices;
+
+    // Instrumentation reported through SDL_GetAudioDeviceProperties.
+    SDL_AudioDeviceStats stats;
+    Sint64 stats_histogram[SDL_AUDIO_DEVICE_HISTOGRAM_BUCKETS];  // the snapshot handed to the app.
+    SDL_PropertiesID props;
 };
 
 typedef struct AudioBootStrap
@@ -333,6 +333,127 @@ static Sint64 WaveAdjustToFactValue(WaveFile *file, Sint64 sampleframes)
     return sampleframes;
 }
 
+/* Large ADPCM files are decoded on several threads. Every block starts with a
+ * header that resets the decoder, so whole blocks can be decoded in any order.
+ * Smaller files aren't worth the cost of starting the threads.
+ */
+#define ADPCM_MIN_FRAMES_PER_THREAD (128 * 1024)
+#define ADPCM_MAX_DECODE_THREADS    16
+
+typedef int (*ADPCM_DecodeBlockFunc)(ADPCM_DecoderState *state);
+
+typedef struct ADPCM_DecodeJob
+{
+    const ADPCM_DecoderState *state; /* Settings, input and output shared by all jobs. */
+    ADPCM_DecodeBlockFunc decodeblock;
+    void *cstate;
+    size_t firstblock;
+    size_t endblock;
+    size_t failedblock; /* The first block that could not be decoded, or endblock. */
+} ADPCM_DecodeJob;
+
+static int SDLCALL ADPCM_DecodeBlocks(void *data)
+{
+    ADPCM_DecodeJob *job = (ADPCM_DecodeJob *)data;
+    const ADPCM_DecoderState *shared = job->state;
+    const size_t blocksamples = shared->samplesperblock * shared->channels;
+    size_t b;
+
+    job->failedblock = job->endblock;
+    for (b = job->firstblock; b < job->endblock; b++) {
+        ADPCM_DecoderState state = *shared;
+        state.cstate = job->cstate;
+        state.framesleft = (Sint64)shared->samplesperblock;
+        state.block.data = shared->input.data + b * shared->blocksize;
+        state.block.size = shared->blocksize;
+        state.block.pos = 0;
+        state.output.pos = b * blocksamples;
+        if (job->decodeblock(&state) < 0) {
+            job->failedblock = b;
+            break;
+        }
+    }
+
+    return 0;
+}
+
+/* Decodes the whole blocks at the start of the input on several threads, if
+ * there are enough of them, and moves the decoder state past the ones that
+ * succeeded. The rest is left to the caller, including any block that failed,
+ * so the error gets reported on the calling thread.
+ */
+static void ADPCM_DecodeBlocksThreaded(WaveFile *file, ADPCM_DecoderState *state, ADPCM_DecodeBlockFunc decodeblock, size_t cstatesize)
+{
+    ADPCM_DecodeJob jobs[ADPCM_MAX_DECODE_THREADS];
+    SDL_Thread *threads[ADPCM_MAX_DECODE_THREADS];
+    Uint8 *cstates;
+    Uint64 numblocks, blocksdone;
+    int numthreads = file->decodethreads;
+    int i;
+
+    if (state->input.pos != 0 || state->samplesperblock == 0) {
+        return;
+    }
+
+    numblocks = state->input.size / state->blocksize;
+    if (numblocks > (Uint64)state->framesleft / state->samplesperblock) {
+        numblocks = (Uint64)state->framesleft / state->samplesperblock;
+    }
+
+    if (numthreads <= 0) {
+        numthreads = SDL_GetCPUCount();
+    }
+    if (numthreads > ADPCM_MAX_DECODE_THREADS) {
+        numthreads = ADPCM_MAX_DECODE_THREADS;
+    }
+    if ((numblocks * state->samplesperblock) / ADPCM_MIN_FRAMES_PER_THREAD < (Uint64)numthreads) {
+        numthreads = (int)((numblocks * state->samplesperblock) / ADPCM_MIN_FRAMES_PER_THREAD);
+    }
+    if (numthreads < 2) {
+        return;
+    }
+
+    cstates = (Uint8 *)SDL_calloc(numthreads, cstatesize);
+    if (!cstates) {
+        return; /* The caller can still decode everything on its own. */
+    }
+
+    for (i = 0; i < numthreads; i++) {
+        jobs[i].state = state;
+        jobs[i].decodeblock = decodeblock;
+        jobs[i].cstate = cstates + i * cstatesize;
+        jobs[i].firstblock = (size_t)(numblocks * i / numthreads);
+        jobs[i].endblock = (size_t)(numblocks * (i + 1) / numthreads);
+    }
+
+    /* This thread takes the first job. */
+    for (i = 1; i < numthreads; i++) {
+        threads[i] = SDL_CreateThread(ADPCM_DecodeBlocks, "SDLWaveDecode", &jobs[i]);
+    }
+    ADPCM_DecodeBlocks(&jobs[0]);
+    for (i = 1; i < numthreads; i++) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], NULL);
+        } else {
+            ADPCM_DecodeBlocks(&jobs[i]);
+        }
+    }
+
+    SDL_free(cstates);
+
+    blocksdone = numblocks;
+    for (i = 0; i < numthreads; i++) {
+        if (jobs[i].failedblock < jobs[i].endblock) {
+            blocksdone = jobs[i].failedblock;
+            break;
+        }
+    }
+
+    state->input.pos = (size_t)blocksdone * state->blocksize;
+    state->output.pos = (size_t)blocksdone * state->samplesperblock * state->channels;
+    state->framesleft -= (Sint64)(blocksdone * state->samplesperblock);
+}
+
 static int MS_ADPCM_CalculateSampleFrames(WaveFile *file, size_t datalength)
 {
     WaveFormat *format = &file->format;
@@ -495,7 +616,7 @@ static Sint16 MS_ADPCM_ProcessNibble(MS_ADPCM_ChannelState *cstate, Sint32 sampl
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
     const Uint16 max_deltaval = 65535;
-    const Uint16 adaptive[] = {
+    static const Uint16 adaptive[] = {
         230, 230, 230, 230, 307, 409, 512, 614,
         768, 614, 512, 409, 307, 230, 230, 230
     };
@@ -604,6 +725,42 @@ static int MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
         blockframesleft = state->framesleft;
     }
 
+    /* Mono and stereo blocks are decoded a byte at a time, keeping the previous
+     * samples in registers instead of reading them back from the output. Whatever
+     * doesn't fill a whole byte is left for the generic loop below.
+     */
+    if (channels == 1) {
+        Sint16 *output = state->output.data;
+        sample1 = output[outpos - 1];
+        sample2 = output[outpos - 2];
+        while (blockframesleft >= 2 && blockpos < blocksize) {
+            const Uint8 byte = state->block.data[blockpos++];
+            sample2 = MS_ADPCM_ProcessNibble(cstate, sample1, sample2, byte >> 4);
+            sample1 = MS_ADPCM_ProcessNibble(cstate, sample2, sample1, byte & 0x0f);
+            output[outpos++] = sample2;
+            output[outpos++] = sample1;
+            state->framesleft -= 2;
+            blockframesleft -= 2;
+        }
+    } else if (channels == 2) {
+        Sint16 *output = state->output.data;
+        Sint16 left1 = output[outpos - 2], left2 = output[outpos - 4];
+        Sint16 right1 = output[outpos - 1], right2 = output[outpos - 3];
+        while (blockframesleft >= 1 && blockpos < blocksize) {
+            const Uint8 byte = state->block.data[blockpos++];
+            const Sint16 left = MS_ADPCM_ProcessNibble(cstate, left1, left2, byte >> 4);
+            const Sint16 right = MS_ADPCM_ProcessNibble(cstate + 1, right1, right2, byte & 0x0f);
+            output[outpos++] = left;
+            output[outpos++] = right;
+            left2 = left1;
+            left1 = left;
+            right2 = right1;
+            right1 = right;
+            state->framesleft--;
+            blockframesleft--;
+        }
+    }
+
     while (blockframesleft > 0) {
         for (c = 0; c < channels; c++) {
             if (nybble & 0x4000) {
@@ -633,6 +790,14 @@ static int MS_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return 0;
 }
 
+static int MS_ADPCM_DecodeBlock(ADPCM_DecoderState *state)
+{
+    if (MS_ADPCM_DecodeBlockHeader(state) < 0) {
+        return -1;
+    }
+    return MS_ADPCM_DecodeBlockData(state);
+}
+
 static int MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     int result;
@@ -688,6 +853,9 @@ static int MS_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 
     state.cstate = cstate;
 
+    /* Large files get most of their blocks decoded in parallel first. */
+    ADPCM_DecodeBlocksThreaded(file, &state, MS_ADPCM_DecodeBlock, sizeof(cstate));
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -854,13 +1022,13 @@ static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 ny
 {
     const Sint32 max_audioval = 32767;
     const Sint32 min_audioval = -32768;
-    const Sint8 index_table_4b[16] = {
+    static const Sint8 index_table_4b[16] = {
         -1, -1, -1, -1,
         2, 4, 6, 8,
         -1, -1, -1, -1,
         2, 4, 6, 8
     };
-    const Uint16 step_table[89] = {
+    static const Uint16 step_table[89] = {
         7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
         34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
         143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
@@ -919,6 +1087,12 @@ static Sint16 IMA_ADPCM_ProcessNibble(Sint8 *cindex, Sint16 lastsample, Uint8 ny
     return (Sint16)sample;
 }
 
+/* Reads the eight nybbles of one channel in a sub-block, first nybble in the lowest bits. */
+static SDL_INLINE Uint32 IMA_ADPCM_ReadNybbles(const Uint8 *data)
+{
+    return data[0] | ((Uint32)data[1] << 8) | ((Uint32)data[2] << 16) | ((Uint32)data[3] << 24);
+}
+
 static int IMA_ADPCM_DecodeBlockHeader(ADPCM_DecoderState *state)
 {
     Sint16 step;
@@ -991,6 +1165,48 @@ static int IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
         retval = -1;
     }
 
+    /* Mono and stereo blocks are decoded a whole sub-block at a time. For stereo,
+     * both channels are stepped together so that their independent chains of
+     * calculations can overlap, and the output is written in order. Partial
+     * sub-blocks are left for the generic loop below.
+     */
+    if (channels == 1) {
+        Sint8 *cindex = (Sint8 *)state->cstate;
+        Sint16 *output = state->output.data;
+        Sint16 sample = output[outpos - 1];
+        while (blockframesleft >= 8) {
+            Uint32 nybbles = IMA_ADPCM_ReadNybbles(state->block.data + blockpos);
+            blockpos += 4;
+            for (i = 0; i < 8; i++) {
+                sample = IMA_ADPCM_ProcessNibble(cindex, sample, (Uint8)(nybbles & 0x0f));
+                nybbles >>= 4;
+                output[outpos++] = sample;
+            }
+            state->framesleft -= 8;
+            blockframesleft -= 8;
+        }
+    } else if (channels == 2) {
+        Sint8 *cindex = (Sint8 *)state->cstate;
+        Sint16 *output = state->output.data;
+        Sint16 left = output[outpos - 2];
+        Sint16 right = output[outpos - 1];
+        while (blockframesleft >= 8) {
+            Uint32 leftnybbles = IMA_ADPCM_ReadNybbles(state->block.data + blockpos);
+            Uint32 rightnybbles = IMA_ADPCM_ReadNybbles(state->block.data + blockpos + 4);
+            blockpos += 8;
+            for (i = 0; i < 8; i++) {
+                left = IMA_ADPCM_ProcessNibble(cindex, left, (Uint8)(leftnybbles & 0x0f));
+                right = IMA_ADPCM_ProcessNibble(cindex + 1, right, (Uint8)(rightnybbles & 0x0f));
+                leftnybbles >>= 4;
+                rightnybbles >>= 4;
+                output[outpos++] = left;
+                output[outpos++] = right;
+            }
+            state->framesleft -= 8;
+            blockframesleft -= 8;
+        }
+    }
+
     /* Each channel has their nibbles packed into 32-bit blocks. These blocks
      * are interleaved and make up the data part of the ADPCM block. This loop
      * decodes the samples as they come from the input data and puts them at
@@ -1027,6 +1243,14 @@ static int IMA_ADPCM_DecodeBlockData(ADPCM_DecoderState *state)
     return retval;
 }
 
+static int IMA_ADPCM_DecodeBlock(ADPCM_DecoderState *state)
+{
+    if (IMA_ADPCM_DecodeBlockHeader(state) < 0) {
+        return -1;
+    }
+    return IMA_ADPCM_DecodeBlockData(state);
+}
+
 static int IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     int result;
@@ -1084,6 +1308,9 @@ static int IMA_ADPCM_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len
     }
     state.cstate = cstate;
 
+    /* Large files get most of their blocks decoded in parallel first. */
+    ADPCM_DecodeBlocksThreaded(file, &state, IMA_ADPCM_DecodeBlock, state.channels * sizeof(Sint8));
+
     /* Decode block by block. A truncated block will stop the decoding. */
     bytesleft = state.input.size - state.input.pos;
     while (state.framesleft > 0 && bytesleft >= state.blockheadersize) {
@@ -1158,7 +1385,127 @@ static int LAW_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+/* Both companding laws decode a sample as ((mantissa << shift) + base) * scale - bias,
+ * where base and scale only depend on the 3-bit exponent. The vector decoders
+ * look these up with byte shuffles and do the variable shift with a 16-bit
+ * multiplication. Like the scalar code, they work backwards to expand in-place.
+ */
+#ifdef SDL_SSE4_1_INTRINSICS
+static void SDL_TARGETING("sse4.1") LAW_DecodeSamples_SSE41(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lowbits = _mm_set1_epi8(0x0f);
+    const __m128i exponentbits = _mm_set1_epi8(0x07);
+    __m128i xorbits, signbits, baselo_lut, basehi_lut, scale_lut, bias, shift;
+    size_t i = sample_count;
+
+    if (encoding == ALAW_CODE) {
+        xorbits = _mm_set1_epi8(0x55);
+        signbits = _mm_set1_epi8((char)0x80); /* Positive if the sign bit is set. */
+        baselo_lut = _mm_set1_epi8(0x08);
+        basehi_lut = _mm_setr_epi8(0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0);
+        scale_lut = _mm_setr_epi8(1, 1, 2, 4, 8, 16, 32, 64, 0, 0, 0, 0, 0, 0, 0, 0);
+        bias = zero;
+        shift = _mm_cvtsi32_si128(4);
+    } else {
+        xorbits = _mm_set1_epi8((char)0xff);
+        signbits = zero;
+        baselo_lut = _mm_set1_epi8((char)0x84);
+        basehi_lut = zero;
+        scale_lut = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, (char)128, 0, 0, 0, 0, 0, 0, 0, 0);
+        bias = _mm_set1_epi16(0x84);
+        shift = _mm_cvtsi32_si128(3);
+    }
+
+    while (i >= 16) {
+        __m128i bytes, exponent, mantissa, base, basehi, scale, sign, lo, hi;
+
+        i -= 16;
+        bytes = _mm_xor_si128(_mm_loadu_si128((const __m128i *)&src[i]), xorbits);
+        exponent = _mm_and_si128(_mm_srli_epi16(bytes, 4), exponentbits);
+        mantissa = _mm_and_si128(bytes, lowbits);
+        base = _mm_shuffle_epi8(baselo_lut, exponent);
+        scale = _mm_shuffle_epi8(scale_lut, exponent);
+        sign = _mm_cmpgt_epi8(zero, _mm_xor_si128(bytes, signbits));
+        basehi = _mm_shuffle_epi8(basehi_lut, exponent);
+
+        lo = _mm_sll_epi16(_mm_unpacklo_epi8(mantissa, zero), shift);
+        lo = _mm_add_epi16(lo, _mm_unpacklo_epi8(base, basehi));
+        lo = _mm_sub_epi16(_mm_mullo_epi16(lo, _mm_unpacklo_epi8(scale, zero)), bias);
+        lo = _mm_sub_epi16(_mm_xor_si128(lo, _mm_unpacklo_epi8(sign, sign)), _mm_unpacklo_epi8(sign, sign));
+
+        hi = _mm_sll_epi16(_mm_unpackhi_epi8(mantissa, zero), shift);
+        hi = _mm_add_epi16(hi, _mm_unpackhi_epi8(base, basehi));
+        hi = _mm_sub_epi16(_mm_mullo_epi16(hi, _mm_unpackhi_epi8(scale, zero)), bias);
+        hi = _mm_sub_epi16(_mm_xor_si128(hi, _mm_unpackhi_epi8(sign, sign)), _mm_unpackhi_epi8(sign, sign));
+
+        /* The source bytes were loaded before storing over them. */
+        _mm_storeu_si128((__m128i *)&dst[i], lo);
+        _mm_storeu_si128((__m128i *)&dst[i + 8], hi);
+    }
+}
+#endif
+
+/* The NEON decoder hasn't been built or checked against the G.711 tests on ARM yet,
+ * so it's left out unless SDL_NEON_WAVE_DECODERS is defined.
+ */
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_WAVE_DECODERS)
+static void LAW_DecodeSamples_NEON(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
+{
+    static const Uint8 alaw_basehi[8] = { 0, 1, 1, 1, 1, 1, 1, 1 };
+    static const Uint8 alaw_scale[8] = { 1, 1, 2, 4, 8, 16, 32, 64 };
+    static const Uint8 mulaw_basehi[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+    static const Uint8 mulaw_scale[8] = { 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x8_t lowbits = vdup_n_u8(0x0f);
+    const uint8x8_t exponentbits = vdup_n_u8(0x07);
+    const uint8x8_t signbit = vdup_n_u8(0x80);
+    uint8x8_t xorbits, signbits, basehi_lut, scale_lut;
+    uint16x8_t baselo, bias;
+    int16x8_t shift;
+    size_t i = sample_count;
+
+    if (encoding == ALAW_CODE) {
+        xorbits = vdup_n_u8(0x55);
+        signbits = vdup_n_u8(0x80); /* Positive if the sign bit is set. */
+        basehi_lut = vld1_u8(alaw_basehi);
+        scale_lut = vld1_u8(alaw_scale);
+        baselo = vdupq_n_u16(0x08);
+        bias = vdupq_n_u16(0);
+        shift = vdupq_n_s16(4);
+    } else {
+        xorbits = vdup_n_u8(0xff);
+        signbits = vdup_n_u8(0);
+        basehi_lut = vld1_u8(mulaw_basehi);
+        scale_lut = vld1_u8(mulaw_scale);
+        baselo = vdupq_n_u16(0x84);
+        bias = vdupq_n_u16(0x84);
+        shift = vdupq_n_s16(3);
+    }
+
+    while (i >= 8) {
+        uint8x8_t bytes, exponent;
+        uint16x8_t value;
+        int16x8_t sign;
+
+        i -= 8;
+        bytes = veor_u8(vld1_u8(&src[i]), xorbits);
+        exponent = vand_u8(vshr_n_u8(bytes, 4), exponentbits);
+        sign = vmovl_s8(vreinterpret_s8_u8(vtst_u8(veor_u8(bytes, signbits), signbit)));
+
+        value = vshlq_u16(vmovl_u8(vand_u8(bytes, lowbits)), shift);
+        value = vaddq_u16(value, vorrq_u16(baselo, vshll_n_u8(vtbl1_u8(basehi_lut, exponent), 8)));
+        value = vsubq_u16(vmulq_u16(value, vmovl_u8(vtbl1_u8(scale_lut, exponent))), bias);
+
+        /* The source bytes were loaded before storing over them. */
+        vst1q_s16(&dst[i], vsubq_s16(veorq_s16(vreinterpretq_s16_u16(value), sign), sign));
+    }
+}
+#endif
+
+/* Expands companded samples to 16 bits. This works backwards, so dst may point
+ * to the same memory as src to expand in-place.
+ */
+static int LAW_DecodeSamples(Uint16 encoding, const Uint8 *src, Sint16 *dst, size_t sample_count)
 {
 #ifdef SDL_WAVE_LAW_LUT
     const Sint16 alaw_lut[256] = {
@@ -1199,67 +1546,35 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
     };
 #endif
 
-    WaveFormat *format = &file->format;
-    WaveChunk *chunk = &file->chunk;
-    size_t i, sample_count, expanded_len;
-    Uint8 *src;
-    Sint16 *dst;
+    size_t i = sample_count;
+    size_t vectorcount = 0; /* Leading samples left for the vector code. */
 
-    if (chunk->length != chunk->size) {
-        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
-        if (file->sampleframes < 0) {
-            return -1;
-        }
-    }
-
-    /* Nothing to decode, nothing to return. */
-    if (file->sampleframes == 0) {
-        *audio_buf = NULL;
-        *audio_len = 0;
-        return 0;
-    }
-
-    sample_count = (size_t)file->sampleframes;
-    if (SafeMult(&sample_count, format->channels)) {
-        return SDL_SetError("WAVE file too big");
+#ifdef SDL_SSE4_1_INTRINSICS
+    if (SDL_HasSSE41()) {
+        vectorcount = sample_count & ~(size_t)15;
     }
-
-    expanded_len = sample_count;
-    if (SafeMult(&expanded_len, sizeof(Sint16))) {
-        return SDL_SetError("WAVE file too big");
-    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
-        return SDL_SetError("WAVE file too big");
-    }
-
-    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
-    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
-    if (!src) {
-        return -1;
+#endif
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_WAVE_DECODERS)
+    if (SDL_HasNEON()) {
+        vectorcount = sample_count & ~(size_t)7;
     }
-    chunk->data = NULL;
-    chunk->size = 0;
-
-    dst = (Sint16 *)src;
+#endif
 
-    /* Work backwards, since we're expanding in-place. `format` will
-     * inform the caller about the byte order.
-     */
-    i = sample_count;
-    switch (file->format.encoding) {
+    switch (encoding) {
 #ifdef SDL_WAVE_LAW_LUT
     case ALAW_CODE:
-        while (i--) {
+        while (i-- > vectorcount) {
             dst[i] = alaw_lut[src[i]];
         }
         break;
     case MULAW_CODE:
-        while (i--) {
+        while (i-- > vectorcount) {
             dst[i] = mulaw_lut[src[i]];
         }
         break;
 #else
     case ALAW_CODE:
-        while (i--) {
+        while (i-- > vectorcount) {
             Uint8 nibble = src[i];
             Uint8 exponent = (nibble & 0x7f) ^ 0x55;
             Sint16 mantissa = exponent & 0xf;
@@ -1277,7 +1592,7 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         }
         break;
     case MULAW_CODE:
-        while (i--) {
+        while (i-- > vectorcount) {
             Uint8 nibble = ~src[i];
             Sint16 mantissa = nibble & 0xf;
             Uint8 exponent = (nibble >> 4) & 0x7;
@@ -1290,10 +1605,68 @@ static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
         break;
 #endif
     default:
-        SDL_free(src);
         return SDL_SetError("Unknown companded encoding");
     }
 
+    if (vectorcount > 0) {
+#ifdef SDL_SSE4_1_INTRINSICS
+        LAW_DecodeSamples_SSE41(encoding, src, dst, vectorcount);
+#endif
+#if defined(SDL_NEON_INTRINSICS) && defined(SDL_NEON_WAVE_DECODERS)
+        LAW_DecodeSamples_NEON(encoding, src, dst, vectorcount);
+#endif
+    }
+
+    return 0;
+}
+
+static int LAW_Decode(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    size_t sample_count, expanded_len;
+    Uint8 *src;
+
+    if (chunk->length != chunk->size) {
+        file->sampleframes = WaveAdjustToFactValue(file, chunk->size / format->blockalign);
+        if (file->sampleframes < 0) {
+            return -1;
+        }
+    }
+
+    /* Nothing to decode, nothing to return. */
+    if (file->sampleframes == 0) {
+        *audio_buf = NULL;
+        *audio_len = 0;
+        return 0;
+    }
+
+    sample_count = (size_t)file->sampleframes;
+    if (SafeMult(&sample_count, format->channels)) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    expanded_len = sample_count;
+    if (SafeMult(&expanded_len, sizeof(Sint16))) {
+        return SDL_SetError("WAVE file too big");
+    } else if (expanded_len > SDL_MAX_UINT32 || file->sampleframes > SIZE_MAX) {
+        return SDL_SetError("WAVE file too big");
+    }
+
+    /* 1 to avoid allocating zero bytes, to keep static analysis happy. */
+    src = (Uint8 *)SDL_realloc(chunk->data, expanded_len ? expanded_len : 1);
+    if (!src) {
+        return -1;
+    }
+    chunk->data = NULL;
+    chunk->size = 0;
+
+    /* Expand in-place. `format` will inform the caller about the byte order. */
+    if (LAW_DecodeSamples(format->encoding, src, (Sint16 *)src, sample_count) < 0) {
+        SDL_free(src);
+        return -1;
+    }
+
     *audio_buf = src;
     *audio_len = (Uint32)expanded_len;
 
@@ -1343,11 +1716,34 @@ static int PCM_Init(WaveFile *file, size_t datalength)
     return 0;
 }
 
+/* Shifts 24-bit samples to 32 bits. This works from end to start, so dst may
+ * point to the same memory as src to expand in-place.
+ */
+static void PCM_ConvertSint24ToSint32Samples(const Uint8 *src, Uint8 *dst, size_t sample_count)
+{
+    size_t i;
+
+    for (i = sample_count; i > 0; i--) {
+        const size_t o = i - 1;
+        uint8_t b[4];
+
+        b[0] = 0;
+        b[1] = src[o * 3];
+        b[2] = src[o * 3 + 1];
+        b[3] = src[o * 3 + 2];
+
+        dst[o * 4 + 0] = b[0];
+        dst[o * 4 + 1] = b[1];
+        dst[o * 4 + 2] = b[2];
+        dst[o * 4 + 3] = b[3];
+    }
+}
+
 static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *audio_len)
 {
     WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
-    size_t i, expanded_len, sample_count;
+    size_t expanded_len, sample_count;
     Uint8 *ptr;
 
     sample_count = (size_t)file->sampleframes;
@@ -1375,21 +1771,7 @@ static int PCM_ConvertSint24ToSint32(WaveFile *file, Uint8 **audio_buf, Uint32 *
     *audio_buf = ptr;
     *audio_len = (Uint32)expanded_len;
 
-    /* work from end to start, since we're expanding in-place. */
-    for (i = sample_count; i > 0; i--) {
-        const size_t o = i - 1;
-        uint8_t b[4];
-
-        b[0] = 0;
-        b[1] = ptr[o * 3];
-        b[2] = ptr[o * 3 + 1];
-        b[3] = ptr[o * 3 + 2];
-
-        ptr[o * 4 + 0] = b[0];
-        ptr[o * 4 + 1] = b[1];
-        ptr[o * 4 + 2] = b[2];
-        ptr[o * 4 + 3] = b[3];
-    }
+    PCM_ConvertSint24ToSint32Samples(ptr, ptr, sample_count);
 
     return 0;
 }
@@ -1493,6 +1875,17 @@ static WaveFactChunkHint WaveGetFactChunkHint(void)
     return FactNoHint;
 }
 
+static int WaveGetDecodeThreadsHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_WAVE_DECODE_THREADS);
+
+    if (hint) {
+        return SDL_atoi(hint);
+    }
+
+    return 0;
+}
+
 static void WaveFreeChunkData(WaveChunk *chunk)
 {
     if (chunk->data) {
@@ -1769,7 +2162,12 @@ static int WaveCheckFormat(WaveFile *file, size_t datalength)
     return 0;
 }
 
-static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+/* Steps through the chunks of the WAVE file and processes the fmt chunk. On
+ * success, the decoder is initialized and file->chunk points to the data chunk
+ * without its data having been read. endposition is set to the position after
+ * the last chunk of the WAVE file.
+ */
+static int WaveReadHeaders(SDL_IOStream *src, WaveFile *file, Sint64 *endposition)
 {
     int result;
     Uint32 chunkcount = 0;
@@ -1777,7 +2175,6 @@ static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint
     char *envchunkcountlimit;
     Sint64 RIFFstart, RIFFend, lastchunkpos;
     SDL_bool RIFFlengthknown = SDL_FALSE;
-    WaveFormat *format = &file->format;
     WaveChunk *chunk = &file->chunk;
     WaveChunk RIFFchunk;
     WaveChunk fmtchunk;
@@ -1979,10 +2376,76 @@ static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint
 #endif
 
     WaveFreeChunkData(chunk);
-
-    /* Process data chunk. */
     *chunk = datachunk;
 
+    /* Report the end position back to the caller. */
+    if (RIFFlengthknown) {
+        *endposition = RIFFend;
+    } else {
+        *endposition = lastchunkpos;
+    }
+
+    return 0;
+}
+
+static int WaveGetSpec(WaveFile *file, SDL_AudioSpec *spec)
+{
+    WaveFormat *format = &file->format;
+
+    /* Setting up the specs. All unsupported formats were filtered out
+     * by the checks in WaveCheckFormat.
+     */
+    spec->freq = format->frequency;
+    spec->channels = (Uint8)format->channels;
+    spec->format = 0;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+    case ALAW_CODE:
+    case MULAW_CODE:
+        /* These can be easily stored in the byte order of the system. */
+        spec->format = SDL_AUDIO_S16;
+        break;
+    case IEEE_FLOAT_CODE:
+        spec->format = SDL_AUDIO_F32LE;
+        break;
+    case PCM_CODE:
+        switch (format->bitspersample) {
+        case 8:
+            spec->format = SDL_AUDIO_U8;
+            break;
+        case 16:
+            spec->format = SDL_AUDIO_S16LE;
+            break;
+        case 24: /* Has been shifted to 32 bits. */
+        case 32:
+            spec->format = SDL_AUDIO_S32LE;
+            break;
+        default:
+            /* Just in case something unexpected happened in the checks. */
+            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
+        }
+        break;
+    default:
+        return SDL_SetError("Unexpected data format");
+    }
+
+    return 0;
+}
+
+static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    int result;
+    Sint64 endposition;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+
+    if (WaveReadHeaders(src, file, &endposition) < 0) {
+        return -1;
+    }
+
+    /* Process data chunk. */
     if (chunk->length > 0) {
         result = WaveReadChunkData(src, chunk);
         if (result == -1) {
@@ -2026,51 +2489,12 @@ static int WaveLoad(SDL_IOStream *src, WaveFile *file, SDL_AudioSpec *spec, Uint
         break;
     }
 
-    /* Setting up the specs. All unsupported formats were filtered out
-     * by checks earlier in this function.
-     */
-    spec->freq = format->frequency;
-    spec->channels = (Uint8)format->channels;
-    spec->format = 0;
-
-    switch (format->encoding) {
-    case MS_ADPCM_CODE:
-    case IMA_ADPCM_CODE:
-    case ALAW_CODE:
-    case MULAW_CODE:
-        /* These can be easily stored in the byte order of the system. */
-        spec->format = SDL_AUDIO_S16;
-        break;
-    case IEEE_FLOAT_CODE:
-        spec->format = SDL_AUDIO_F32LE;
-        break;
-    case PCM_CODE:
-        switch (format->bitspersample) {
-        case 8:
-            spec->format = SDL_AUDIO_U8;
-            break;
-        case 16:
-            spec->format = SDL_AUDIO_S16LE;
-            break;
-        case 24: /* Has been shifted to 32 bits. */
-        case 32:
-            spec->format = SDL_AUDIO_S32LE;
-            break;
-        default:
-            /* Just in case something unexpected happened in the checks. */
-            return SDL_SetError("Unexpected %u-bit PCM data format", (unsigned int)format->bitspersample);
-        }
-        break;
-    default:
-        return SDL_SetError("Unexpected data format");
+    if (WaveGetSpec(file, spec) < 0) {
+        return -1;
     }
 
     /* Report the end position back to the cleanup code. */
-    if (RIFFlengthknown) {
-        chunk->position = RIFFend;
-    } else {
-        chunk->position = lastchunkpos;
-    }
+    chunk->position = endposition;
 
     return 0;
 }
@@ -2101,6 +2525,7 @@ int SDL_LoadWAV_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec, Uin
     file.riffhint = WaveGetRiffSizeHint();
     file.trunchint = WaveGetTruncationHint();
     file.facthint = WaveGetFactChunkHint();
+    file.decodethreads = WaveGetDecodeThreadsHint();
 
     result = WaveLoad(src, &file, spec, audio_buf, audio_len);
     if (result < 0) {
@@ -2127,3 +2552,412 @@ int SDL_LoadWAV(const char *path, SDL_AudioSpec *spec, Uint8 **audio_buf, Uint32
     return SDL_LoadWAV_IO(SDL_IOFromFile(path, "rb"), 1, spec, audio_buf, audio_len);
 }
 
+
+/* Approximate number of bytes of PCM or companded data that get decoded at once. */
+#define WAVE_STREAM_UNIT_SIZE 16384
+
+#define PROP_AUDIOSTREAM_WAVE_DECODER_POINTER "SDL.audiostream.wave.decoder"
+
+/* Decodes a WAVE file on demand into the audio stream it belongs to. The data
+ * chunk is processed in units: an ADPCM block or a run of PCM sample frames.
+ */
+typedef struct WaveStreamDecoder
+{
+    SDL_AudioStream *stream;
+    SDL_IOStream *src;
+    SDL_bool closeio;
+    WaveFile file;          /* file.chunk is the data chunk. Its data is never read as a whole. */
+    Uint64 datalength;      /* Number of bytes of the data chunk that are present in the file. */
+    Sint64 srcposition;     /* Current position in src, to avoid unnecessary seeks. -1 if unknown. */
+    Sint64 frame;           /* The next sample frame that will be put into the stream. */
+    SDL_bool finished;      /* Set after the last sample frame was put into the stream. */
+    SDL_bool failed;        /* Set after decoding failed, until the next seek. */
+    Uint32 unitframes;      /* Number of sample frames in a unit. */
+    size_t unitsize;        /* Number of bytes of a unit in the data chunk. */
+    size_t inframesize;     /* Number of bytes of a PCM or companded sample frame in the data chunk. */
+    size_t outframesize;    /* Number of bytes of a decoded sample frame. */
+    Uint8 *input;           /* Holds one unit from the data chunk. */
+    Uint8 *output;          /* Holds one decoded unit, if the data has to be decoded. */
+    void *cstate;           /* ADPCM channel states. They only last for one block. */
+} WaveStreamDecoder;
+
+static void FreeWaveStreamDecoder(WaveStreamDecoder *decoder)
+{
+    if (decoder->closeio) {
+        SDL_CloseIO(decoder->src);
+    }
+    WaveFreeChunkData(&decoder->file.chunk);
+    SDL_free(decoder->file.decoderdata);
+    SDL_free(decoder->input);
+    SDL_free(decoder->output);
+    SDL_free(decoder->cstate);
+    SDL_free(decoder);
+}
+
+/* Decodes one ADPCM block from the input. Returns the number of sample frames
+ * that were decoded or -1 on error.
+ */
+static Sint64 WaveStreamDecodeADPCMBlock(WaveStreamDecoder *decoder, size_t blocksize, Sint64 framesleft)
+{
+    WaveFile *file = &decoder->file;
+    ADPCM_DecoderState state;
+    int result;
+
+    SDL_zero(state);
+    state.channels = file->format.channels;
+    state.blocksize = file->format.blockalign;
+    state.samplesperblock = file->format.samplesperblock;
+    state.framesize = state.channels * sizeof(Sint16);
+    state.ddata = file->decoderdata;
+    state.cstate = decoder->cstate;
+    state.framestotal = file->sampleframes;
+    state.framesleft = framesleft;
+
+    state.block.data = decoder->input;
+    state.block.size = blocksize;
+    state.block.pos = 0;
+
+    state.output.data = (Sint16 *)decoder->output;
+    state.output.size = (size_t)state.samplesperblock * state.channels;
+    state.output.pos = 0;
+
+    if (file->format.encoding == MS_ADPCM_CODE) {
+        state.blockheadersize = (size_t)state.channels * 7;
+        if (blocksize < state.blockheadersize) {
+            return 0;
+        } else if (MS_ADPCM_DecodeBlockHeader(&state) < 0) {
+            return -1;
+        }
+        result = MS_ADPCM_DecodeBlockData(&state);
+    } else {
+        state.blockheadersize = (size_t)state.channels * 4;
+        if (blocksize < state.blockheadersize) {
+            return 0;
+        }
+        result = IMA_ADPCM_DecodeBlockHeader(&state);
+        if (result == 0) {
+            result = IMA_ADPCM_DecodeBlockData(&state);
+        }
+    }
+
+    if (result == -1) {
+        /* Truncated block. Same rules as for the whole file. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Truncated data chunk");
+        } else if (file->trunchint != TruncDropFrame) {
+            return 0;
+        }
+    }
+
+    return (Sint64)(state.output.pos / state.channels);
+}
+
+/* Reads and decodes the unit that contains decoder->frame, then puts its sample
+ * frames from decoder->frame on into the audio stream. Returns the number of
+ * sample frames put into the stream, 0 at the end of the data, or -1 on error.
+ */
+static int WaveStreamDecodeUnit(WaveStreamDecoder *decoder)
+{
+    WaveFile *file = &decoder->file;
+    WaveFormat *format = &file->format;
+    const Sint64 unit = decoder->frame / decoder->unitframes;
+    const Sint64 unitstart = unit * decoder->unitframes;
+    const Sint64 skipframes = decoder->frame - unitstart;
+    const Uint64 offset = (Uint64)unit * decoder->unitsize;
+    const Sint64 position = file->chunk.position + (Sint64)offset;
+    const Uint8 *data;
+    size_t readsize;
+    Sint64 frames;
+
+    if (decoder->frame >= file->sampleframes || offset >= decoder->datalength) {
+        return 0;
+    }
+
+    readsize = decoder->unitsize;
+    if (readsize > decoder->datalength - offset) {
+        readsize = (size_t)(decoder->datalength - offset);
+    }
+
+    if (decoder->srcposition != position) {
+        if (SDL_SeekIO(decoder->src, position, SDL_IO_SEEK_SET) != position) {
+            decoder->srcposition = -1;
+            return SDL_SetError("Could not seek data of WAVE data chunk");
+        }
+    }
+    readsize = SDL_ReadIO(decoder->src, decoder->input, readsize);
+    decoder->srcposition = position + (Sint64)readsize;
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        frames = WaveStreamDecodeADPCMBlock(decoder, readsize, file->sampleframes - unitstart);
+        if (frames < 0) {
+            return -1;
+        }
+        data = decoder->output;
+        break;
+    case ALAW_CODE:
+    case MULAW_CODE:
+        frames = (Sint64)(readsize / decoder->inframesize);
+        if (LAW_DecodeSamples(format->encoding, decoder->input, (Sint16 *)decoder->output, (size_t)frames * format->channels) < 0) {
+            return -1;
+        }
+        data = decoder->output;
+        break;
+    default:
+        frames = (Sint64)(readsize / decoder->inframesize);
+        if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            PCM_ConvertSint24ToSint32Samples(decoder->input, decoder->output, (size_t)frames * format->channels);
+            data = decoder->output;
+        } else {
+            data = decoder->input;
+        }
+        break;
+    }
+
+    if (frames > file->sampleframes - unitstart) {
+        frames = file->sampleframes - unitstart;
+    }
+    if (frames <= skipframes) {
+        /* The file is shorter than expected. */
+        return 0;
+    }
+    frames -= skipframes;
+
+    if (SDL_PutAudioStreamData(decoder->stream, data + (size_t)skipframes * decoder->outframesize, (int)((size_t)frames * decoder->outframesize)) < 0) {
+        return -1;
+    }
+    decoder->frame += frames;
+
+    return (int)frames;
+}
+
+static void SDLCALL WaveStreamCallback(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    WaveStreamDecoder *decoder = (WaveStreamDecoder *)userdata;
+    Sint64 frames = ((Sint64)additional_amount + decoder->outframesize - 1) / decoder->outframesize;
+
+    while (frames > 0 && !decoder->finished && !decoder->failed) {
+        const int result = WaveStreamDecodeUnit(decoder);
+        if (result < 0) {
+            /* Whoever reads the stream won't see the error, so keep it where they can look for it. */
+            SDL_SetStringProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING, SDL_GetError());
+            decoder->failed = SDL_TRUE;
+        } else if (result == 0) {
+            /* End of the data. Let the stream drain what it has left. */
+            SDL_FlushAudioStream(stream);
+            decoder->finished = SDL_TRUE;
+        } else {
+            frames -= result;
+        }
+    }
+}
+
+static void SDLCALL CleanupWaveStreamDecoder(void *userdata, void *value)
+{
+    WaveStreamDecoder *decoder = (WaveStreamDecoder *)value;
+    SDL_AudioStream *stream = decoder->stream;
+
+    /* The stream lock is held while the callback runs, so it's done after this. */
+    SDL_LockAudioStream(stream);
+    if (stream->get_callback == WaveStreamCallback && stream->get_callback_userdata == decoder) {
+        stream->get_callback = NULL;
+        stream->get_callback_userdata = NULL;
+    }
+    SDL_UnlockAudioStream(stream);
+
+    FreeWaveStreamDecoder(decoder);
+}
+
+static int WaveStreamSetup(WaveStreamDecoder *decoder)
+{
+    WaveFile *file = &decoder->file;
+    WaveFormat *format = &file->format;
+    WaveChunk *chunk = &file->chunk;
+    const Sint64 size = SDL_GetIOSize(decoder->src);
+    size_t outputsize = 0;
+
+    /* Find out how much of the data chunk is actually in the file, so the
+     * number of sample frames is known up front, just like SDL_LoadWAV_IO would
+     * report it.
+     */
+    decoder->datalength = chunk->length;
+    if (size >= 0 && (Uint64)size < (Uint64)chunk->position + chunk->length) {
+        decoder->datalength = size > chunk->position ? (Uint64)(size - chunk->position) : 0;
+    }
+
+    if (decoder->datalength != chunk->length) {
+        /* I/O issues or corrupt file. */
+        if (file->trunchint == TruncVeryStrict || file->trunchint == TruncStrict) {
+            return SDL_SetError("Could not read data of WAVE data chunk");
+        }
+
+        /* Recalculate number of sample frames. */
+        switch (format->encoding) {
+        case MS_ADPCM_CODE:
+            if (MS_ADPCM_CalculateSampleFrames(file, (size_t)decoder->datalength) < 0) {
+                return -1;
+            }
+            break;
+        case IMA_ADPCM_CODE:
+            if (IMA_ADPCM_CalculateSampleFrames(file, (size_t)decoder->datalength) < 0) {
+                return -1;
+            }
+            break;
+        default:
+            file->sampleframes = WaveAdjustToFactValue(file, decoder->datalength / format->blockalign);
+            if (file->sampleframes < 0) {
+                return -1;
+            }
+            break;
+        }
+    }
+
+    switch (format->encoding) {
+    case MS_ADPCM_CODE:
+    case IMA_ADPCM_CODE:
+        decoder->unitframes = format->samplesperblock;
+        decoder->unitsize = format->blockalign;
+        decoder->outframesize = (size_t)format->channels * sizeof(Sint16);
+        outputsize = (size_t)format->samplesperblock * decoder->outframesize;
+        if (format->encoding == MS_ADPCM_CODE) {
+            decoder->cstate = SDL_calloc(2, sizeof(MS_ADPCM_ChannelState));
+        } else {
+            decoder->cstate = SDL_calloc(format->channels, sizeof(Sint8));
+        }
+        if (!decoder->cstate) {
+            return -1;
+        }
+        break;
+    case ALAW_CODE:
+    case MULAW_CODE:
+        decoder->inframesize = format->channels;
+        decoder->outframesize = (size_t)format->channels * sizeof(Sint16);
+        break;
+    default:
+        decoder->inframesize = ((size_t)format->channels * format->bitspersample) / 8;
+        if (format->encoding == PCM_CODE && format->bitspersample == 24) {
+            decoder->outframesize = (size_t)format->channels * sizeof(Sint32);
+        } else {
+            decoder->outframesize = decoder->inframesize;
+        }
+        /* The PCM decoder counts blocks, which can be smaller than a sample frame. */
+        file->sampleframes = (file->sampleframes * format->blockalign) / (Sint64)decoder->inframesize;
+        break;
+    }
+
+    if (decoder->inframesize) {
+        decoder->unitframes = (Uint32)SDL_max(WAVE_STREAM_UNIT_SIZE / decoder->inframesize, 1);
+        decoder->unitsize = decoder->unitframes * decoder->inframesize;
+        if (decoder->outframesize != decoder->inframesize) {
+            outputsize = decoder->unitframes * decoder->outframesize;
+        }
+    }
+
+    decoder->input = (Uint8 *)SDL_malloc(decoder->unitsize);
+    if (!decoder->input) {
+        return -1;
+    }
+    if (outputsize) {
+        decoder->output = (Uint8 *)SDL_malloc(outputsize);
+        if (!decoder->output) {
+            return -1;
+        }
+    }
+
+    decoder->srcposition = -1;
+
+    return 0;
+}
+
+SDL_AudioStream *SDL_LoadWAVStream_IO(SDL_IOStream *src, SDL_bool closeio, SDL_AudioSpec *spec)
+{
+    WaveStreamDecoder *decoder;
+    SDL_AudioStream *stream;
+    SDL_PropertiesID props;
+    SDL_AudioSpec wavespec;
+    Sint64 endposition;
+
+    /* Make sure we are passed a valid data source */
+    if (!src) {
+        return NULL;  /* Error may come from SDL_IOStream. */
+    }
+
+    decoder = (WaveStreamDecoder *)SDL_calloc(1, sizeof(*decoder));
+    if (!decoder) {
+        if (closeio) {
+            SDL_CloseIO(src);
+        }
+        return NULL;
+    }
+    decoder->src = src;
+    decoder->closeio = closeio;
+    decoder->file.riffhint = WaveGetRiffSizeHint();
+    decoder->file.trunchint = WaveGetTruncationHint();
+    decoder->file.facthint = WaveGetFactChunkHint();
+
+    if (WaveReadHeaders(src, &decoder->file, &endposition) < 0 ||
+        WaveGetSpec(&decoder->file, &wavespec) < 0 ||
+        WaveStreamSetup(decoder) < 0) {
+        FreeWaveStreamDecoder(decoder);
+        return NULL;
+    }
+
+    stream = SDL_CreateAudioStream(&wavespec, &wavespec);
+    if (!stream) {
+        FreeWaveStreamDecoder(decoder);
+        return NULL;
+    }
+    decoder->stream = stream;
+
+    /* From here on, the decoder is freed along with the stream. */
+    props = SDL_GetAudioStreamProperties(stream);
+    if (!props ||
+        SDL_SetPropertyWithCleanup(props, PROP_AUDIOSTREAM_WAVE_DECODER_POINTER, decoder, CleanupWaveStreamDecoder, NULL) < 0 ||
+        SDL_SetNumberProperty(props, SDL_PROP_AUDIOSTREAM_WAVE_FRAMES_NUMBER, decoder->file.sampleframes) < 0 ||
+        SDL_SetAudioStreamGetCallback(stream, WaveStreamCallback, decoder) < 0) {
+        SDL_DestroyAudioStream(stream);
+        return NULL;
+    }
+
+    if (spec) {
+        SDL_copyp(spec, &wavespec);
+    }
+    return stream;
+}
+
+SDL_AudioStream *SDL_LoadWAVStream(const char *path, SDL_AudioSpec *spec)
+{
+    return SDL_LoadWAVStream_IO(SDL_IOFromFile(path, "rb"), 1, spec);
+}
+
+int SDL_SeekWAVStream(SDL_AudioStream *stream, Uint64 frame)
+{
+    WaveStreamDecoder *decoder;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    SDL_LockAudioStream(stream);
+
+    decoder = (WaveStreamDecoder *)SDL_GetProperty(SDL_GetAudioStreamProperties(stream), PROP_AUDIOSTREAM_WAVE_DECODER_POINTER, NULL);
+    if (!decoder) {
+        SDL_UnlockAudioStream(stream);
+        return SDL_SetError("Audio stream is not a WAVE stream");
+    } else if (frame > (Uint64)decoder->file.sampleframes) {
+        SDL_UnlockAudioStream(stream);
+        return SDL_InvalidParamError("frame");
+    }
+
+    SDL_ClearAudioStream(stream);
+    decoder->frame = (Sint64)frame;
+    decoder->finished = SDL_FALSE;
+    if (decoder->failed) {
+        SDL_ClearProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING);
+        decoder->failed = SDL_FALSE;
+    }
+
+    SDL_UnlockAudioStream(stream);
+    return 0;
+}
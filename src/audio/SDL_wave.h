@@ -148,4 +148,5 @@ typedef struct WaveFile
     WaveRiffSizeHint riffhint;
     WaveTruncationHint trunchint;
     WaveFactChunkHint facthint;
+    int decodethreads; /* Threads for decoding large files, 0 to use the CPU count. */
 } WaveFile;
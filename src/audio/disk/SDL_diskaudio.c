@@ -37,6 +37,9 @@
 
 static int DISKAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
+    if (device->hidden->offline) {
+        return SDL_WaitAudioDeviceOffline(device);
+    }
     SDL_Delay(device->hidden->io_delay);
     return 0;
 }
@@ -122,6 +125,8 @@ static int DISKAUDIO_OpenDevice(SDL_AudioDevice *device)
         device->hidden->io_delay = ((device->sample_frames * 1000) / device->spec.freq);
     }
 
+    device->hidden->offline = !recording && SDL_GetHintBoolean(SDL_HINT_AUDIO_OFFLINE_RENDERING, SDL_FALSE);
+
     // Open the "audio device"
     device->hidden->io = SDL_IOFromFile(fname, recording ? "rb" : "wb");
     if (!device->hidden->io) {
@@ -31,6 +31,7 @@ struct SDL_PrivateAudioData
     SDL_IOStream *io;
     Uint32 io_delay;
     Uint8 *mixbuf;
+    SDL_bool offline;  // SDL_TRUE to render as fast as the bound streams allow, from SDL_HINT_AUDIO_OFFLINE_RENDERING.
 };
 
 #endif // SDL_diskaudio_h_
@@ -30,6 +30,9 @@
 
 static int DUMMYAUDIO_WaitDevice(SDL_AudioDevice *device)
 {
+    if (device->hidden->offline) {
+        return SDL_WaitAudioDeviceOffline(device);
+    }
     SDL_Delay(device->hidden->io_delay);
     return 0;
 }
@@ -51,6 +54,7 @@ static int DUMMYAUDIO_OpenDevice(SDL_AudioDevice *device)
     }
 
     device->hidden->io_delay = (Uint32) (envr ? SDL_atoi(envr) : ((device->sample_frames * 1000) / device->spec.freq));
+    device->hidden->offline = !device->recording && SDL_GetHintBoolean(SDL_HINT_AUDIO_OFFLINE_RENDERING, SDL_FALSE);
 
     return 0; // we're good; don't change reported device format.
 }
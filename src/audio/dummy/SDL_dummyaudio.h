@@ -29,6 +29,7 @@ struct SDL_PrivateAudioData
 {
     Uint8 *mixbuf;   // The file descriptor for the audio device
     Uint32 io_delay; // miliseconds to sleep in WaitDevice.
+    SDL_bool offline; // SDL_TRUE to render as fast as the bound streams allow, from SDL_HINT_AUDIO_OFFLINE_RENDERING.
 };
 
 #endif // SDL_dummyaudio_h_
@@ -1060,3 +1060,23 @@
 #define SDL_wcsnstr SDL_wcsnstr_REAL
 #define SDL_wcsstr SDL_wcsstr_REAL
 #define SDL_wcstol SDL_wcstol_REAL
+#define SDL_PollEvents SDL_PollEvents_REAL
+#define SDL_GetCoalescedEventCount SDL_GetCoalescedEventCount_REAL
+#define SDL_GetPropertyKey SDL_GetPropertyKey_REAL
+#define SDL_SetPropertyByKey SDL_SetPropertyByKey_REAL
+#define SDL_SetStringPropertyByKey SDL_SetStringPropertyByKey_REAL
+#define SDL_SetNumberPropertyByKey SDL_SetNumberPropertyByKey_REAL
+#define SDL_SetFloatPropertyByKey SDL_SetFloatPropertyByKey_REAL
+#define SDL_SetBooleanPropertyByKey SDL_SetBooleanPropertyByKey_REAL
+#define SDL_GetPropertyByKey SDL_GetPropertyByKey_REAL
+#define SDL_GetStringPropertyByKey SDL_GetStringPropertyByKey_REAL
+#define SDL_GetNumberPropertyByKey SDL_GetNumberPropertyByKey_REAL
+#define SDL_GetFloatPropertyByKey SDL_GetFloatPropertyByKey_REAL
+#define SDL_GetBooleanPropertyByKey SDL_GetBooleanPropertyByKey_REAL
+#define SDL_GetAudioStreamGain SDL_GetAudioStreamGain_REAL
+#define SDL_SetAudioStreamGain SDL_SetAudioStreamGain_REAL
+#define SDL_PutAudioStreamBuffer SDL_PutAudioStreamBuffer_REAL
+#define SDL_LoadWAVStream_IO SDL_LoadWAVStream_IO_REAL
+#define SDL_LoadWAVStream SDL_LoadWAVStream_REAL
+#define SDL_SeekWAVStream SDL_SeekWAVStream_REAL
+#define SDL_GetAudioDeviceProperties SDL_GetAudioDeviceProperties_REAL
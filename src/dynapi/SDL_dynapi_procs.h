@@ -1066,3 +1066,23 @@ SDL_DYNAPI_PROC(size_t,SDL_wcsnlen,(const wchar_t *a, size_t b),(a,b),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsnstr,(const wchar_t *a, const wchar_t *b, size_t c),(a,b,c),return)
 SDL_DYNAPI_PROC(wchar_t*,SDL_wcsstr,(const wchar_t *a, const wchar_t *b),(a,b),return)
 SDL_DYNAPI_PROC(long,SDL_wcstol,(const wchar_t *a, wchar_t **b, int c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_PollEvents,(SDL_Event *a, int b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_GetCoalescedEventCount,(Uint32 a),(a),return)
+SDL_DYNAPI_PROC(SDL_PropertyKey,SDL_GetPropertyKey,(const char *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SetStringPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SetNumberPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SetFloatPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(int,SDL_SetBooleanPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(void*,SDL_GetPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, void *c),(a,b,c),return)
+SDL_DYNAPI_PROC(const char*,SDL_GetStringPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, const char *c),(a,b,c),return)
+SDL_DYNAPI_PROC(Sint64,SDL_GetNumberPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, Sint64 c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetFloatPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, float c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_bool,SDL_GetBooleanPropertyByKey,(SDL_PropertiesID a, SDL_PropertyKey b, SDL_bool c),(a,b,c),return)
+SDL_DYNAPI_PROC(float,SDL_GetAudioStreamGain,(SDL_AudioStream *a),(a),return)
+SDL_DYNAPI_PROC(int,SDL_SetAudioStreamGain,(SDL_AudioStream *a, float b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_PutAudioStreamBuffer,(SDL_AudioStream *a, const void *b, int c, SDL_ReleaseAudioBufferCallback d, void *e),(a,b,c,d,e),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_LoadWAVStream_IO,(SDL_IOStream *a, SDL_bool b, SDL_AudioSpec *c),(a,b,c),return)
+SDL_DYNAPI_PROC(SDL_AudioStream*,SDL_LoadWAVStream,(const char *a, SDL_AudioSpec *b),(a,b),return)
+SDL_DYNAPI_PROC(int,SDL_SeekWAVStream,(SDL_AudioStream *a, Uint64 b),(a,b),return)
+SDL_DYNAPI_PROC(SDL_PropertiesID,SDL_GetAudioDeviceProperties,(SDL_AudioDeviceID a),(a),return)
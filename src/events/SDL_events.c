@@ -61,7 +61,8 @@ static int SDL_event_watchers_count = 0;
 static SDL_bool SDL_event_watchers_dispatching = SDL_FALSE;
 static SDL_bool SDL_event_watchers_removed = SDL_FALSE;
 static SDL_AtomicInt SDL_sentinel_pending;
-static Uint32 SDL_last_event_id = 0;
+static SDL_bool SDL_poll_cycle_ended = SDL_FALSE;
+static SDL_AtomicInt SDL_last_event_id;
 
 typedef struct
 {
@@ -72,23 +73,91 @@ static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static Uint32 SDL_userevents = SDL_EVENT_USER;
 
 /* Private data -- event queue */
+
+/* The number of slots in the lock-free ring, this must be a power of two */
+#define SDL_EVENT_RING_SIZE 1024
+
+/* Events are bucketed by the high byte of their type, the same way SDL_disabled_events is */
+#define SDL_EVENT_CATEGORY(type) (((type) >> 8) & 0xff)
+#define SDL_NUM_EVENT_CATEGORIES 256
+
 typedef struct SDL_EventEntry
 {
     SDL_Event event;
+    Uint32 sequence;
     struct SDL_EventEntry *prev;
     struct SDL_EventEntry *next;
+    struct SDL_EventEntry *category_prev;
+    struct SDL_EventEntry *category_next;
 } SDL_EventEntry;
 
+/* A slot in the ring, the sequence tells producers and the consumer who owns it */
+typedef struct SDL_EventSlot
+{
+    SDL_AtomicInt sequence;
+    SDL_Event event;
+} SDL_EventSlot;
+
+/* Producers publish into the ring without taking the lock.
+   Consumers hold the lock and pop from the ring, or move its contents
+   into the linked list when they need to look past the oldest event.
+   Everything in the list is always older than everything in the ring.
+   Producers count themselves in while they use the ring, so it isn't
+   freed out from under them when the event loop stops.
+
+   Each list entry is also linked into a list for its category, and the
+   sequence number lets a type-range query merge those back into queue
+   order, so it only visits events that could match.
+   The category counts include events still in the ring.
+ */
 static struct
 {
     SDL_Mutex *lock;
-    SDL_bool active;
+    SDL_AtomicInt active;
+    SDL_AtomicInt producers;
     SDL_AtomicInt count;
-    int max_events_seen;
+    SDL_AtomicInt max_events_seen;
+    SDL_EventSlot *ring;
+    SDL_AtomicInt ring_tail;
+    Uint32 ring_head;
+    Uint32 sequence;
     SDL_EventEntry *head;
     SDL_EventEntry *tail;
     SDL_EventEntry *free;
-} SDL_EventQ = { NULL, SDL_FALSE, { 0 }, 0, NULL, NULL, NULL };
+    SDL_EventEntry *category_head[SDL_NUM_EVENT_CATEGORIES];
+    SDL_EventEntry *category_tail[SDL_NUM_EVENT_CATEGORIES];
+    SDL_AtomicInt category_count[SDL_NUM_EVENT_CATEGORIES];
+} SDL_EventQ;
+
+/* Ranges wider than this just walk the whole queue, most events will match anyway */
+#define SDL_MAX_CURSOR_CATEGORIES 16
+
+/* Walks the queued events of one or more categories, oldest first */
+typedef struct SDL_EventCursor
+{
+    SDL_bool all_categories;
+    int num_categories;
+    SDL_EventEntry *next[SDL_MAX_CURSOR_CATEGORIES];
+} SDL_EventCursor;
+
+/* Event memory comes out of a bump arena made of blocks, each tagged with
+   the last event ID it handed memory out for. Once the event queue has
+   moved past that ID the whole block is recycled at once.
+   Pointers queued with SDL_FreeLater() are tracked by nodes in the arena.
+ */
+#define SDL_EVENT_ARENA_BLOCK_SIZE  4096
+#define SDL_EVENT_ARENA_ALIGN       16
+#define SDL_EVENT_ARENA_MAX_SPARES  8
+
+typedef struct SDL_EventArenaBlock
+{
+    struct SDL_EventArenaBlock *next;
+    Uint32 eventID;
+    size_t size;
+    size_t used;
+} SDL_EventArenaBlock;
+
+#define SDL_EVENT_ARENA_HEADER_SIZE ((sizeof(SDL_EventArenaBlock) + (SDL_EVENT_ARENA_ALIGN - 1)) & ~(size_t)(SDL_EVENT_ARENA_ALIGN - 1))
 
 typedef struct SDL_EventMemory
 {
@@ -97,77 +166,183 @@ typedef struct SDL_EventMemory
     struct SDL_EventMemory *next;
 } SDL_EventMemory;
 
-static SDL_Mutex *SDL_event_memory_lock;
+static SDL_SpinLock SDL_event_memory_lock;
+static SDL_EventArenaBlock *SDL_event_arena_head;
+static SDL_EventArenaBlock *SDL_event_arena_tail;
+static SDL_EventArenaBlock *SDL_event_arena_spares;
+static int SDL_event_arena_num_spares;
 static SDL_EventMemory *SDL_event_memory_head;
 static SDL_EventMemory *SDL_event_memory_tail;
 
+/* Carve memory for the current event out of the arena -- called with the memory locked */
+static void *SDL_AllocateEventArena(size_t size, Uint32 eventID)
+{
+    SDL_EventArenaBlock *block = SDL_event_arena_tail;
+    void *memory;
+
+    size = (size + (SDL_EVENT_ARENA_ALIGN - 1)) & ~(size_t)(SDL_EVENT_ARENA_ALIGN - 1);
+    if (size == 0) {
+        size = SDL_EVENT_ARENA_ALIGN;
+    }
+
+    if (!block || (block->size - block->used) < size) {
+        if (size <= SDL_EVENT_ARENA_BLOCK_SIZE && SDL_event_arena_spares) {
+            block = SDL_event_arena_spares;
+            SDL_event_arena_spares = block->next;
+            --SDL_event_arena_num_spares;
+        } else {
+            const size_t block_size = SDL_max(size, SDL_EVENT_ARENA_BLOCK_SIZE);
+
+            block = (SDL_EventArenaBlock *)SDL_malloc(SDL_EVENT_ARENA_HEADER_SIZE + block_size);
+            if (!block) {
+                return NULL;
+            }
+            block->size = block_size;
+        }
+        block->next = NULL;
+        block->used = 0;
+
+        if (SDL_event_arena_tail) {
+            SDL_event_arena_tail->next = block;
+        } else {
+            SDL_event_arena_head = block;
+        }
+        SDL_event_arena_tail = block;
+    }
+
+    memory = (Uint8 *)block + SDL_EVENT_ARENA_HEADER_SIZE + block->used;
+    block->used += size;
+    block->eventID = eventID;
+    return memory;
+}
+
 void *SDL_FreeLater(void *memory)
 {
+    SDL_EventMemory *entry;
+
     if (memory == NULL) {
         return NULL;
     }
 
-    SDL_EventMemory *entry = (SDL_EventMemory *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
-        return memory;  // this is now a leak, but you probably have bigger problems if malloc failed. We could probably pool up and reuse entries, though.
-    }
-
-    SDL_LockMutex(SDL_event_memory_lock);
+    SDL_LockSpinlock(&SDL_event_memory_lock);
     {
-        entry->eventID = SDL_last_event_id;
-        entry->memory = memory;
-        entry->next = NULL;
+        const Uint32 eventID = (Uint32)SDL_AtomicGet(&SDL_last_event_id);
 
-        if (SDL_event_memory_tail) {
-            SDL_event_memory_tail->next = entry;
-        } else {
-            SDL_event_memory_head = entry;
+        entry = (SDL_EventMemory *)SDL_AllocateEventArena(sizeof(*entry), eventID);
+        if (entry) {
+            entry->eventID = eventID;
+            entry->memory = memory;
+            entry->next = NULL;
+
+            if (SDL_event_memory_tail) {
+                SDL_event_memory_tail->next = entry;
+            } else {
+                SDL_event_memory_head = entry;
+            }
+            SDL_event_memory_tail = entry;
         }
-        SDL_event_memory_tail = entry;
     }
-    SDL_UnlockMutex(SDL_event_memory_lock);
+    SDL_UnlockSpinlock(&SDL_event_memory_lock);
 
+    // if this failed it's now a leak, but you probably have bigger problems if malloc failed.
     return memory;
 }
 
 void *SDL_AllocateEventMemory(size_t size)
 {
-    return SDL_FreeLater(SDL_malloc(size));
+    void *memory;
+
+    SDL_LockSpinlock(&SDL_event_memory_lock);
+    {
+        memory = SDL_AllocateEventArena(size, (Uint32)SDL_AtomicGet(&SDL_last_event_id));
+    }
+    SDL_UnlockSpinlock(&SDL_event_memory_lock);
+
+    return memory;
 }
 
 const char *SDL_AllocateEventString(const char *string)
 {
     if (string) {
-        return SDL_FreeLater(SDL_strdup(string));
+        const size_t len = SDL_strlen(string) + 1;
+        char *copy = (char *)SDL_AllocateEventMemory(len);
+
+        if (copy) {
+            SDL_memcpy(copy, string, len);
+        }
+        return copy;
     }
     return NULL;
 }
 
 static void SDL_FlushEventMemory(Uint32 eventID)
 {
-    SDL_LockMutex(SDL_event_memory_lock);
+    SDL_EventArenaBlock *blocks = NULL, *block;
+
+    SDL_LockSpinlock(&SDL_event_memory_lock);
     {
-        if (SDL_event_memory_head) {
-            while (SDL_event_memory_head) {
-                SDL_EventMemory *entry = SDL_event_memory_head;
+        /* The nodes live in the arena, so these have to go before the blocks are recycled */
+        while (SDL_event_memory_head) {
+            SDL_EventMemory *entry = SDL_event_memory_head;
 
-                if (eventID && (Sint32)(eventID - entry->eventID) < 0) {
-                    break;
-                }
+            if (eventID && (Sint32)(eventID - entry->eventID) < 0) {
+                break;
+            }
 
-                /* If you crash here, your application has memory corruption
-                 * or freed memory in an event, which is no longer necessary.
-                 */
-                SDL_event_memory_head = entry->next;
-                SDL_free(entry->memory);
-                SDL_free(entry);
+            /* If you crash here, your application has memory corruption
+             * or freed memory in an event, which is no longer necessary.
+             */
+            SDL_event_memory_head = entry->next;
+            SDL_free(entry->memory);
+        }
+        if (!SDL_event_memory_head) {
+            SDL_event_memory_tail = NULL;
+        }
+
+        while (SDL_event_arena_head) {
+            block = SDL_event_arena_head;
+
+            if (eventID && (Sint32)(eventID - block->eventID) < 0) {
+                break;
+            }
+            if (block == SDL_event_arena_tail && eventID) {
+                /* Keep the block we're allocating from, it's empty again */
+                block->used = 0;
+                break;
             }
-            if (!SDL_event_memory_head) {
-                SDL_event_memory_tail = NULL;
+            SDL_event_arena_head = block->next;
+            if (block->size == SDL_EVENT_ARENA_BLOCK_SIZE && SDL_event_arena_num_spares < SDL_EVENT_ARENA_MAX_SPARES) {
+                block->next = SDL_event_arena_spares;
+                SDL_event_arena_spares = block;
+                ++SDL_event_arena_num_spares;
+            } else {
+                block->next = blocks;
+                blocks = block;
+            }
+        }
+        if (!SDL_event_arena_head) {
+            SDL_event_arena_tail = NULL;
+        }
+
+        if (!eventID) {
+            /* We're shutting down, release the spare blocks too */
+            while (SDL_event_arena_spares) {
+                block = SDL_event_arena_spares;
+                SDL_event_arena_spares = block->next;
+                block->next = blocks;
+                blocks = block;
             }
+            SDL_event_arena_num_spares = 0;
         }
     }
-    SDL_UnlockMutex(SDL_event_memory_lock);
+    SDL_UnlockSpinlock(&SDL_event_memory_lock);
+
+    /* Nothing can reach these anymore, free them outside the lock */
+    while (blocks) {
+        block = blocks;
+        blocks = block->next;
+        SDL_free(block);
+    }
 }
 
 #ifndef SDL_JOYSTICK_DISABLED
@@ -197,6 +372,28 @@ static void SDLCALL SDL_PollSentinelChanged(void *userdata, const char *name, co
     SDL_SetEventEnabled(SDL_EVENT_POLL_SENTINEL, SDL_GetStringBoolean(hint, SDL_TRUE));
 }
 
+static SDL_bool SDL_coalesce_motion = SDL_FALSE;
+static SDL_AtomicInt SDL_coalesced_events[3];
+
+static void SDLCALL SDL_CoalesceMotionChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    SDL_coalesce_motion = SDL_GetStringBoolean(hint, SDL_FALSE);
+}
+
+static SDL_AtomicInt *SDL_GetCoalescedEventCounter(Uint32 type)
+{
+    switch (type) {
+    case SDL_EVENT_MOUSE_MOTION:
+        return &SDL_coalesced_events[0];
+    case SDL_EVENT_PEN_MOTION:
+        return &SDL_coalesced_events[1];
+    case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+        return &SDL_coalesced_events[2];
+    default:
+        return NULL;
+    }
+}
+
 /**
  * Verbosity of logged events as defined in SDL_HINT_EVENT_LOGGING:
  *  - 0: (default) no logging
@@ -654,13 +851,22 @@ void SDL_StopEventLoop(void)
     int i;
     SDL_EventEntry *entry;
 
-    SDL_LockMutex(SDL_EventQ.lock);
+    SDL_AtomicSet(&SDL_EventQ.active, 0);
 
-    SDL_EventQ.active = SDL_FALSE;
+    /* Wait for producers that got in before we stopped to finish with the ring */
+    while (SDL_AtomicGet(&SDL_EventQ.producers) > 0) {
+        SDL_Delay(0);
+    }
+
+    SDL_LockMutex(SDL_EventQ.lock);
 
     if (report && SDL_atoi(report)) {
         SDL_Log("SDL EVENT QUEUE: Maximum events in-flight: %d\n",
-                SDL_EventQ.max_events_seen);
+                SDL_AtomicGet(&SDL_EventQ.max_events_seen));
+        SDL_Log("SDL EVENT QUEUE: Coalesced mouse motion: %d, pen motion: %d, sensor updates: %d\n",
+                SDL_AtomicGet(&SDL_coalesced_events[0]),
+                SDL_AtomicGet(&SDL_coalesced_events[1]),
+                SDL_AtomicGet(&SDL_coalesced_events[2]));
     }
 
     /* Clean out EventQ */
@@ -675,12 +881,24 @@ void SDL_StopEventLoop(void)
         entry = next;
     }
 
+    SDL_free(SDL_EventQ.ring);
+    SDL_EventQ.ring = NULL;
+
     SDL_AtomicSet(&SDL_EventQ.count, 0);
-    SDL_EventQ.max_events_seen = 0;
+    SDL_AtomicSet(&SDL_EventQ.max_events_seen, 0);
     SDL_EventQ.head = NULL;
     SDL_EventQ.tail = NULL;
     SDL_EventQ.free = NULL;
+    for (i = 0; i < SDL_NUM_EVENT_CATEGORIES; ++i) {
+        SDL_EventQ.category_head[i] = NULL;
+        SDL_EventQ.category_tail[i] = NULL;
+        SDL_AtomicSet(&SDL_EventQ.category_count[i], 0);
+    }
     SDL_AtomicSet(&SDL_sentinel_pending, 0);
+    SDL_poll_cycle_ended = SDL_FALSE;
+    for (i = 0; i < SDL_arraysize(SDL_coalesced_events); ++i) {
+        SDL_AtomicSet(&SDL_coalesced_events[i], 0);
+    }
 
     SDL_FlushEventMemory(0);
 
@@ -690,10 +908,6 @@ void SDL_StopEventLoop(void)
         SDL_disabled_events[i] = NULL;
     }
 
-    if (SDL_event_memory_lock) {
-        SDL_DestroyMutex(SDL_event_memory_lock);
-        SDL_event_memory_lock = NULL;
-    }
     if (SDL_event_watchers_lock) {
         SDL_DestroyMutex(SDL_event_watchers_lock);
         SDL_event_watchers_lock = NULL;
@@ -740,70 +954,279 @@ int SDL_StartEventLoop(void)
         }
     }
 
-    if (SDL_event_memory_lock == NULL) {
-        SDL_event_memory_lock = SDL_CreateMutex();
-        if (SDL_event_memory_lock == NULL) {
+#endif /* !SDL_THREADS_DISABLED */
+
+    if (!SDL_EventQ.ring) {
+        Uint32 i;
+
+        SDL_EventQ.ring = (SDL_EventSlot *)SDL_malloc(SDL_EVENT_RING_SIZE * sizeof(*SDL_EventQ.ring));
+        if (!SDL_EventQ.ring) {
             SDL_UnlockMutex(SDL_EventQ.lock);
             return -1;
         }
+        for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+            SDL_AtomicSet(&SDL_EventQ.ring[i].sequence, (int)i);
+        }
+        SDL_AtomicSet(&SDL_EventQ.ring_tail, 0);
+        SDL_EventQ.ring_head = 0;
     }
-#endif /* !SDL_THREADS_DISABLED */
 
-    SDL_EventQ.active = SDL_TRUE;
+    SDL_AtomicSet(&SDL_EventQ.active, 1);
     SDL_UnlockMutex(SDL_EventQ.lock);
     return 0;
 }
 
-/* Add an event to the event queue -- called with the queue locked */
-static int SDL_AddEvent(SDL_Event *event)
+/* Claim a ring slot and publish the event into it -- safe to call without the queue locked */
+static SDL_bool SDL_TryPublishEvent(const SDL_Event *event)
 {
-    SDL_EventEntry *entry;
-    const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
-    int final_count;
+    SDL_EventSlot *slot;
+    Uint32 pos = (Uint32)SDL_AtomicGet(&SDL_EventQ.ring_tail);
 
-    if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
-        SDL_SetError("Event queue is full (%d events)", initial_count);
-        return 0;
+    for (;;) {
+        Sint32 diff;
+
+        slot = &SDL_EventQ.ring[pos & (SDL_EVENT_RING_SIZE - 1)];
+        diff = (Sint32)((Uint32)SDL_AtomicGet(&slot->sequence) - pos);
+        if (diff == 0) {
+            if (SDL_AtomicCompareAndSwap(&SDL_EventQ.ring_tail, (int)pos, (int)(pos + 1))) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* The consumer hasn't caught up with this slot yet, the ring is full */
+            return SDL_FALSE;
+        }
+        pos = (Uint32)SDL_AtomicGet(&SDL_EventQ.ring_tail);
     }
 
-    if (SDL_EventQ.free == NULL) {
-        entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
-        if (entry == NULL) {
-            return 0;
+    SDL_copyp(&slot->event, event);
+    SDL_AtomicSet(&slot->sequence, (int)(pos + 1));
+    return SDL_TRUE;
+}
+
+/* Get the oldest published ring slot, or NULL if there isn't one -- called with the queue locked */
+static SDL_EventSlot *SDL_PeekEventSlot(void)
+{
+    SDL_EventSlot *slot = &SDL_EventQ.ring[SDL_EventQ.ring_head & (SDL_EVENT_RING_SIZE - 1)];
+
+    if ((Uint32)SDL_AtomicGet(&slot->sequence) != SDL_EventQ.ring_head + 1) {
+        return NULL;
+    }
+    return slot;
+}
+
+/* Hand the oldest ring slot back to the producers -- called with the queue locked */
+static void SDL_ReleaseEventSlot(SDL_EventSlot *slot)
+{
+    SDL_AtomicSet(&slot->sequence, (int)(SDL_EventQ.ring_head + SDL_EVENT_RING_SIZE));
+    ++SDL_EventQ.ring_head;
+}
+
+/* Move the published ring events to the end of the list -- called with the queue locked */
+static SDL_bool SDL_DrainEventRing(void)
+{
+    SDL_EventSlot *slot;
+    int category;
+
+    if (!SDL_EventQ.ring) {
+        return SDL_TRUE;
+    }
+
+    while ((slot = SDL_PeekEventSlot()) != NULL) {
+        SDL_EventEntry *entry;
+
+        if (SDL_EventQ.free == NULL) {
+            entry = (SDL_EventEntry *)SDL_malloc(sizeof(*entry));
+            if (entry == NULL) {
+                return SDL_FALSE;
+            }
+        } else {
+            entry = SDL_EventQ.free;
+            SDL_EventQ.free = entry->next;
+        }
+
+        SDL_copyp(&entry->event, &slot->event);
+        SDL_ReleaseEventSlot(slot);
+        entry->sequence = SDL_EventQ.sequence++;
+
+        if (SDL_EventQ.tail) {
+            SDL_EventQ.tail->next = entry;
+            entry->prev = SDL_EventQ.tail;
+            SDL_EventQ.tail = entry;
+            entry->next = NULL;
+        } else {
+            SDL_assert(!SDL_EventQ.head);
+            SDL_EventQ.head = entry;
+            SDL_EventQ.tail = entry;
+            entry->prev = NULL;
+            entry->next = NULL;
+        }
+
+        category = SDL_EVENT_CATEGORY(entry->event.type);
+        if (SDL_EventQ.category_tail[category]) {
+            SDL_EventQ.category_tail[category]->category_next = entry;
+            entry->category_prev = SDL_EventQ.category_tail[category];
+            SDL_EventQ.category_tail[category] = entry;
+            entry->category_next = NULL;
+        } else {
+            SDL_assert(!SDL_EventQ.category_head[category]);
+            SDL_EventQ.category_head[category] = entry;
+            SDL_EventQ.category_tail[category] = entry;
+            entry->category_prev = NULL;
+            entry->category_next = NULL;
         }
+    }
+    return SDL_TRUE;
+}
+
+/* Get the range of categories that events of type [minType, maxType] fall in */
+static SDL_bool SDL_GetEventCategories(Uint32 minType, Uint32 maxType, int *first, int *last)
+{
+    if (minType > maxType) {
+        return SDL_FALSE;
+    }
+    if (maxType > SDL_EVENT_LAST) {
+        /* Types past SDL_EVENT_LAST wrap around into every category */
+        *first = 0;
+        *last = SDL_NUM_EVENT_CATEGORIES - 1;
     } else {
-        entry = SDL_EventQ.free;
-        SDL_EventQ.free = entry->next;
+        *first = SDL_EVENT_CATEGORY(minType);
+        *last = SDL_EVENT_CATEGORY(maxType);
+    }
+    return SDL_TRUE;
+}
+
+/* Check whether any event in [minType, maxType] might be queued, without looking at the queue */
+static SDL_bool SDL_EventsMaybeQueued(Uint32 minType, Uint32 maxType)
+{
+    int i, first, last;
+
+    if (!SDL_GetEventCategories(minType, maxType, &first, &last)) {
+        return SDL_FALSE;
+    }
+    if ((last - first) >= SDL_MAX_CURSOR_CATEGORIES) {
+        return (SDL_AtomicGet(&SDL_EventQ.count) > 0);
+    }
+    for (i = first; i <= last; ++i) {
+        if (SDL_AtomicGet(&SDL_EventQ.category_count[i]) > 0) {
+            return SDL_TRUE;
+        }
+    }
+    return SDL_FALSE;
+}
+
+/* Start walking the listed events that might be in [minType, maxType] -- called with the queue locked */
+static void SDL_StartEventCursor(SDL_EventCursor *cursor, Uint32 minType, Uint32 maxType)
+{
+    int i, first, last;
+
+    cursor->all_categories = SDL_FALSE;
+    cursor->num_categories = 0;
+    if (!SDL_GetEventCategories(minType, maxType, &first, &last)) {
+        return;
+    }
+    if ((last - first) >= SDL_MAX_CURSOR_CATEGORIES) {
+        cursor->all_categories = SDL_TRUE;
+        cursor->next[0] = SDL_EventQ.head;
+        return;
+    }
+    for (i = first; i <= last; ++i) {
+        if (SDL_EventQ.category_head[i]) {
+            cursor->next[cursor->num_categories++] = SDL_EventQ.category_head[i];
+        }
+    }
+}
+
+/* Get the next oldest event, which may be safely cut from the queue -- called with the queue locked */
+static SDL_EventEntry *SDL_NextEventCursor(SDL_EventCursor *cursor)
+{
+    SDL_EventEntry *entry;
+    int i, oldest = -1;
+
+    if (cursor->all_categories) {
+        entry = cursor->next[0];
+        if (entry) {
+            cursor->next[0] = entry->next;
+        }
+        return entry;
+    }
+
+    for (i = 0; i < cursor->num_categories; ++i) {
+        if (cursor->next[i] &&
+            (oldest < 0 || (Sint32)(cursor->next[i]->sequence - cursor->next[oldest]->sequence) < 0)) {
+            oldest = i;
+        }
+    }
+    if (oldest < 0) {
+        return NULL;
+    }
+
+    entry = cursor->next[oldest];
+    cursor->next[oldest] = entry->category_next;
+    return entry;
+}
+
+/* Add an event to the event queue -- called without the queue locked */
+static int SDL_AddEvent(SDL_Event *event)
+{
+    const int final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
+    int max_events_seen;
+    int iterations = 0;
+
+    if (final_count > SDL_MAX_QUEUED_EVENTS) {
+        SDL_AtomicAdd(&SDL_EventQ.count, -1);
+        SDL_SetError("Event queue is full (%d events)", final_count - 1);
+        return 0;
     }
 
     if (SDL_EventLoggingVerbosity > 0) {
         SDL_LogEvent(event);
     }
 
-    SDL_copyp(&entry->event, event);
     if (event->type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AtomicAdd(&SDL_sentinel_pending, 1);
     }
+    SDL_AtomicAdd(&SDL_EventQ.category_count[SDL_EVENT_CATEGORY(event->type)], 1);
 
-    if (SDL_EventQ.tail) {
-        SDL_EventQ.tail->next = entry;
-        entry->prev = SDL_EventQ.tail;
-        SDL_EventQ.tail = entry;
-        entry->next = NULL;
-    } else {
-        SDL_assert(!SDL_EventQ.head);
-        SDL_EventQ.head = entry;
-        SDL_EventQ.tail = entry;
-        entry->prev = NULL;
-        entry->next = NULL;
+    while (!SDL_TryPublishEvent(event)) {
+        SDL_bool drained = SDL_FALSE;
+        Uint32 moved = 0;
+
+        /* The ring is full, move what's in it to the list and try again */
+        SDL_LockMutex(SDL_EventQ.lock);
+        if (SDL_AtomicGet(&SDL_EventQ.active)) {
+            const Uint32 ring_head = SDL_EventQ.ring_head;
+            drained = SDL_DrainEventRing();
+            moved = SDL_EventQ.ring_head - ring_head;
+        }
+        SDL_UnlockMutex(SDL_EventQ.lock);
+
+        if (!drained) {
+            if (event->type == SDL_EVENT_POLL_SENTINEL) {
+                SDL_AtomicAdd(&SDL_sentinel_pending, -1);
+            }
+            SDL_AtomicAdd(&SDL_EventQ.category_count[SDL_EVENT_CATEGORY(event->type)], -1);
+            SDL_AtomicAdd(&SDL_EventQ.count, -1);
+            return 0;
+        }
+
+        if (moved > 0) {
+            iterations = 0;
+        } else if (iterations < 32) {
+            /* Another producer has claimed the oldest slot but not published it yet */
+            ++iterations;
+            SDL_CPUPauseInstruction();
+        } else {
+            SDL_Delay(0);
+        }
     }
 
-    final_count = SDL_AtomicAdd(&SDL_EventQ.count, 1) + 1;
-    if (final_count > SDL_EventQ.max_events_seen) {
-        SDL_EventQ.max_events_seen = final_count;
+    max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
+    while (final_count > max_events_seen &&
+           !SDL_AtomicCompareAndSwap(&SDL_EventQ.max_events_seen, max_events_seen, final_count)) {
+        max_events_seen = SDL_AtomicGet(&SDL_EventQ.max_events_seen);
     }
 
-    ++SDL_last_event_id;
+    SDL_AtomicIncRef(&SDL_last_event_id);
 
     return 1;
 }
@@ -811,6 +1234,8 @@ static int SDL_AddEvent(SDL_Event *event)
 /* Remove an event from the queue -- called with the queue locked */
 static void SDL_CutEvent(SDL_EventEntry *entry)
 {
+    const int category = SDL_EVENT_CATEGORY(entry->event.type);
+
     if (entry->prev) {
         entry->prev->next = entry->next;
     }
@@ -827,6 +1252,18 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
         SDL_EventQ.tail = entry->prev;
     }
 
+    if (entry->category_prev) {
+        entry->category_prev->category_next = entry->category_next;
+    } else {
+        SDL_EventQ.category_head[category] = entry->category_next;
+    }
+    if (entry->category_next) {
+        entry->category_next->category_prev = entry->category_prev;
+    } else {
+        SDL_EventQ.category_tail[category] = entry->category_prev;
+    }
+    SDL_AtomicAdd(&SDL_EventQ.category_count[category], -1);
+
     if (entry->event.type == SDL_EVENT_POLL_SENTINEL) {
         SDL_AtomicAdd(&SDL_sentinel_pending, -1);
     }
@@ -837,6 +1274,65 @@ static void SDL_CutEvent(SDL_EventEntry *entry)
     SDL_AtomicAdd(&SDL_EventQ.count, -1);
 }
 
+/* Fold a motion event into the last queued event, if they're from the same source */
+static SDL_bool SDL_CoalesceEvent(const SDL_Event *event)
+{
+    SDL_bool coalesced = SDL_FALSE;
+
+    SDL_LockMutex(SDL_EventQ.lock);
+    if (SDL_AtomicGet(&SDL_EventQ.active)) {
+        SDL_EventEntry *last;
+
+        /* Make sure the list ends with the most recent event */
+        SDL_DrainEventRing();
+
+        last = SDL_EventQ.tail;
+        if (last && last->event.type == event->type) {
+            switch (event->type) {
+            case SDL_EVENT_MOUSE_MOTION:
+                if (last->event.motion.windowID == event->motion.windowID &&
+                    last->event.motion.which == event->motion.which &&
+                    last->event.motion.state == event->motion.state) {
+                    last->event.common.timestamp = event->common.timestamp;
+                    last->event.motion.x = event->motion.x;
+                    last->event.motion.y = event->motion.y;
+                    last->event.motion.xrel += event->motion.xrel;
+                    last->event.motion.yrel += event->motion.yrel;
+                    coalesced = SDL_TRUE;
+                }
+                break;
+            case SDL_EVENT_PEN_MOTION:
+                if (last->event.pmotion.windowID == event->pmotion.windowID &&
+                    last->event.pmotion.which == event->pmotion.which &&
+                    last->event.pmotion.pen_state == event->pmotion.pen_state) {
+                    SDL_copyp(&last->event, event);
+                    coalesced = SDL_TRUE;
+                }
+                break;
+            case SDL_EVENT_GAMEPAD_SENSOR_UPDATE:
+                if (last->event.gsensor.which == event->gsensor.which &&
+                    last->event.gsensor.sensor == event->gsensor.sensor) {
+                    SDL_copyp(&last->event, event);
+                    coalesced = SDL_TRUE;
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+    SDL_UnlockMutex(SDL_EventQ.lock);
+
+    if (coalesced) {
+        SDL_AtomicIncRef(SDL_GetCoalescedEventCounter(event->type));
+
+        if (SDL_EventLoggingVerbosity > 0) {
+            SDL_LogEvent(event);
+        }
+    }
+    return coalesced;
+}
+
 static int SDL_SendWakeupEvent(void)
 {
     SDL_VideoDevice *_this = SDL_GetVideoDevice();
@@ -864,34 +1360,88 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
 {
     int i, used, sentinels_expected = 0;
 
-    /* Lock the event queue */
     used = 0;
 
-    SDL_LockMutex(SDL_EventQ.lock);
-    {
-        /* Don't look after we've quit */
-        if (!SDL_EventQ.active) {
-            /* We get a few spurious events at shutdown, so don't warn then */
-            if (action == SDL_GETEVENT) {
-                SDL_SetError("The event system has been shut down");
-            }
-            SDL_UnlockMutex(SDL_EventQ.lock);
+    if (action == SDL_ADDEVENT) {
+        /* Adding events doesn't need the lock, producers publish straight into the ring */
+        SDL_AtomicIncRef(&SDL_EventQ.producers);
+        if (!SDL_AtomicGet(&SDL_EventQ.active)) {
+            SDL_AtomicDecRef(&SDL_EventQ.producers);
             return -1;
         }
-        if (action == SDL_ADDEVENT) {
-            if (!events) {
+        if (!events) {
+            SDL_AtomicDecRef(&SDL_EventQ.producers);
+            return SDL_InvalidParamError("events");
+        }
+        for (i = 0; i < numevents; ++i) {
+            used += SDL_AddEvent(&events[i]);
+        }
+        SDL_AtomicDecRef(&SDL_EventQ.producers);
+    } else {
+        if (SDL_AtomicGet(&SDL_EventQ.active) && !SDL_EventsMaybeQueued(minType, maxType)) {
+            /* Nothing of these types is queued, don't bother taking the lock */
+            return 0;
+        }
+
+        /* Lock the event queue */
+        SDL_LockMutex(SDL_EventQ.lock);
+        {
+            SDL_EventCursor cursor;
+            SDL_EventEntry *entry;
+            Uint32 type;
+
+            /* Don't look after we've quit */
+            if (!SDL_AtomicGet(&SDL_EventQ.active)) {
+                /* We get a few spurious events at shutdown, so don't warn then */
+                if (action == SDL_GETEVENT) {
+                    SDL_SetError("The event system has been shut down");
+                }
                 SDL_UnlockMutex(SDL_EventQ.lock);
-                return SDL_InvalidParamError("events");
+                return -1;
             }
-            for (i = 0; i < numevents; ++i) {
-                used += SDL_AddEvent(&events[i]);
+
+            if (action == SDL_GETEVENT && events && !SDL_EventQ.head) {
+                SDL_EventSlot *slot;
+                SDL_bool end_of_cycle = SDL_FALSE;
+
+                /* Nothing has been moved to the list, so pop straight off the ring */
+                while (used < numevents && (slot = SDL_PeekEventSlot()) != NULL) {
+                    type = slot->event.type;
+                    if (type < minType || type > maxType) {
+                        break;
+                    }
+                    SDL_copyp(&events[used], &slot->event);
+                    SDL_ReleaseEventSlot(slot);
+                    SDL_AtomicAdd(&SDL_EventQ.category_count[SDL_EVENT_CATEGORY(type)], -1);
+                    SDL_assert(SDL_AtomicGet(&SDL_EventQ.count) > 0);
+                    SDL_AtomicAdd(&SDL_EventQ.count, -1);
+
+                    if (type == SDL_EVENT_POLL_SENTINEL) {
+                        SDL_AtomicAdd(&SDL_sentinel_pending, -1);
+
+                        /* Skip it if we don't want it or there's another one pending */
+                        if (!include_sentinel || SDL_AtomicGet(&SDL_sentinel_pending) > 0) {
+                            continue;
+                        }
+
+                        /* The sentinel marks the end of a poll cycle */
+                        end_of_cycle = SDL_TRUE;
+                        ++used;
+                        break;
+                    }
+                    ++used;
+                }
+                if (used == numevents || end_of_cycle) {
+                    SDL_UnlockMutex(SDL_EventQ.lock);
+                    return used;
+                }
             }
-        } else {
-            SDL_EventEntry *entry, *next;
-            Uint32 type;
 
-            for (entry = SDL_EventQ.head; entry && (events == NULL || used < numevents); entry = next) {
-                next = entry->next;
+            /* Anything past the oldest event needs the ring moved to the list */
+            SDL_DrainEventRing();
+
+            SDL_StartEventCursor(&cursor, minType, maxType);
+            while ((events == NULL || used < numevents) && (entry = SDL_NextEventCursor(&cursor)) != NULL) {
                 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
                     if (events) {
@@ -914,13 +1464,17 @@ static int SDL_PeepEventsInternal(SDL_Event *events, int numevents, SDL_EventAct
                             /* Skip it, there's another one pending */
                             continue;
                         }
+
+                        /* The sentinel marks the end of a poll cycle */
+                        ++used;
+                        break;
                     }
                     ++used;
                 }
             }
         }
+        SDL_UnlockMutex(SDL_EventQ.lock);
     }
-    SDL_UnlockMutex(SDL_EventQ.lock);
 
     if (used > 0 && action == SDL_ADDEVENT) {
         SDL_SendWakeupEvent();
@@ -951,7 +1505,8 @@ void SDL_FlushEvent(Uint32 type)
 
 void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
 {
-    SDL_EventEntry *entry, *next;
+    SDL_EventCursor cursor;
+    SDL_EventEntry *entry;
     Uint32 type;
 
     /* Make sure the events are current */
@@ -962,16 +1517,21 @@ void SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     SDL_PumpEvents();
 #endif
 
+    if (!SDL_EventsMaybeQueued(minType, maxType)) {
+        return;
+    }
+
     /* Lock the event queue */
     SDL_LockMutex(SDL_EventQ.lock);
     {
         /* Don't look after we've quit */
-        if (!SDL_EventQ.active) {
+        if (!SDL_AtomicGet(&SDL_EventQ.active)) {
             SDL_UnlockMutex(SDL_EventQ.lock);
             return;
         }
-        for (entry = SDL_EventQ.head; entry; entry = next) {
-            next = entry->next;
+        SDL_DrainEventRing();
+        SDL_StartEventCursor(&cursor, minType, maxType);
+        while ((entry = SDL_NextEventCursor(&cursor)) != NULL) {
             type = entry->event.type;
             if (minType <= type && type <= maxType) {
                 SDL_CutEvent(entry);
@@ -989,7 +1549,7 @@ static void SDL_PumpEventsInternal(SDL_bool push_sentinel)
     /* Free old event memory */
     /*SDL_FlushEventMemory(SDL_last_event_id - SDL_MAX_QUEUED_EVENTS);*/
     if (SDL_AtomicGet(&SDL_EventQ.count) == 0) {
-        SDL_FlushEventMemory(SDL_last_event_id);
+        SDL_FlushEventMemory((Uint32)SDL_AtomicGet(&SDL_last_event_id));
     }
 
     /* Release any keys held down from last frame */
@@ -1050,6 +1610,40 @@ SDL_bool SDL_PollEvent(SDL_Event *event)
     return SDL_WaitEventTimeoutNS(event, 0);
 }
 
+int SDL_PollEvents(SDL_Event *events, int numevents)
+{
+    int result;
+
+    if (!events) {
+        return SDL_InvalidParamError("events");
+    }
+    if (numevents <= 0) {
+        return 0;
+    }
+
+    /* The last call returned the end of a poll cycle, this one reports it like SDL_PollEvent() would */
+    if (SDL_poll_cycle_ended) {
+        SDL_poll_cycle_ended = SDL_FALSE;
+        return 0;
+    }
+
+    /* If there isn't a poll sentinel event pending, pump events and add one */
+    if (SDL_AtomicGet(&SDL_sentinel_pending) == 0) {
+        SDL_PumpEventsInternal(SDL_TRUE);
+    }
+
+    /* Take everything up to the sentinel in one pass over the queue */
+    result = SDL_PeepEventsInternal(events, numevents, SDL_GETEVENT, SDL_EVENT_FIRST, SDL_EVENT_LAST, SDL_TRUE);
+    if (result > 0 && events[result - 1].type == SDL_EVENT_POLL_SENTINEL) {
+        /* Reached the end of a poll cycle */
+        --result;
+        if (result > 0) {
+            SDL_poll_cycle_ended = SDL_TRUE;
+        }
+    }
+    return result;
+}
+
 static Sint64 SDL_events_get_polling_interval(void)
 {
     Sint64 poll_intervalNS = SDL_MAX_SINT64;
@@ -1266,7 +1860,7 @@ SDL_bool SDL_WaitEventTimeoutNS(SDL_Event *event, Sint64 timeoutNS)
     }
 }
 
-int SDL_PushEvent(SDL_Event *event)
+static int SDL_PushEventInternal(SDL_Event *event, SDL_bool coalesce)
 {
     if (!event->common.timestamp) {
         event->common.timestamp = SDL_GetTicksNS();
@@ -1309,6 +1903,10 @@ int SDL_PushEvent(SDL_Event *event)
         SDL_UnlockMutex(SDL_event_watchers_lock);
     }
 
+    if (coalesce && SDL_coalesce_motion && SDL_CoalesceEvent(event)) {
+        return 1;
+    }
+
     if (SDL_PeepEvents(event, 1, SDL_ADDEVENT, 0, 0) <= 0) {
         return -1;
     }
@@ -1316,6 +1914,16 @@ int SDL_PushEvent(SDL_Event *event)
     return 1;
 }
 
+int SDL_PushEvent(SDL_Event *event)
+{
+    return SDL_PushEventInternal(event, SDL_FALSE);
+}
+
+int SDL_PushMotionEvent(SDL_Event *event)
+{
+    return SDL_PushEventInternal(event, SDL_TRUE);
+}
+
 void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
 {
     SDL_EventEntry *event, *next;
@@ -1328,6 +1936,7 @@ void SDL_SetEventFilter(SDL_EventFilter filter, void *userdata)
             /* Cut all events not accepted by the filter */
             SDL_LockMutex(SDL_EventQ.lock);
             {
+                SDL_DrainEventRing();
                 for (event = SDL_EventQ.head; event; event = next) {
                     next = event->next;
                     if (!filter(userdata, &event->event)) {
@@ -1416,6 +2025,7 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_LockMutex(SDL_EventQ.lock);
     {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
@@ -1426,6 +2036,16 @@ void SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
     SDL_UnlockMutex(SDL_EventQ.lock);
 }
 
+int SDL_GetCoalescedEventCount(Uint32 type)
+{
+    SDL_AtomicInt *counter = SDL_GetCoalescedEventCounter(type);
+
+    if (!counter) {
+        return 0;
+    }
+    return SDL_AtomicGet(counter);
+}
+
 void SDL_SetEventEnabled(Uint32 type, SDL_bool enabled)
 {
     SDL_bool current_state;
@@ -1550,6 +2170,7 @@ int SDL_InitEvents(void)
     SDL_AddHintCallback(SDL_HINT_AUTO_UPDATE_SENSORS, SDL_AutoUpdateSensorsChanged, NULL);
 #endif
     SDL_AddHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_AddHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
     if (SDL_StartEventLoop() < 0) {
         SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
@@ -1566,6 +2187,7 @@ void SDL_QuitEvents(void)
     SDL_QuitQuit();
     SDL_StopEventLoop();
     SDL_DelHintCallback(SDL_HINT_POLL_SENTINEL, SDL_PollSentinelChanged, NULL);
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION, SDL_CoalesceMotionChanged, NULL);
     SDL_DelHintCallback(SDL_HINT_EVENT_LOGGING, SDL_EventLoggingChanged, NULL);
 #ifndef SDL_JOYSTICK_DISABLED
     SDL_DelHintCallback(SDL_HINT_AUTO_UPDATE_JOYSTICKS, SDL_AutoUpdateJoysticksChanged, NULL);
@@ -42,6 +42,9 @@ extern void SDL_QuitInterrupt(void);
 
 extern const char *SDL_AllocateEventString(const char *string);
 
+/* Push an event that may be merged with the last queued one, see SDL_HINT_EVENT_COALESCE_MOTION */
+extern int SDL_PushMotionEvent(SDL_Event *event);
+
 extern int SDL_SendAppEvent(SDL_EventType eventType);
 extern int SDL_SendKeymapChangedEvent(void);
 extern int SDL_SendLocaleChangedEvent(void);
@@ -838,7 +838,7 @@ static int SDL_PrivateSendMouseMotion(Uint64 timestamp, SDL_Window *window, SDL_
         event.motion.y = mouse->y;
         event.motion.xrel = xrel;
         event.motion.yrel = yrel;
-        posted = (SDL_PushEvent(&event) > 0);
+        posted = (SDL_PushMotionEvent(&event) > 0);
     }
     if (relative) {
         mouse->last_x = mouse->x;
@@ -548,7 +548,7 @@ int SDL_SendPenMotion(Uint64 timestamp,
         event_setup(pen, window, timestamp, status, &event);
         event.pmotion.type = SDL_EVENT_PEN_MOTION;
 
-        posted = SDL_PushEvent(&event) > 0;
+        posted = SDL_PushMotionEvent(&event) > 0;
 
         if (!posted) {
             return SDL_FALSE;
@@ -572,7 +572,7 @@ int SDL_SendPenMotion(Uint64 timestamp,
                 event.motion.y = y;
                 event.motion.xrel = last_x - x;
                 event.motion.yrel = last_y - y;
-                return (SDL_PushEvent(&event) > 0) || posted;
+                return (SDL_PushMotionEvent(&event) > 0) || posted;
             }
             break;
 
@@ -3651,7 +3651,7 @@ int SDL_SendJoystickSensor(Uint64 timestamp, SDL_Joystick *joystick, SDL_SensorT
                     SDL_memcpy(event.gsensor.data, data,
                                num_values * sizeof(*data));
                     event.gsensor.sensor_timestamp = sensor_timestamp;
-                    posted = SDL_PushEvent(&event) == 1;
+                    posted = SDL_PushMotionEvent(&event) == 1;
                 }
             }
             break;
@@ -27,6 +27,8 @@
 
 #if !defined(SDL_PLATFORM_EMSCRIPTEN) || !defined(SDL_THREADS_DISABLED)
 
+#include "../SDL_hashtable.h"
+
 typedef struct SDL_Timer
 {
     SDL_TimerID timerID;
@@ -35,23 +37,17 @@ typedef struct SDL_Timer
     void *userdata;
     Uint64 interval;
     Uint64 scheduled;
+    Uint64 sequence;
     SDL_AtomicInt canceled;
     struct SDL_Timer *next;
 } SDL_Timer;
 
-typedef struct SDL_TimerMap
-{
-    SDL_TimerID timerID;
-    SDL_Timer *timer;
-    struct SDL_TimerMap *next;
-} SDL_TimerMap;
-
-/* The timers are kept in a sorted list */
+/* The timers are kept in a binary min-heap ordered by scheduling time */
 typedef struct
 {
     /* Data used by the main thread */
     SDL_Thread *thread;
-    SDL_TimerMap *timermap;
+    SDL_HashTable *timermap;
     SDL_Mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -64,8 +60,11 @@ typedef struct
     SDL_Timer *freelist;
     SDL_AtomicInt active;
 
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
+    Uint64 sequence;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
@@ -76,24 +75,75 @@ static SDL_TimerData SDL_timer_data;
  * Timers are removed by simply setting a canceled flag
  */
 
+static SDL_INLINE SDL_bool SDL_TimerBefore(const SDL_Timer *a, const SDL_Timer *b)
+{
+    /* Timers scheduled for the same time fire in the order they were queued */
+    if (a->scheduled != b->scheduled) {
+        return (a->scheduled < b->scheduled);
+    }
+    return (a->sequence < b->sequence);
+}
+
+static SDL_bool SDL_GrowTimerHeap(SDL_TimerData *data)
+{
+    int max_timers = data->max_timers ? data->max_timers * 2 : 64;
+    SDL_Timer **timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+    if (!timers) {
+        return SDL_FALSE;
+    }
+    data->timers = timers;
+    data->max_timers = max_timers;
+    return SDL_TRUE;
+}
+
 static void SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    SDL_Timer **timers = data->timers;
+    int i;
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if (curr->scheduled > timer->scheduled) {
+    SDL_assert(data->num_timers < data->max_timers);
+
+    timer->sequence = data->sequence++;
+
+    /* Sift the new timer up from the bottom of the heap */
+    for (i = data->num_timers++; i > 0; ) {
+        const int parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, timers[parent])) {
             break;
         }
+        timers[i] = timers[parent];
+        i = parent;
     }
+    timers[i] = timer;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+static SDL_Timer *SDL_RemoveFirstTimer(SDL_TimerData *data)
+{
+    SDL_Timer **timers = data->timers;
+    SDL_Timer *first = timers[0];
+    SDL_Timer *last = timers[--data->num_timers];
+    const int num_timers = data->num_timers;
+    int i = 0;
+
+    /* Sift the last timer down from the top of the heap */
+    for (;;) {
+        int child = 2 * i + 1;
+        if (child >= num_timers) {
+            break;
+        }
+        if (child + 1 < num_timers && SDL_TimerBefore(timers[child + 1], timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(timers[child], last)) {
+            break;
+        }
+        timers[i] = timers[child];
+        i = child;
+    }
+    if (num_timers > 0) {
+        timers[i] = last;
     }
-    timer->next = curr;
+    return first;
 }
 
 static int SDLCALL SDL_TimerThread(void *_data)
@@ -126,8 +176,11 @@ static int SDLCALL SDL_TimerThread(void *_data)
         }
         SDL_UnlockSpinlock(&data->lock);
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our heap */
         while (pending) {
+            if (data->num_timers == data->max_timers && !SDL_GrowTimerHeap(data)) {
+                break;
+            }
             current = pending;
             pending = pending->next;
             SDL_AddTimerInternal(data, current);
@@ -135,28 +188,42 @@ static int SDLCALL SDL_TimerThread(void *_data)
         freelist_head = NULL;
         freelist_tail = NULL;
 
+        /* Initial delay if there are no timers */
+        delay = (Uint64)-1;
+
+        if (pending) {
+            /* Out of memory, hand the rest back and try again shortly */
+            current = pending;
+            while (current->next) {
+                current = current->next;
+            }
+            SDL_LockSpinlock(&data->lock);
+            current->next = data->pending;
+            data->pending = pending;
+            SDL_UnlockSpinlock(&data->lock);
+
+            delay = SDL_MS_TO_NS(1);
+        }
+
         /* Check to see if we're still running, after maintenance */
         if (!SDL_AtomicGet(&data->active)) {
             break;
         }
 
-        /* Initial delay if there are no timers */
-        delay = (Uint64)-1;
-
         tick = SDL_GetTicksNS();
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
             if (tick < current->scheduled) {
                 /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
+                delay = SDL_min(delay, current->scheduled - tick);
                 break;
             }
 
             /* We're going to do something with this timer */
-            data->timers = current->next;
+            SDL_RemoveFirstTimer(data);
 
             if (SDL_AtomicGet(&current->canceled)) {
                 interval = 0;
@@ -169,7 +236,7 @@ static int SDLCALL SDL_TimerThread(void *_data)
             }
 
             if (interval > 0) {
-                /* Reschedule this timer */
+                /* Reschedule this timer, the slot it came from is still free */
                 current->interval = interval;
                 current->scheduled = tick + interval;
                 SDL_AddTimerInternal(data, current);
@@ -216,8 +283,15 @@ int SDL_InitTimers(void)
             return -1;
         }
 
+        data->timermap = SDL_CreateHashTable(NULL, 64, SDL_HashID, SDL_KeyMatchID, NULL, SDL_FALSE);
+        if (!data->timermap) {
+            SDL_DestroyMutex(data->timermap_lock);
+            return -1;
+        }
+
         data->sem = SDL_CreateSemaphore(0);
         if (!data->sem) {
+            SDL_DestroyHashTable(data->timermap);
             SDL_DestroyMutex(data->timermap_lock);
             return -1;
         }
@@ -238,7 +312,7 @@ void SDL_QuitTimers(void)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCompareAndSwap(&data->active, 1, 0)) { /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -252,9 +326,16 @@ void SDL_QuitTimers(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
+        for (i = 0; i < data->num_timers; ++i) {
+            SDL_free(data->timers[i]);
+        }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->num_timers = 0;
+        data->max_timers = 0;
+        while (data->pending) {
+            timer = data->pending;
+            data->pending = timer->next;
             SDL_free(timer);
         }
         while (data->freelist) {
@@ -262,11 +343,9 @@ void SDL_QuitTimers(void)
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
-        }
+
+        SDL_DestroyHashTable(data->timermap);
+        data->timermap = NULL;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
@@ -277,7 +356,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
-    SDL_TimerMap *entry;
+    SDL_bool inserted;
 
     if (!callback_ms && !callback_ns) {
         SDL_InvalidParamError("callback");
@@ -299,7 +378,12 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     SDL_UnlockSpinlock(&data->lock);
 
     if (timer) {
-        SDL_RemoveTimer(timer->timerID);
+        /* The timer finished on its own, so it may still be mapped under its
+           old ID. Unmap it before reusing it, so removing the old ID can't
+           cancel the new timer. */
+        SDL_LockMutex(data->timermap_lock);
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID);
+        SDL_UnlockMutex(data->timermap_lock);
     } else {
         timer = (SDL_Timer *)SDL_malloc(sizeof(*timer));
         if (!timer) {
@@ -314,18 +398,14 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     timer->scheduled = SDL_GetTicksNS() + timer->interval;
     SDL_AtomicSet(&timer->canceled, 0);
 
-    entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
-    if (!entry) {
+    SDL_LockMutex(data->timermap_lock);
+    inserted = SDL_InsertIntoHashTable(data->timermap, (const void *)(uintptr_t)timer->timerID, timer);
+    SDL_UnlockMutex(data->timermap_lock);
+
+    if (!inserted) {
         SDL_free(timer);
         return 0;
     }
-    entry->timer = timer;
-    entry->timerID = timer->timerID;
-
-    SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
-    SDL_UnlockMutex(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
     SDL_LockSpinlock(&data->lock);
@@ -336,7 +416,7 @@ static SDL_TimerID SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback_m
     /* Wake up the timer thread if necessary */
     SDL_PostSemaphore(data->sem);
 
-    return entry->timerID;
+    return timer->timerID;
 }
 
 SDL_TimerID SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *userdata)
@@ -352,7 +432,7 @@ SDL_TimerID SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *
 int SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_Timer *timer = NULL;
     SDL_bool canceled = SDL_FALSE;
 
     if (!id) {
@@ -361,26 +441,15 @@ int SDL_RemoveTimer(SDL_TimerID id)
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
-            }
-            break;
+    if (SDL_FindInHashTable(data->timermap, (const void *)(uintptr_t)id, (const void **)&timer)) {
+        SDL_RemoveFromHashTable(data->timermap, (const void *)(uintptr_t)id);
+        if (!SDL_AtomicGet(&timer->canceled)) {
+            SDL_AtomicSet(&timer->canceled, 1);
+            canceled = SDL_TRUE;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
 
-    if (entry) {
-        if (!SDL_AtomicGet(&entry->timer->canceled)) {
-            SDL_AtomicSet(&entry->timer->canceled, 1);
-            canceled = SDL_TRUE;
-        }
-        SDL_free(entry);
-    }
     if (canceled) {
         return 0;
     } else {
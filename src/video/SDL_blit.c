@@ -21,6 +21,7 @@
 #include "SDL_internal.h"
 
 #include "SDL_sysvideo.h"
+#include "SDL_video_c.h"
 #include "SDL_blit.h"
 #include "SDL_blit_auto.h"
 #include "SDL_blit_copy.h"
@@ -28,6 +29,235 @@
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
 
+/* Worker threads that run bands of large blits, if SDL_HINT_SURFACE_BLIT_THREADS asks for them */
+
+#define SDL_MAX_BLIT_THREADS     64
+#define SDL_MIN_BLIT_BAND_PIXELS (128 * 128) /* below this, waking a worker costs more than it saves */
+#define SDL_MIN_BLIT_BAND_ROWS   8
+
+typedef struct SDL_BlitThreads
+{
+    int num_threads;
+    SDL_Thread **threads;
+    SDL_Semaphore *work_sem;
+    SDL_Semaphore *done_sem;
+    SDL_AtomicInt shutdown;
+    SDL_AtomicInt next_band;
+    int num_bands;
+    SDL_BlitBandFunc func;
+    void *userdata;
+} SDL_BlitThreads;
+
+/* Held for the whole of a threaded blit; anyone who can't get it blits on their own thread.
+   It's created on first use, under the spinlock. */
+static SDL_SpinLock SDL_blit_threads_init_lock;
+static SDL_Mutex *SDL_blit_threads_lock;
+static SDL_BlitThreads *SDL_blit_threads;
+
+/* Runs bands until there are none left. Called from the workers and the blitting thread at the same time. */
+static void SDL_RunBlitThreadBands(SDL_BlitThreads *pool)
+{
+    for (;;) {
+        const int band = SDL_AtomicAdd(&pool->next_band, 1);
+        if (band >= pool->num_bands) {
+            break;
+        }
+        pool->func(pool->userdata, band, pool->num_bands);
+    }
+}
+
+static int SDLCALL SDL_BlitThread(void *data)
+{
+    SDL_BlitThreads *pool = (SDL_BlitThreads *)data;
+
+    for (;;) {
+        SDL_WaitSemaphore(pool->work_sem);
+        if (SDL_AtomicGet(&pool->shutdown)) {
+            break;
+        }
+        SDL_RunBlitThreadBands(pool);
+        SDL_PostSemaphore(pool->done_sem);
+    }
+    return 0;
+}
+
+static void SDL_DestroyBlitThreads(SDL_BlitThreads *pool)
+{
+    int i;
+
+    if (!pool) {
+        return;
+    }
+
+    SDL_AtomicSet(&pool->shutdown, 1);
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_PostSemaphore(pool->work_sem);
+    }
+    for (i = 0; i < pool->num_threads; ++i) {
+        SDL_WaitThread(pool->threads[i], NULL);
+    }
+
+    SDL_DestroySemaphore(pool->work_sem);
+    SDL_DestroySemaphore(pool->done_sem);
+    SDL_free(pool->threads);
+    SDL_free(pool);
+}
+
+static SDL_BlitThreads *SDL_CreateBlitThreads(int num_threads)
+{
+    SDL_BlitThreads *pool;
+    int i;
+
+    pool = (SDL_BlitThreads *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+
+    pool->threads = (SDL_Thread **)SDL_calloc(num_threads, sizeof(*pool->threads));
+    pool->work_sem = SDL_CreateSemaphore(0);
+    pool->done_sem = SDL_CreateSemaphore(0);
+    if (!pool->threads || !pool->work_sem || !pool->done_sem) {
+        SDL_DestroyBlitThreads(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        char threadname[32];
+        (void)SDL_snprintf(threadname, sizeof(threadname), "SDLBlit%d", i);
+        pool->threads[i] = SDL_CreateThread(SDL_BlitThread, threadname, pool);
+        if (!pool->threads[i]) {
+            SDL_DestroyBlitThreads(pool);
+            return NULL;
+        }
+        pool->num_threads++;
+    }
+    return pool;
+}
+
+static int SDL_GetBlitThreadCountFromHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_BLIT_THREADS);
+    if (hint) {
+        const int val = SDL_atoi(hint);
+        if (val > 0) {
+            return SDL_min(val, SDL_MAX_BLIT_THREADS);
+        }
+    }
+    return 0;
+}
+
+/* Splits a w x h blit into bands and runs them on the worker threads and this one, or just runs it here */
+void SDL_RunBlitBands(SDL_BlitBandFunc func, void *userdata, int w, int h)
+{
+    SDL_BlitThreads *pool;
+    int num_threads, num_bands, num_woken, i;
+
+    num_bands = 1;
+    if ((Sint64)w * h >= 2 * SDL_MIN_BLIT_BAND_PIXELS && h >= 2 * SDL_MIN_BLIT_BAND_ROWS) {
+        num_threads = SDL_GetBlitThreadCountFromHint();
+        if (num_threads > 0) {
+            num_bands = (int)SDL_min((Sint64)w * h / SDL_MIN_BLIT_BAND_PIXELS, h / SDL_MIN_BLIT_BAND_ROWS);
+            num_bands = SDL_min(num_bands, num_threads + 1);
+        }
+    }
+    if (num_bands > 1 && !SDL_blit_threads_lock) {
+        SDL_LockSpinlock(&SDL_blit_threads_init_lock);
+        if (!SDL_blit_threads_lock) {
+            SDL_blit_threads_lock = SDL_CreateMutex();
+        }
+        SDL_UnlockSpinlock(&SDL_blit_threads_init_lock);
+    }
+    if (num_bands <= 1 || !SDL_blit_threads_lock || SDL_TryLockMutex(SDL_blit_threads_lock) != 0) {
+        func(userdata, 0, 1);
+        return;
+    }
+
+    pool = SDL_blit_threads;
+    if (!pool || pool->num_threads != num_threads) {
+        SDL_DestroyBlitThreads(pool);
+        SDL_blit_threads = pool = SDL_CreateBlitThreads(num_threads);
+        if (!pool) {
+            /* We just blit on this thread, and try again next time */
+            SDL_UnlockMutex(SDL_blit_threads_lock);
+            func(userdata, 0, 1);
+            return;
+        }
+    }
+
+    pool->func = func;
+    pool->userdata = userdata;
+    pool->num_bands = num_bands;
+    SDL_AtomicSet(&pool->next_band, 0);
+
+    num_woken = num_bands - 1;
+    for (i = 0; i < num_woken; ++i) {
+        SDL_PostSemaphore(pool->work_sem);
+    }
+    SDL_RunBlitThreadBands(pool); /* this thread works too, instead of just waiting */
+    for (i = 0; i < num_woken; ++i) {
+        SDL_WaitSemaphore(pool->done_sem);
+    }
+
+    SDL_UnlockMutex(SDL_blit_threads_lock);
+}
+
+void SDL_QuitBlitThreads(void)
+{
+    if (!SDL_blit_threads_lock) {
+        return; /* there was never a threaded blit */
+    }
+
+    /* Wait for any blit in progress to finish */
+    SDL_LockMutex(SDL_blit_threads_lock);
+    SDL_DestroyBlitThreads(SDL_blit_threads);
+    SDL_blit_threads = NULL;
+    SDL_UnlockMutex(SDL_blit_threads_lock);
+
+    SDL_DestroyMutex(SDL_blit_threads_lock);
+    SDL_blit_threads_lock = NULL;
+}
+
+typedef struct
+{
+    SDL_BlitFunc func;
+    SDL_BlitInfo info;
+} SDL_SoftBlitBands;
+
+static void SDL_SoftBlitBand(void *userdata, int band, int num_bands)
+{
+    const SDL_SoftBlitBands *bands = (const SDL_SoftBlitBands *)userdata;
+    SDL_BlitInfo info = bands->info; /* the blitters are free to change their copy */
+    const int y0 = (int)((Sint64)info.dst_h * band / num_bands);
+    const int y1 = (int)((Sint64)info.dst_h * (band + 1) / num_bands);
+
+    info.src += (size_t)y0 * info.src_pitch;
+    info.dst += (size_t)y0 * info.dst_pitch;
+    info.src_h = y1 - y0;
+    info.dst_h = y1 - y0;
+    bands->func(&info);
+}
+
+/* Whether the blit can run as independent bands of rows */
+static SDL_bool SDL_CanSplitBlit(const SDL_BlitInfo *info)
+{
+    /* Palette blits stay serial, and scaled blits step through
+       the source in a way that doesn't restart partway down */
+    if (SDL_ISPIXELFORMAT_INDEXED(info->src_fmt->format) ||
+        SDL_ISPIXELFORMAT_INDEXED(info->dst_fmt->format)) {
+        return SDL_FALSE;
+    }
+    if ((info->flags & SDL_COPY_NEAREST) ||
+        info->src_w != info->dst_w || info->src_h != info->dst_h) {
+        return SDL_FALSE;
+    }
+    /* Overlapping blits, like scrolling a surface onto itself, rely on the rows being done in order */
+    if (info->src < info->dst + (size_t)(info->dst_h - 1) * info->dst_pitch + (size_t)info->dst_w * info->dst_fmt->bytes_per_pixel &&
+        info->dst < info->src + (size_t)(info->src_h - 1) * info->src_pitch + (size_t)info->src_w * info->src_fmt->bytes_per_pixel) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
 /* The general purpose software blit routine */
 static int SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
                                 SDL_Surface *dst, const SDL_Rect *dstrect)
@@ -83,7 +313,20 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, const SDL_Rect *srcrect,
         RunBlit = (SDL_BlitFunc)src->map->data;
 
         /* Run the actual software blit */
-        RunBlit(info);
+        if (SDL_CanSplitBlit(info)) {
+            SDL_SoftBlitBands bands;
+
+            if (RunBlit == SDL_Blit_Slow_Float) {
+                /* It may store the HDR headroom on the destination, so
+                   create the properties before the bands race to do it */
+                SDL_GetSurfaceProperties(dst);
+            }
+            bands.func = RunBlit;
+            bands.info = *info;
+            SDL_RunBlitBands(SDL_SoftBlitBand, &bands, info->dst_w, info->dst_h);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -140,6 +383,15 @@ static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int
         if (SDL_HasSSE2()) {
             features |= SDL_CPU_SSE2;
         }
+        if (SDL_HasSSE41()) {
+            features |= SDL_CPU_SSE4_1;
+        }
+        if (SDL_HasAVX2()) {
+            features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            features |= SDL_CPU_NEON;
+        }
         if (SDL_HasAltiVec()) {
             if (SDL_UseAltivecPrefetch()) {
                 features |= SDL_CPU_ALTIVEC_PREFETCH;
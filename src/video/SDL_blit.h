@@ -54,6 +54,9 @@ extern Uint16 SDL_expand_byte10[];
 #define SDL_CPU_SSE2               0x00000004
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000008
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000010
+#define SDL_CPU_SSE4_1             0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
 
 typedef struct
 {
@@ -104,8 +107,12 @@ struct SDL_BlitMap
     Uint32 src_palette_version;
 };
 
+/* Runs one horizontal band of a blit, rows [h * band / num_bands, h * (band + 1) / num_bands) */
+typedef void (*SDL_BlitBandFunc)(void *userdata, int band, int num_bands);
+
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface *surface);
+extern void SDL_RunBlitBands(SDL_BlitBandFunc func, void *userdata, int w, int h);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
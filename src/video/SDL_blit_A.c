@@ -1030,6 +1030,631 @@ static void SDL_TARGETING("mmx") Blit555to555SurfaceAlphaMMX(SDL_BlitInfo *info)
 
 #endif /* SDL_MMX_INTRINSICS */
 
+#ifdef SDL_SSE2_INTRINSICS
+
+/* Load up to 4 32-bit pixels, going through a temporary buffer at the end of a row */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") LoadPixels32SSE2(const Uint32 *pixels, int count)
+{
+    if (count < 4) {
+        Uint32 buffer[4] = { 0, 0, 0, 0 };
+        if (count > 0) {
+            SDL_memcpy(buffer, pixels, count * sizeof(Uint32));
+        }
+        return _mm_loadu_si128((const __m128i *)buffer);
+    }
+    return _mm_loadu_si128((const __m128i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse2") StorePixels32SSE2(Uint32 *pixels, __m128i v, int count)
+{
+    if (count < 4) {
+        Uint32 buffer[4];
+        _mm_storeu_si128((__m128i *)buffer, v);
+        SDL_memcpy(pixels, buffer, count * sizeof(Uint32));
+    } else {
+        _mm_storeu_si128((__m128i *)pixels, v);
+    }
+}
+
+/* Load up to 8 16-bit pixels, going through a temporary buffer at the end of a row */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") LoadPixels16SSE2(const Uint16 *pixels, int count)
+{
+    if (count < 8) {
+        Uint16 buffer[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+        SDL_memcpy(buffer, pixels, count * sizeof(Uint16));
+        return _mm_loadu_si128((const __m128i *)buffer);
+    }
+    return _mm_loadu_si128((const __m128i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse2") StorePixels16SSE2(Uint16 *pixels, __m128i v, int count)
+{
+    if (count < 8) {
+        Uint16 buffer[8];
+        _mm_storeu_si128((__m128i *)buffer, v);
+        SDL_memcpy(pixels, buffer, count * sizeof(Uint16));
+    } else {
+        _mm_storeu_si128((__m128i *)pixels, v);
+    }
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse2") SelectSSE2(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/* 0xFFFF in the 16-bit lanes that an 8888 channel mask lands in after unpacking to 16 bits */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") ChannelMask16SSE2(Uint32 mask)
+{
+    __m128i lanes = _mm_cvtsi32_si128((int)mask);
+    lanes = _mm_unpacklo_epi8(lanes, lanes);
+    return _mm_unpacklo_epi64(lanes, lanes);
+}
+
+/*
+ * Blend 4 8888 pixels with their own alpha, the same way BlitRGBtoRGBPixelAlphaMMX does:
+ *   dstRGB = (srcRGB * srcA >> 8) + (dstRGB * (255 - srcA) >> 8)
+ *   dstA = srcA + (dstA * (255 - srcA) >> 8)
+ * with fully transparent and fully opaque source pixels passed through untouched.
+ */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") BlendPixelAlpha8888SSE2(__m128i src, __m128i dst, __m128i amask, __m128i ashift, __m128i achannel)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i alpha = _mm_and_si128(src, amask);
+    __m128i a, srca_lo, srca_hi, dsta_lo, dsta_hi, res_lo, res_hi, result;
+
+    /* Spread each pixel's alpha over the 16-bit lanes of its channels */
+    a = _mm_srl_epi32(alpha, ashift);
+    a = _mm_or_si128(a, _mm_slli_epi32(a, 16));
+    dsta_lo = _mm_unpacklo_epi32(a, a);
+    dsta_hi = _mm_unpackhi_epi32(a, a);
+
+    /* The alpha channel is weighted by 256 so srcA comes through exactly */
+    srca_lo = SelectSSE2(achannel, _mm_set1_epi16(256), dsta_lo);
+    srca_hi = SelectSSE2(achannel, _mm_set1_epi16(256), dsta_hi);
+    dsta_lo = _mm_xor_si128(dsta_lo, _mm_set1_epi16(0xFF));
+    dsta_hi = _mm_xor_si128(dsta_hi, _mm_set1_epi16(0xFF));
+
+    res_lo = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(src, zero), srca_lo), 8),
+                           _mm_srli_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(dst, zero), dsta_lo), 8));
+    res_hi = _mm_add_epi16(_mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(src, zero), srca_hi), 8),
+                           _mm_srli_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(dst, zero), dsta_hi), 8));
+    result = _mm_packus_epi16(res_lo, res_hi);
+
+    result = SelectSSE2(_mm_cmpeq_epi32(alpha, amask), src, result);
+    return SelectSSE2(_mm_cmpeq_epi32(alpha, zero), dst, result);
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void SDL_TARGETING("sse2") BlitRGBtoRGBPixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+    const __m128i amask = _mm_set1_epi32((int)sf->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(sf->Ashift);
+    const __m128i achannel = ChannelMask16SSE2(sf->Amask);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 4) {
+            const __m128i src = LoadPixels32SSE2(srcp + x, width - x);
+            const __m128i dst = LoadPixels32SSE2(dstp + x, width - x);
+            StorePixels32SSE2(dstp + x, BlendPixelAlpha8888SSE2(src, dst, amask, ashift, achannel), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast ARGB888->(A)BGR888 blending with pixel alpha */
+static void SDL_TARGETING("sse2") BlitRGBtoBGRPixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m128i amask = _mm_set1_epi32((int)0xFF000000);
+    const __m128i ashift = _mm_cvtsi32_si128(24);
+    const __m128i achannel = ChannelMask16SSE2(0xFF000000);
+    const __m128i agmask = _mm_set1_epi32((int)0xFF00FF00);
+    const __m128i bytemask = _mm_set1_epi32(0xFF);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 4) {
+            __m128i src = LoadPixels32SSE2(srcp + x, width - x);
+            const __m128i dst = LoadPixels32SSE2(dstp + x, width - x);
+
+            /* Swap red and blue, then blend as usual */
+            src = _mm_or_si128(_mm_and_si128(src, agmask),
+                               _mm_or_si128(_mm_and_si128(_mm_srli_epi32(src, 16), bytemask),
+                                            _mm_slli_epi32(_mm_and_si128(src, bytemask), 16)));
+            StorePixels32SSE2(dstp + x, BlendPixelAlpha8888SSE2(src, dst, amask, ashift, achannel), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha, the same way BlitRGBtoRGBSurfaceAlphaMMX does */
+static void SDL_TARGETING("sse2") BlitRGBtoRGBSurfaceAlphaSSE2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const Uint32 chanmask = (0xFFu << df->Rshift) | (0xFFu << df->Gshift) | (0xFFu << df->Bshift);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i dsta = _mm_set1_epi32((int)df->Amask);
+    /* The alpha in the 16-bit lanes of the color channels, and 0 in the fourth one */
+    const __m128i alpha = _mm_and_si128(_mm_set1_epi16(info->a), ChannelMask16SSE2(chanmask));
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 4) {
+            const __m128i src = LoadPixels32SSE2(srcp + x, width - x);
+            const __m128i dst = LoadPixels32SSE2(dstp + x, width - x);
+            const __m128i dst_lo = _mm_unpacklo_epi8(dst, zero);
+            const __m128i dst_hi = _mm_unpackhi_epi8(dst, zero);
+            __m128i res_lo, res_hi;
+
+            /* dst + ((src - dst) * alpha >> 8), wrapping to 8 bits */
+            res_lo = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(src, zero), dst_lo), alpha), 8);
+            res_hi = _mm_srli_epi16(_mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(src, zero), dst_hi), alpha), 8);
+            res_lo = _mm_add_epi8(res_lo, dst_lo);
+            res_hi = _mm_add_epi8(res_hi, dst_hi);
+
+            StorePixels32SSE2(dstp + x, _mm_or_si128(_mm_packus_epi16(res_lo, res_hi), dsta), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* dst + ((src - dst) * alpha >> 5) for 5 and 6 bit channels in 16-bit lanes */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") BlendChannel16SSE2(__m128i src, __m128i dst, __m128i alpha)
+{
+    return _mm_add_epi16(dst, _mm_srai_epi16(_mm_mullo_epi16(_mm_sub_epi16(src, dst), alpha), 5));
+}
+
+/*
+ * Blend 8 RGB565 or RGB555 pixels with a 5-bit alpha, one channel at a time.
+ * At alpha 16 this matches the 50% special case in Blit16to16SurfaceAlpha128.
+ */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") Blend16SSE2(__m128i src, __m128i dst, __m128i alpha, __m128i rshift, __m128i gmask)
+{
+    const __m128i bmask = _mm_set1_epi16(0x1F);
+    __m128i r, g, b;
+
+    r = BlendChannel16SSE2(_mm_and_si128(_mm_srl_epi16(src, rshift), bmask), _mm_and_si128(_mm_srl_epi16(dst, rshift), bmask), alpha);
+    g = BlendChannel16SSE2(_mm_and_si128(_mm_srli_epi16(src, 5), gmask), _mm_and_si128(_mm_srli_epi16(dst, 5), gmask), alpha);
+    b = BlendChannel16SSE2(_mm_and_si128(src, bmask), _mm_and_si128(dst, bmask), alpha);
+    return _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, rshift), _mm_slli_epi16(g, 5)), b);
+}
+
+static void SDL_TARGETING("sse2") Blit16to16SurfaceAlphaSSE2(SDL_BlitInfo *info, int rshift, Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *)info->src;
+    int srcskip = info->src_skip >> 1;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m128i alpha = _mm_set1_epi16(info->a >> 3); /* downscale alpha to 5 bits */
+    const __m128i shift = _mm_cvtsi32_si128(rshift);
+    const __m128i mask = _mm_set1_epi16(gmask);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 8) {
+            const __m128i src = LoadPixels16SSE2(srcp + x, width - x);
+            const __m128i dst = LoadPixels16SSE2(dstp + x, width - x);
+            StorePixels16SSE2(dstp + x, Blend16SSE2(src, dst, alpha, shift, mask), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast RGB565->RGB565 blending with surface alpha */
+static void SDL_TARGETING("sse2") Blit565to565SurfaceAlphaSSE2(SDL_BlitInfo *info)
+{
+    Blit16to16SurfaceAlphaSSE2(info, 11, 0x3F);
+}
+
+/* fast RGB555->RGB555 blending with surface alpha */
+static void SDL_TARGETING("sse2") Blit555to555SurfaceAlphaSSE2(SDL_BlitInfo *info)
+{
+    Blit16to16SurfaceAlphaSSE2(info, 10, 0x1F);
+}
+
+/* Convert 4 ARGB8888 (or ABGR8888) pixels to the 16-bit channel layout, one channel at a time */
+static SDL_INLINE __m128i SDL_TARGETING("sse2") ExtractChannel8888SSE2(__m128i lo, __m128i hi, __m128i shift, __m128i mask)
+{
+    return _mm_packs_epi32(_mm_and_si128(_mm_srl_epi32(lo, shift), mask),
+                           _mm_and_si128(_mm_srl_epi32(hi, shift), mask));
+}
+
+static void SDL_TARGETING("sse2") BlitARGBto16PixelAlphaSSE2(SDL_BlitInfo *info, int rshift, Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i opaque = _mm_set1_epi16(SDL_ALPHA_OPAQUE >> 3);
+    const __m128i shift = _mm_cvtsi32_si128(rshift);
+    const __m128i rmask = _mm_set1_epi32(0x1F);
+    const __m128i mask = _mm_set1_epi32(gmask);
+    const __m128i ashift = _mm_cvtsi32_si128(27);
+    const __m128i rsrcshift = _mm_cvtsi32_si128(19);
+    const __m128i gsrcshift = _mm_cvtsi32_si128(gmask == 0x3F ? 10 : 11);
+    const __m128i bsrcshift = _mm_cvtsi32_si128(3);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 8) {
+            const __m128i src_lo = LoadPixels32SSE2(srcp + x, width - x);
+            const __m128i src_hi = LoadPixels32SSE2(srcp + x + 4, width - x - 4);
+            const __m128i dst = LoadPixels16SSE2(dstp + x, width - x);
+            const __m128i bmask = _mm_set1_epi16(0x1F);
+            __m128i alpha, r, g, b, src, result;
+
+            /* downscale alpha to 5 bits, and the source channels to the destination's depth */
+            alpha = ExtractChannel8888SSE2(src_lo, src_hi, ashift, rmask);
+            r = ExtractChannel8888SSE2(src_lo, src_hi, rsrcshift, rmask);
+            g = ExtractChannel8888SSE2(src_lo, src_hi, gsrcshift, mask);
+            b = ExtractChannel8888SSE2(src_lo, src_hi, bsrcshift, rmask);
+            src = _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, shift), _mm_slli_epi16(g, 5)), b);
+
+            r = BlendChannel16SSE2(r, _mm_and_si128(_mm_srl_epi16(dst, shift), bmask), alpha);
+            g = BlendChannel16SSE2(g, _mm_and_si128(_mm_srli_epi16(dst, 5), _mm_set1_epi16(gmask)), alpha);
+            b = BlendChannel16SSE2(b, _mm_and_si128(dst, bmask), alpha);
+            result = _mm_or_si128(_mm_or_si128(_mm_sll_epi16(r, shift), _mm_slli_epi16(g, 5)), b);
+
+            result = SelectSSE2(_mm_cmpeq_epi16(alpha, opaque), src, result);
+            result = SelectSSE2(_mm_cmpeq_epi16(alpha, zero), dst, result);
+            StorePixels16SSE2(dstp + x, result, width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void SDL_TARGETING("sse2") BlitARGBto565PixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaSSE2(info, 11, 0x3F);
+}
+
+/* fast ARGB8888->RGB555 blending with pixel alpha */
+static void SDL_TARGETING("sse2") BlitARGBto555PixelAlphaSSE2(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaSSE2(info, 10, 0x1F);
+}
+
+#endif /* SDL_SSE2_INTRINSICS */
+
+#ifdef SDL_AVX2_INTRINSICS
+
+/* Load up to 8 32-bit pixels, going through a temporary buffer at the end of a row */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") LoadPixels32AVX2(const Uint32 *pixels, int count)
+{
+    if (count < 8) {
+        Uint32 buffer[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+        if (count > 0) {
+            SDL_memcpy(buffer, pixels, count * sizeof(Uint32));
+        }
+        return _mm256_loadu_si256((const __m256i *)buffer);
+    }
+    return _mm256_loadu_si256((const __m256i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") StorePixels32AVX2(Uint32 *pixels, __m256i v, int count)
+{
+    if (count < 8) {
+        Uint32 buffer[8];
+        _mm256_storeu_si256((__m256i *)buffer, v);
+        SDL_memcpy(pixels, buffer, count * sizeof(Uint32));
+    } else {
+        _mm256_storeu_si256((__m256i *)pixels, v);
+    }
+}
+
+/* Load up to 16 16-bit pixels, going through a temporary buffer at the end of a row */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") LoadPixels16AVX2(const Uint16 *pixels, int count)
+{
+    if (count < 16) {
+        Uint16 buffer[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+        SDL_memcpy(buffer, pixels, count * sizeof(Uint16));
+        return _mm256_loadu_si256((const __m256i *)buffer);
+    }
+    return _mm256_loadu_si256((const __m256i *)pixels);
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") StorePixels16AVX2(Uint16 *pixels, __m256i v, int count)
+{
+    if (count < 16) {
+        Uint16 buffer[16];
+        _mm256_storeu_si256((__m256i *)buffer, v);
+        SDL_memcpy(pixels, buffer, count * sizeof(Uint16));
+    } else {
+        _mm256_storeu_si256((__m256i *)pixels, v);
+    }
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SelectAVX2(__m256i mask, __m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, mask);
+}
+
+/* 0xFFFF in the 16-bit lanes that an 8888 channel mask lands in after unpacking to 16 bits */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") ChannelMask16AVX2(Uint32 mask)
+{
+    __m128i lanes = _mm_cvtsi32_si128((int)mask);
+    lanes = _mm_unpacklo_epi8(lanes, lanes);
+    return _mm256_broadcastq_epi64(lanes);
+}
+
+/* The AVX2 version of BlendPixelAlpha8888SSE2, for 8 pixels at a time */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") BlendPixelAlpha8888AVX2(__m256i src, __m256i dst, __m256i amask, __m128i ashift, __m256i achannel)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i alpha = _mm256_and_si256(src, amask);
+    __m256i a, srca_lo, srca_hi, dsta_lo, dsta_hi, res_lo, res_hi, result;
+
+    /* Spread each pixel's alpha over the 16-bit lanes of its channels */
+    a = _mm256_srl_epi32(alpha, ashift);
+    a = _mm256_or_si256(a, _mm256_slli_epi32(a, 16));
+    dsta_lo = _mm256_unpacklo_epi32(a, a);
+    dsta_hi = _mm256_unpackhi_epi32(a, a);
+
+    /* The alpha channel is weighted by 256 so srcA comes through exactly */
+    srca_lo = SelectAVX2(achannel, _mm256_set1_epi16(256), dsta_lo);
+    srca_hi = SelectAVX2(achannel, _mm256_set1_epi16(256), dsta_hi);
+    dsta_lo = _mm256_xor_si256(dsta_lo, _mm256_set1_epi16(0xFF));
+    dsta_hi = _mm256_xor_si256(dsta_hi, _mm256_set1_epi16(0xFF));
+
+    res_lo = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(src, zero), srca_lo), 8),
+                              _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(dst, zero), dsta_lo), 8));
+    res_hi = _mm256_add_epi16(_mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(src, zero), srca_hi), 8),
+                              _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(dst, zero), dsta_hi), 8));
+    result = _mm256_packus_epi16(res_lo, res_hi);
+
+    result = SelectAVX2(_mm256_cmpeq_epi32(alpha, amask), src, result);
+    return SelectAVX2(_mm256_cmpeq_epi32(alpha, zero), dst, result);
+}
+
+/* fast ARGB888->(A)RGB888 blending with pixel alpha */
+static void SDL_TARGETING("avx2") BlitRGBtoRGBPixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *sf = info->src_fmt;
+    const __m256i amask = _mm256_set1_epi32((int)sf->Amask);
+    const __m128i ashift = _mm_cvtsi32_si128(sf->Ashift);
+    const __m256i achannel = ChannelMask16AVX2(sf->Amask);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 8) {
+            const __m256i src = LoadPixels32AVX2(srcp + x, width - x);
+            const __m256i dst = LoadPixels32AVX2(dstp + x, width - x);
+            StorePixels32AVX2(dstp + x, BlendPixelAlpha8888AVX2(src, dst, amask, ashift, achannel), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast ARGB888->(A)BGR888 blending with pixel alpha */
+static void SDL_TARGETING("avx2") BlitRGBtoBGRPixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    const __m256i amask = _mm256_set1_epi32((int)0xFF000000);
+    const __m128i ashift = _mm_cvtsi32_si128(24);
+    const __m256i achannel = ChannelMask16AVX2(0xFF000000);
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                                             2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 8) {
+            /* Swap red and blue, then blend as usual */
+            const __m256i src = _mm256_shuffle_epi8(LoadPixels32AVX2(srcp + x, width - x), swizzle);
+            const __m256i dst = LoadPixels32AVX2(dstp + x, width - x);
+            StorePixels32AVX2(dstp + x, BlendPixelAlpha8888AVX2(src, dst, amask, ashift, achannel), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast RGB888->(A)RGB888 blending with surface alpha, the same way BlitRGBtoRGBSurfaceAlphaMMX does */
+static void SDL_TARGETING("avx2") BlitRGBtoRGBSurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint32 *dstp = (Uint32 *)info->dst;
+    int dstskip = info->dst_skip >> 2;
+    SDL_PixelFormat *df = info->dst_fmt;
+    const Uint32 chanmask = (0xFFu << df->Rshift) | (0xFFu << df->Gshift) | (0xFFu << df->Bshift);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i dsta = _mm256_set1_epi32((int)df->Amask);
+    /* The alpha in the 16-bit lanes of the color channels, and 0 in the fourth one */
+    const __m256i alpha = _mm256_and_si256(_mm256_set1_epi16(info->a), ChannelMask16AVX2(chanmask));
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 8) {
+            const __m256i src = LoadPixels32AVX2(srcp + x, width - x);
+            const __m256i dst = LoadPixels32AVX2(dstp + x, width - x);
+            const __m256i dst_lo = _mm256_unpacklo_epi8(dst, zero);
+            const __m256i dst_hi = _mm256_unpackhi_epi8(dst, zero);
+            __m256i res_lo, res_hi;
+
+            /* dst + ((src - dst) * alpha >> 8), wrapping to 8 bits */
+            res_lo = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpacklo_epi8(src, zero), dst_lo), alpha), 8);
+            res_hi = _mm256_srli_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(_mm256_unpackhi_epi8(src, zero), dst_hi), alpha), 8);
+            res_lo = _mm256_add_epi8(res_lo, dst_lo);
+            res_hi = _mm256_add_epi8(res_hi, dst_hi);
+
+            StorePixels32AVX2(dstp + x, _mm256_or_si256(_mm256_packus_epi16(res_lo, res_hi), dsta), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* dst + ((src - dst) * alpha >> 5) for 5 and 6 bit channels in 16-bit lanes */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") BlendChannel16AVX2(__m256i src, __m256i dst, __m256i alpha)
+{
+    return _mm256_add_epi16(dst, _mm256_srai_epi16(_mm256_mullo_epi16(_mm256_sub_epi16(src, dst), alpha), 5));
+}
+
+/* The AVX2 version of Blend16SSE2, for 16 pixels at a time */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") Blend16AVX2(__m256i src, __m256i dst, __m256i alpha, __m128i rshift, __m256i gmask)
+{
+    const __m256i bmask = _mm256_set1_epi16(0x1F);
+    __m256i r, g, b;
+
+    r = BlendChannel16AVX2(_mm256_and_si256(_mm256_srl_epi16(src, rshift), bmask), _mm256_and_si256(_mm256_srl_epi16(dst, rshift), bmask), alpha);
+    g = BlendChannel16AVX2(_mm256_and_si256(_mm256_srli_epi16(src, 5), gmask), _mm256_and_si256(_mm256_srli_epi16(dst, 5), gmask), alpha);
+    b = BlendChannel16AVX2(_mm256_and_si256(src, bmask), _mm256_and_si256(dst, bmask), alpha);
+    return _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi16(r, rshift), _mm256_slli_epi16(g, 5)), b);
+}
+
+static void SDL_TARGETING("avx2") Blit16to16SurfaceAlphaAVX2(SDL_BlitInfo *info, int rshift, Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint16 *srcp = (Uint16 *)info->src;
+    int srcskip = info->src_skip >> 1;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m256i alpha = _mm256_set1_epi16(info->a >> 3); /* downscale alpha to 5 bits */
+    const __m128i shift = _mm_cvtsi32_si128(rshift);
+    const __m256i mask = _mm256_set1_epi16(gmask);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 16) {
+            const __m256i src = LoadPixels16AVX2(srcp + x, width - x);
+            const __m256i dst = LoadPixels16AVX2(dstp + x, width - x);
+            StorePixels16AVX2(dstp + x, Blend16AVX2(src, dst, alpha, shift, mask), width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast RGB565->RGB565 blending with surface alpha */
+static void SDL_TARGETING("avx2") Blit565to565SurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    Blit16to16SurfaceAlphaAVX2(info, 11, 0x3F);
+}
+
+/* fast RGB555->RGB555 blending with surface alpha */
+static void SDL_TARGETING("avx2") Blit555to555SurfaceAlphaAVX2(SDL_BlitInfo *info)
+{
+    Blit16to16SurfaceAlphaAVX2(info, 10, 0x1F);
+}
+
+/* Convert 16 ARGB8888 (or ABGR8888) pixels to the 16-bit channel layout, one channel at a time */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") ExtractChannel8888AVX2(__m256i lo, __m256i hi, __m128i shift, __m256i mask)
+{
+    const __m256i packed = _mm256_packs_epi32(_mm256_and_si256(_mm256_srl_epi32(lo, shift), mask),
+                                              _mm256_and_si256(_mm256_srl_epi32(hi, shift), mask));
+    /* packs works within each 128-bit half, so put the pixels back in order */
+    return _mm256_permute4x64_epi64(packed, _MM_SHUFFLE(3, 1, 2, 0));
+}
+
+static void SDL_TARGETING("avx2") BlitARGBto16PixelAlphaAVX2(SDL_BlitInfo *info, int rshift, Uint16 gmask)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint32 *srcp = (Uint32 *)info->src;
+    int srcskip = info->src_skip >> 2;
+    Uint16 *dstp = (Uint16 *)info->dst;
+    int dstskip = info->dst_skip >> 1;
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i opaque = _mm256_set1_epi16(SDL_ALPHA_OPAQUE >> 3);
+    const __m128i shift = _mm_cvtsi32_si128(rshift);
+    const __m256i rmask = _mm256_set1_epi32(0x1F);
+    const __m256i mask = _mm256_set1_epi32(gmask);
+    const __m256i bmask = _mm256_set1_epi16(0x1F);
+    const __m256i dstgmask = _mm256_set1_epi16(gmask);
+    const __m128i ashift = _mm_cvtsi32_si128(27);
+    const __m128i rsrcshift = _mm_cvtsi32_si128(19);
+    const __m128i gsrcshift = _mm_cvtsi32_si128(gmask == 0x3F ? 10 : 11);
+    const __m128i bsrcshift = _mm_cvtsi32_si128(3);
+
+    while (height--) {
+        int x;
+        for (x = 0; x < width; x += 16) {
+            const __m256i src_lo = LoadPixels32AVX2(srcp + x, width - x);
+            const __m256i src_hi = LoadPixels32AVX2(srcp + x + 8, width - x - 8);
+            const __m256i dst = LoadPixels16AVX2(dstp + x, width - x);
+            __m256i alpha, r, g, b, src, result;
+
+            /* downscale alpha to 5 bits, and the source channels to the destination's depth */
+            alpha = ExtractChannel8888AVX2(src_lo, src_hi, ashift, rmask);
+            r = ExtractChannel8888AVX2(src_lo, src_hi, rsrcshift, rmask);
+            g = ExtractChannel8888AVX2(src_lo, src_hi, gsrcshift, mask);
+            b = ExtractChannel8888AVX2(src_lo, src_hi, bsrcshift, rmask);
+            src = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi16(r, shift), _mm256_slli_epi16(g, 5)), b);
+
+            r = BlendChannel16AVX2(r, _mm256_and_si256(_mm256_srl_epi16(dst, shift), bmask), alpha);
+            g = BlendChannel16AVX2(g, _mm256_and_si256(_mm256_srli_epi16(dst, 5), dstgmask), alpha);
+            b = BlendChannel16AVX2(b, _mm256_and_si256(dst, bmask), alpha);
+            result = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi16(r, shift), _mm256_slli_epi16(g, 5)), b);
+
+            result = SelectAVX2(_mm256_cmpeq_epi16(alpha, opaque), src, result);
+            result = SelectAVX2(_mm256_cmpeq_epi16(alpha, zero), dst, result);
+            StorePixels16AVX2(dstp + x, result, width - x);
+        }
+        srcp += width + srcskip;
+        dstp += width + dstskip;
+    }
+}
+
+/* fast ARGB8888->RGB565 blending with pixel alpha */
+static void SDL_TARGETING("avx2") BlitARGBto565PixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaAVX2(info, 11, 0x3F);
+}
+
+/* fast ARGB8888->RGB555 blending with pixel alpha */
+static void SDL_TARGETING("avx2") BlitARGBto555PixelAlphaAVX2(SDL_BlitInfo *info)
+{
+    BlitARGBto16PixelAlphaAVX2(info, 10, 0x1F);
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
 /* fast RGB565->RGB565 blending with surface alpha */
 static void Blit565to565SurfaceAlpha(SDL_BlitInfo *info)
 {
@@ -1350,8 +1975,28 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 #endif
             if (sf->bytes_per_pixel == 4 && sf->Amask == 0xff000000 && sf->Gmask == 0xff00 && ((sf->Rmask == 0xff && df->Rmask == 0x1f) || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
                 if (df->Gmask == 0x7e0) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitARGBto565PixelAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                    if (SDL_HasSSE2()) {
+                        return BlitARGBto565PixelAlphaSSE2;
+                    }
+#endif
                     return BlitARGBto565PixelAlpha;
                 } else if (df->Gmask == 0x3e0) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitARGBto555PixelAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                    if (SDL_HasSSE2()) {
+                        return BlitARGBto555PixelAlphaSSE2;
+                    }
+#endif
                     return BlitARGBto555PixelAlpha;
                 }
             }
@@ -1359,13 +2004,23 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
         case 4:
             if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->bytes_per_pixel == 4) {
-#ifdef SDL_MMX_INTRINSICS
                 if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitRGBtoRGBPixelAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                    if (SDL_HasSSE2()) {
+                        return BlitRGBtoRGBPixelAlphaSSE2;
+                    }
+#endif
+#ifdef SDL_MMX_INTRINSICS
                     if (SDL_HasMMX()) {
                         return BlitRGBtoRGBPixelAlphaMMX;
                     }
+#endif
                 }
-#endif /* SDL_MMX_INTRINSICS */
                 if (sf->Amask == 0xff000000) {
 #ifdef SDL_ARM_NEON_BLITTERS
                     if (SDL_HasNEON()) {
@@ -1381,6 +2036,16 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                 }
             } else if (sf->Rmask == df->Bmask && sf->Gmask == df->Gmask && sf->Bmask == df->Rmask && sf->bytes_per_pixel == 4) {
                 if (sf->Amask == 0xff000000) {
+#ifdef SDL_AVX2_INTRINSICS
+                    if (SDL_HasAVX2()) {
+                        return BlitRGBtoBGRPixelAlphaAVX2;
+                    }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                    if (SDL_HasSSE2()) {
+                        return BlitRGBtoBGRPixelAlphaSSE2;
+                    }
+#endif
                     return BlitRGBtoBGRPixelAlpha;
                 }
             }
@@ -1407,6 +2072,16 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             case 2:
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
+#ifdef SDL_AVX2_INTRINSICS
+                        if (SDL_HasAVX2()) {
+                            return Blit565to565SurfaceAlphaAVX2;
+                        } else
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                        if (SDL_HasSSE2()) {
+                            return Blit565to565SurfaceAlphaSSE2;
+                        } else
+#endif
 #ifdef SDL_MMX_INTRINSICS
                         if (SDL_HasMMX()) {
                             return Blit565to565SurfaceAlphaMMX;
@@ -1416,6 +2091,16 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                             return Blit565to565SurfaceAlpha;
                         }
                     } else if (df->Gmask == 0x3e0) {
+#ifdef SDL_AVX2_INTRINSICS
+                        if (SDL_HasAVX2()) {
+                            return Blit555to555SurfaceAlphaAVX2;
+                        } else
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                        if (SDL_HasSSE2()) {
+                            return Blit555to555SurfaceAlphaSSE2;
+                        } else
+#endif
 #ifdef SDL_MMX_INTRINSICS
                         if (SDL_HasMMX()) {
                             return Blit555to555SurfaceAlphaMMX;
@@ -1430,11 +2115,23 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
             case 4:
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->bytes_per_pixel == 4) {
+                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0) {
+#ifdef SDL_AVX2_INTRINSICS
+                        if (SDL_HasAVX2()) {
+                            return BlitRGBtoRGBSurfaceAlphaAVX2;
+                        }
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+                        if (SDL_HasSSE2()) {
+                            return BlitRGBtoRGBSurfaceAlphaSSE2;
+                        }
+#endif
 #ifdef SDL_MMX_INTRINSICS
-                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasMMX()) {
-                        return BlitRGBtoRGBSurfaceAlphaMMX;
-                    }
+                        if (SDL_HasMMX()) {
+                            return BlitRGBtoRGBSurfaceAlphaMMX;
+                        }
 #endif
+                    }
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
                         return BlitRGBtoRGBSurfaceAlpha;
                     }
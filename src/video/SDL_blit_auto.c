@@ -6859,132 +6859,14942 @@ static void SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale(SDL_BlitInfo *info)
     }
 }
 
+#ifdef SDL_SSE4_1_INTRINSICS
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_LoadPixels_SSE4_1(const Uint32 *src, int count)
+{
+    if (count < 4) {
+        Uint32 pixels[4] = { 0 };
+        SDL_memcpy(pixels, src, count * sizeof(Uint32));
+        return _mm_loadu_si128((const __m128i *)pixels);
+    }
+    return _mm_loadu_si128((const __m128i *)src);
+}
+
+static SDL_INLINE void SDL_TARGETING("sse4.1") SDL_Blit_StorePixels_SSE4_1(Uint32 *dst, __m128i v, int count)
+{
+    if (count < 4) {
+        Uint32 pixels[4];
+        _mm_storeu_si128((__m128i *)pixels, v);
+        SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+    } else {
+        _mm_storeu_si128((__m128i *)dst, v);
+    }
+}
+
+/* Fetch the next pixels of a scaled row, advancing posx past them */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_GatherPixels_SSE4_1(const Uint8 *src, Uint64 *posx, Uint64 incx, int count)
+{
+    if (count >= 4) {
+        const Uint64 x = *posx;
+        *posx += 4 * incx;
+        return _mm_setr_epi32(
+            *(const Uint32 *)(src + ((x + 0 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 1 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 2 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 3 * incx) >> 16) * 4));
+    } else {
+        Uint32 pixels[4] = { 0 };
+        int i;
+        for (i = 0; i < count; ++i) {
+            pixels[i] = *(const Uint32 *)(src + (*posx >> 16) * 4);
+            *posx += incx;
+        }
+        return _mm_loadu_si128((const __m128i *)pixels);
+    }
+}
+
+/* Exact x / 255 for x < 65535, and at least 255 for anything larger */
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_DivideBy255_SSE4_1(__m128i x)
+{
+    return _mm_srli_epi32(_mm_add_epi32(_mm_add_epi32(x, _mm_set1_epi32(1)), _mm_srli_epi32(x, 8)), 8);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_InvertAlpha_SSE4_1(__m128i a)
+{
+    return _mm_sub_epi32(_mm_set1_epi32(255), a);
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_Clamp_SSE4_1(__m128i x)
+{
+    return _mm_min_epi32(x, _mm_set1_epi32(255));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_Channel0_SSE4_1(__m128i v)
+{
+    return _mm_and_si128(v, _mm_set1_epi32(0xFF));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_Channel8_SSE4_1(__m128i v)
+{
+    return _mm_shuffle_epi8(v, _mm_setr_epi8(1, -1, -1, -1, 5, -1, -1, -1, 9, -1, -1, -1, 13, -1, -1, -1));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_Channel16_SSE4_1(__m128i v)
+{
+    return _mm_shuffle_epi8(v, _mm_setr_epi8(2, -1, -1, -1, 6, -1, -1, -1, 10, -1, -1, -1, 14, -1, -1, -1));
+}
+
+static SDL_INLINE __m128i SDL_TARGETING("sse4.1") SDL_Blit_Channel24_SSE4_1(__m128i v)
+{
+    return _mm_srli_epi32(v, 24);
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+    const __m128i A = _mm_set1_epi32((int)0xFF000000);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            pixel = _mm_or_si128(pixel, A);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    const __m128i A = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    const __m128i A = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    const __m128i A = _mm_set1_epi32((int)0xFF000000);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            pixel = _mm_or_si128(pixel, A);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    const __m128i A = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    const __m128i A = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i srcpixel;
+    const __m128i srcA = _mm_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m128i srcR, srcG, srcB;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            A = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel0_SSE4_1(pixel);
+            A = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel24_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel8_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel24_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel8_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(3, 2, 1, -1, 7, 6, 5, -1, 11, 10, 9, -1, 15, 14, 13, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel24_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel8_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel24_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel8_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel24_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel8_SSE4_1(pixel);
+            A = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel24_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel8_SSE4_1(pixel);
+            A = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            A = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_SSE4_1(pixel);
+            G = SDL_Blit_Channel8_SSE4_1(pixel);
+            B = SDL_Blit_Channel16_SSE4_1(pixel);
+            A = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(3, 2, 1, -1, 7, 6, 5, -1, 11, 10, 9, -1, 15, 14, 13, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel8_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel8_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(R, 16), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstR, 16), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel8_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    __m128i pixel;
+    __m128i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel8_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel24_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(B, 16), _mm_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstB, 16), _mm_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const __m128i swizzle = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m128i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            pixel = _mm_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            R = SDL_Blit_Channel8_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel24_SSE4_1(pixel);
+            A = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i pixel;
+    __m128i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            pixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel8_SSE4_1(pixel);
+            G = SDL_Blit_Channel16_SSE4_1(pixel);
+            B = SDL_Blit_Channel24_SSE4_1(pixel);
+            A = SDL_Blit_Channel0_SSE4_1(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(A, 24), _mm_slli_epi32(R, 16)), _mm_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_LoadPixels_SSE4_1(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("sse4.1") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE4_1(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m128i modulateR = _mm_set1_epi32(info->r);
+    const __m128i modulateG = _mm_set1_epi32(info->g);
+    const __m128i modulateB = _mm_set1_epi32(info->b);
+    const __m128i modulateA = _mm_set1_epi32(info->a);
+    __m128i srcpixel;
+    __m128i srcR, srcG, srcB, srcA;
+    __m128i dstpixel;
+    __m128i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 4) {
+            srcpixel = SDL_Blit_GatherPixels_SSE4_1(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_SSE4_1(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_SSE4_1(srcpixel);
+            srcG = SDL_Blit_Channel16_SSE4_1(srcpixel);
+            srcB = SDL_Blit_Channel24_SSE4_1(srcpixel);
+            srcA = SDL_Blit_Channel0_SSE4_1(srcpixel);
+            dstR = SDL_Blit_Channel16_SSE4_1(dstpixel);
+            dstG = SDL_Blit_Channel8_SSE4_1(dstpixel);
+            dstB = SDL_Blit_Channel0_SSE4_1(dstpixel);
+            dstA = SDL_Blit_Channel24_SSE4_1(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm_add_epi32(srcR, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstR)));
+                dstG = _mm_add_epi32(srcG, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstG)));
+                dstB = _mm_add_epi32(srcB, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstB)));
+                dstA = _mm_add_epi32(srcA, SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(SDL_Blit_InvertAlpha_SSE4_1(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_SSE4_1(_mm_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_SSE4_1(_mm_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcR, dstR), _mm_mullo_epi16(dstR, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstG = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcG, dstG), _mm_mullo_epi16(dstG, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                dstB = SDL_Blit_Clamp_SSE4_1(SDL_Blit_DivideBy255_SSE4_1(_mm_add_epi32(_mm_mullo_epi16(srcB, dstB), _mm_mullo_epi16(dstB, SDL_Blit_InvertAlpha_SSE4_1(srcA)))));
+                break;
+            }
+            dstpixel = _mm_or_si128(_mm_or_si128(_mm_or_si128(_mm_slli_epi32(dstA, 24), _mm_slli_epi32(dstR, 16)), _mm_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_SSE4_1(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* SDL_SSE4_1_INTRINSICS */
+
+#ifdef SDL_AVX2_INTRINSICS
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_LoadPixels_AVX2(const Uint32 *src, int count)
+{
+    if (count < 8) {
+        Uint32 pixels[8] = { 0 };
+        SDL_memcpy(pixels, src, count * sizeof(Uint32));
+        return _mm256_loadu_si256((const __m256i *)pixels);
+    }
+    return _mm256_loadu_si256((const __m256i *)src);
+}
+
+static SDL_INLINE void SDL_TARGETING("avx2") SDL_Blit_StorePixels_AVX2(Uint32 *dst, __m256i v, int count)
+{
+    if (count < 8) {
+        Uint32 pixels[8];
+        _mm256_storeu_si256((__m256i *)pixels, v);
+        SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+    } else {
+        _mm256_storeu_si256((__m256i *)dst, v);
+    }
+}
+
+/* Fetch the next pixels of a scaled row, advancing posx past them */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_GatherPixels_AVX2(const Uint8 *src, Uint64 *posx, Uint64 incx, int count)
+{
+    if (count >= 8) {
+        const Uint64 x = *posx;
+        *posx += 8 * incx;
+        return _mm256_setr_epi32(
+            *(const Uint32 *)(src + ((x + 0 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 1 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 2 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 3 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 4 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 5 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 6 * incx) >> 16) * 4),
+            *(const Uint32 *)(src + ((x + 7 * incx) >> 16) * 4));
+    } else {
+        Uint32 pixels[8] = { 0 };
+        int i;
+        for (i = 0; i < count; ++i) {
+            pixels[i] = *(const Uint32 *)(src + (*posx >> 16) * 4);
+            *posx += incx;
+        }
+        return _mm256_loadu_si256((const __m256i *)pixels);
+    }
+}
+
+/* Exact x / 255 for x < 65535, and at least 255 for anything larger */
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_DivideBy255_AVX2(__m256i x)
+{
+    return _mm256_srli_epi32(_mm256_add_epi32(_mm256_add_epi32(x, _mm256_set1_epi32(1)), _mm256_srli_epi32(x, 8)), 8);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_InvertAlpha_AVX2(__m256i a)
+{
+    return _mm256_sub_epi32(_mm256_set1_epi32(255), a);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Clamp_AVX2(__m256i x)
+{
+    return _mm256_min_epi32(x, _mm256_set1_epi32(255));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Channel0_AVX2(__m256i v)
+{
+    return _mm256_and_si256(v, _mm256_set1_epi32(0xFF));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Channel8_AVX2(__m256i v)
+{
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(1, -1, -1, -1, 5, -1, -1, -1, 9, -1, -1, -1, 13, -1, -1, -1, 1, -1, -1, -1, 5, -1, -1, -1, 9, -1, -1, -1, 13, -1, -1, -1));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Channel16_AVX2(__m256i v)
+{
+    return _mm256_shuffle_epi8(v, _mm256_setr_epi8(2, -1, -1, -1, 6, -1, -1, -1, 10, -1, -1, -1, 14, -1, -1, -1, 2, -1, -1, -1, 6, -1, -1, -1, 10, -1, -1, -1, 14, -1, -1, -1));
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2") SDL_Blit_Channel24_AVX2(__m256i v)
+{
+    return _mm256_srli_epi32(v, 24);
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1, 2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1, 0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+    const __m256i A = _mm256_set1_epi32((int)0xFF000000);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            pixel = _mm256_or_si256(pixel, A);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm256_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm256_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    const __m256i A = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    const __m256i A = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1, 2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1, 2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    const __m256i A = _mm256_set1_epi32((int)0xFF000000);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            pixel = _mm256_or_si256(pixel, A);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm256_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = srcR;
+                dstG = srcG;
+                dstB = srcB;
+                dstA = _mm256_set1_epi32(0xFF);
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    const __m256i A = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    const __m256i A = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i srcpixel;
+    const __m256i srcA = _mm256_set1_epi32((flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF);
+    __m256i srcR, srcG, srcB;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1, 0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1, 2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            A = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel16_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel0_AVX2(pixel);
+            A = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1, 1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel24_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel8_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel24_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel8_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(3, 2, 1, -1, 7, 6, 5, -1, 11, 10, 9, -1, 15, 14, 13, -1, 3, 2, 1, -1, 7, 6, 5, -1, 11, 10, 9, -1, 15, 14, 13, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel24_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel8_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel24_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel8_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel24_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel8_AVX2(pixel);
+            A = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel24_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel8_AVX2(pixel);
+            A = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1, 2, 1, 0, -1, 6, 5, 4, -1, 10, 9, 8, -1, 14, 13, 12, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1, 0, 1, 2, -1, 4, 5, 6, -1, 8, 9, 10, -1, 12, 13, 14, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15, 2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            A = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel0_AVX2(pixel);
+            G = SDL_Blit_Channel8_AVX2(pixel);
+            B = SDL_Blit_Channel16_AVX2(pixel);
+            A = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel0_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel24_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(3, 2, 1, -1, 7, 6, 5, -1, 11, 10, 9, -1, 15, 14, 13, -1, 3, 2, 1, -1, 7, 6, 5, -1, 11, 10, 9, -1, 15, 14, 13, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel8_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel8_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(R, 16), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstR, 16), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1, 1, 2, 3, -1, 5, 6, 7, -1, 9, 10, 11, -1, 13, 14, 15, -1);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel8_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    __m256i pixel;
+    __m256i R, G, B;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel8_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel24_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(B, 16), _mm256_slli_epi32(G, 8)), R);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel16_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstB, 16), _mm256_slli_epi32(dstG, 8)), dstR);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const __m256i swizzle = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+    __m256i pixel;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            pixel = _mm256_shuffle_epi8(pixel, swizzle);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            R = SDL_Blit_Channel8_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel24_AVX2(pixel);
+            A = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i pixel;
+    __m256i R, G, B, A;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            pixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            R = SDL_Blit_Channel8_AVX2(pixel);
+            G = SDL_Blit_Channel16_AVX2(pixel);
+            B = SDL_Blit_Channel24_AVX2(pixel);
+            A = SDL_Blit_Channel0_AVX2(pixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                R = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(R, modulateR));
+                G = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(G, modulateG));
+                B = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(B, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                A = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(A, modulateA));
+            }
+            pixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(A, 24), _mm256_slli_epi32(R, 16)), _mm256_slli_epi32(G, 8)), B);
+            SDL_Blit_StorePixels_AVX2(dst + x, pixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_LoadPixels_AVX2(src + x, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+static void SDL_TARGETING("avx2") SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2(SDL_BlitInfo *info)
+{
+    const int flags = info->flags;
+    const __m256i modulateR = _mm256_set1_epi32(info->r);
+    const __m256i modulateG = _mm256_set1_epi32(info->g);
+    const __m256i modulateB = _mm256_set1_epi32(info->b);
+    const __m256i modulateA = _mm256_set1_epi32(info->a);
+    __m256i srcpixel;
+    __m256i srcR, srcG, srcB, srcA;
+    __m256i dstpixel;
+    __m256i dstR, dstG, dstB, dstA;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += 8) {
+            srcpixel = SDL_Blit_GatherPixels_AVX2(src, &posx, incx, n - x);
+            dstpixel = SDL_Blit_LoadPixels_AVX2(dst + x, n - x);
+            srcR = SDL_Blit_Channel8_AVX2(srcpixel);
+            srcG = SDL_Blit_Channel16_AVX2(srcpixel);
+            srcB = SDL_Blit_Channel24_AVX2(srcpixel);
+            srcA = SDL_Blit_Channel0_AVX2(srcpixel);
+            dstR = SDL_Blit_Channel16_AVX2(dstpixel);
+            dstG = SDL_Blit_Channel8_AVX2(dstpixel);
+            dstB = SDL_Blit_Channel0_AVX2(dstpixel);
+            dstA = SDL_Blit_Channel24_AVX2(dstpixel);
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, modulateR));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, modulateG));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, modulateB));
+            }
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                srcA = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcA, modulateA));
+            }
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                srcR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, srcA));
+                srcG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, srcA));
+                srcB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, srcA));
+            }
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+                dstR = _mm256_add_epi32(srcR, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstR)));
+                dstG = _mm256_add_epi32(srcG, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstG)));
+                dstB = _mm256_add_epi32(srcB, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstB)));
+                dstA = _mm256_add_epi32(srcA, SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(SDL_Blit_InvertAlpha_AVX2(srcA), dstA)));
+                break;
+            case SDL_COPY_ADD:
+                dstR = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcR, dstR));
+                dstG = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcG, dstG));
+                dstB = SDL_Blit_Clamp_AVX2(_mm256_add_epi32(srcB, dstB));
+                break;
+            case SDL_COPY_MOD:
+                dstR = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcR, dstR));
+                dstG = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcG, dstG));
+                dstB = SDL_Blit_DivideBy255_AVX2(_mm256_mullo_epi16(srcB, dstB));
+                break;
+            case SDL_COPY_MUL:
+                dstR = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcR, dstR), _mm256_mullo_epi16(dstR, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstG = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcG, dstG), _mm256_mullo_epi16(dstG, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                dstB = SDL_Blit_Clamp_AVX2(SDL_Blit_DivideBy255_AVX2(_mm256_add_epi32(_mm256_mullo_epi16(srcB, dstB), _mm256_mullo_epi16(dstB, SDL_Blit_InvertAlpha_AVX2(srcA)))));
+                break;
+            }
+            dstpixel = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(_mm256_slli_epi32(dstA, 24), _mm256_slli_epi32(dstR, 16)), _mm256_slli_epi32(dstG, 8)), dstB);
+            SDL_Blit_StorePixels_AVX2(dst + x, dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+#endif /* SDL_AVX2_INTRINSICS */
+
 SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XRGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_XBGR8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XRGB8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XRGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_XBGR8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_XBGR8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XRGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_XBGR8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XRGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_XBGR8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XRGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_XBGR8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XRGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XRGB8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_XBGR8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_XBGR8888_Modulate_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Blend_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Modulate_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend },
+#ifdef SDL_AVX2_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_AVX2, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_AVX2 },
+#endif
+#ifdef SDL_SSE4_1_INTRINSICS
+    { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_SSE4_1, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale_SSE4_1 },
+#endif
     { SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_NEAREST), SDL_CPU_ANY, SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale },
     { 0, 0, 0, 0, NULL }
 };
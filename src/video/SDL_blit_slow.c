@@ -370,8 +370,9 @@ static Uint16 float_to_half(float a)
     return ir;
 }
 
-static void ReadFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelFormat *fmt, SDL_Colorspace colorspace, float SDR_white_point,
-                           float *outR, float *outG, float *outB, float *outA)
+
+static void ReadRawFloatPixel(const Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelFormat *fmt,
+                              float *outR, float *outG, float *outB, float *outA)
 {
     Uint32 pixel;
     Uint32 R, G, B, A;
@@ -394,7 +395,7 @@ static void ReadFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelF
         fA = (float)A / 255.0f;
         break;
     case SlowBlitPixelAccess_10Bit:
-        pixel = *((Uint32 *)pixels);
+        pixel = *((const Uint32 *)pixels);
         switch (fmt->format) {
         case SDL_PIXELFORMAT_XRGB2101010:
             RGBAFLOAT_FROM_ARGB2101010(pixel, fR, fG, fB, fA);
@@ -418,31 +419,31 @@ static void ReadFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelF
     case SlowBlitPixelAccess_Large:
         switch (SDL_PIXELTYPE(fmt->format)) {
         case SDL_PIXELTYPE_ARRAYU16:
-            v[0] = (float)(((Uint16 *)pixels)[0]) / SDL_MAX_UINT16;
-            v[1] = (float)(((Uint16 *)pixels)[1]) / SDL_MAX_UINT16;
-            v[2] = (float)(((Uint16 *)pixels)[2]) / SDL_MAX_UINT16;
+            v[0] = (float)(((const Uint16 *)pixels)[0]) / SDL_MAX_UINT16;
+            v[1] = (float)(((const Uint16 *)pixels)[1]) / SDL_MAX_UINT16;
+            v[2] = (float)(((const Uint16 *)pixels)[2]) / SDL_MAX_UINT16;
             if (fmt->bytes_per_pixel == 8) {
-                v[3] = (float)(((Uint16 *)pixels)[3]) / SDL_MAX_UINT16;
+                v[3] = (float)(((const Uint16 *)pixels)[3]) / SDL_MAX_UINT16;
             } else {
                 v[3] = 1.0f;
             }
             break;
         case SDL_PIXELTYPE_ARRAYF16:
-            v[0] = half_to_float(((Uint16 *)pixels)[0]);
-            v[1] = half_to_float(((Uint16 *)pixels)[1]);
-            v[2] = half_to_float(((Uint16 *)pixels)[2]);
+            v[0] = half_to_float(((const Uint16 *)pixels)[0]);
+            v[1] = half_to_float(((const Uint16 *)pixels)[1]);
+            v[2] = half_to_float(((const Uint16 *)pixels)[2]);
             if (fmt->bytes_per_pixel == 8) {
-                v[3] = half_to_float(((Uint16 *)pixels)[3]);
+                v[3] = half_to_float(((const Uint16 *)pixels)[3]);
             } else {
                 v[3] = 1.0f;
             }
             break;
         case SDL_PIXELTYPE_ARRAYF32:
-            v[0] = ((float *)pixels)[0];
-            v[1] = ((float *)pixels)[1];
-            v[2] = ((float *)pixels)[2];
+            v[0] = ((const float *)pixels)[0];
+            v[1] = ((const float *)pixels)[1];
+            v[2] = ((const float *)pixels)[2];
             if (fmt->bytes_per_pixel == 16) {
-                v[3] = ((float *)pixels)[3];
+                v[3] = ((const float *)pixels)[3];
             } else {
                 v[3] = 1.0f;
             }
@@ -497,62 +498,18 @@ static void ReadFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelF
         break;
     }
 
-    /* Convert to nits so src and dst are guaranteed to be linear and in the same units */
-    switch (SDL_COLORSPACETRANSFER(colorspace)) {
-    case SDL_TRANSFER_CHARACTERISTICS_SRGB:
-        fR = SDL_sRGBtoLinear(fR);
-        fG = SDL_sRGBtoLinear(fG);
-        fB = SDL_sRGBtoLinear(fB);
-        break;
-    case SDL_TRANSFER_CHARACTERISTICS_PQ:
-        fR = SDL_PQtoNits(fR) / SDR_white_point;
-        fG = SDL_PQtoNits(fG) / SDR_white_point;
-        fB = SDL_PQtoNits(fB) / SDR_white_point;
-        break;
-    case SDL_TRANSFER_CHARACTERISTICS_LINEAR:
-        fR /= SDR_white_point;
-        fG /= SDR_white_point;
-        fB /= SDR_white_point;
-        break;
-    default:
-        /* Unknown, leave it alone */
-        break;
-    }
-
     *outR = fR;
     *outG = fG;
     *outB = fB;
     *outA = fA;
 }
 
-static void WriteFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelFormat *fmt, SDL_Colorspace colorspace, float SDR_white_point,
-                            float fR, float fG, float fB, float fA)
+static void WriteRawFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_PixelFormat *fmt,
+                               float fR, float fG, float fB, float fA)
 {
     Uint32 R, G, B, A;
     float v[4];
 
-    /* We converted to nits so src and dst are guaranteed to be linear and in the same units */
-    switch (SDL_COLORSPACETRANSFER(colorspace)) {
-    case SDL_TRANSFER_CHARACTERISTICS_SRGB:
-        fR = SDL_sRGBfromLinear(fR);
-        fG = SDL_sRGBfromLinear(fG);
-        fB = SDL_sRGBfromLinear(fB);
-        break;
-    case SDL_TRANSFER_CHARACTERISTICS_PQ:
-        fR = SDL_PQfromNits(fR * SDR_white_point);
-        fG = SDL_PQfromNits(fG * SDR_white_point);
-        fB = SDL_PQfromNits(fB * SDR_white_point);
-        break;
-    case SDL_TRANSFER_CHARACTERISTICS_LINEAR:
-        fR *= SDR_white_point;
-        fG *= SDR_white_point;
-        fB *= SDR_white_point;
-        break;
-    default:
-        /* Unknown, leave it alone */
-        break;
-    }
-
     switch (access) {
     case SlowBlitPixelAccess_RGB:
         R = (Uint8)SDL_roundf(SDL_clamp(fR, 0.0f, 1.0f) * 255.0f);
@@ -666,6 +623,381 @@ static void WriteFloatPixel(Uint8 *pixels, SlowBlitPixelAccess access, SDL_Pixel
     }
 }
 
+/* Convert to nits so src and dst are guaranteed to be linear and in the same units */
+static float ToLinear(float v, SDL_TransferCharacteristics transfer, float SDR_white_point)
+{
+    switch (transfer) {
+    case SDL_TRANSFER_CHARACTERISTICS_SRGB:
+        return SDL_sRGBtoLinear(v);
+    case SDL_TRANSFER_CHARACTERISTICS_PQ:
+        return SDL_PQtoNits(v) / SDR_white_point;
+    case SDL_TRANSFER_CHARACTERISTICS_LINEAR:
+        return v / SDR_white_point;
+    default:
+        /* Unknown, leave it alone */
+        return v;
+    }
+}
+
+static float FromLinear(float v, SDL_TransferCharacteristics transfer, float SDR_white_point)
+{
+    switch (transfer) {
+    case SDL_TRANSFER_CHARACTERISTICS_SRGB:
+        return SDL_sRGBfromLinear(v);
+    case SDL_TRANSFER_CHARACTERISTICS_PQ:
+        return SDL_PQfromNits(v * SDR_white_point);
+    case SDL_TRANSFER_CHARACTERISTICS_LINEAR:
+        return v * SDR_white_point;
+    default:
+        /* Unknown, leave it alone */
+        return v;
+    }
+}
+
+/* The encoding buckets split each power of two into this many steps */
+#define SLOW_FLOAT_BUCKET_BITS 9
+
+/* How a format is read and written a row at a time by SDL_Blit_Slow_Float()
+ *
+ * Formats with 8-bit or 10-bit color channels can go through tables instead
+ * of evaluating the transfer function for every channel of every pixel:
+ *
+ * linear[] holds the linear value for each channel value, which is exactly
+ * what ReadRawFloatPixel() and ToLinear() would produce.
+ *
+ * thresholds[i] holds the smallest linear value that FromLinear() and
+ * WriteRawFloatPixel() would encode as i + 1 or more, found by searching
+ * the float values around the inverse of the transfer function. Counting
+ * the thresholds at or below a value gives the same channel value as the
+ * math, wherever the math itself doesn't go backwards between two floats.
+ *
+ * buckets[] holds that count for the start of each bucket of float values,
+ * indexed by the exponent and the top bits of the mantissa. The buckets are
+ * small enough that a value is at most a threshold or so past the start.
+ */
+typedef struct
+{
+    SlowBlitPixelAccess access;
+    SDL_PixelFormat *fmt;
+    SDL_TransferCharacteristics transfer;
+    float SDR_white_point;
+    Uint32 max_value;
+    float *linear;
+    float *thresholds;
+    Uint16 *buckets;
+    Sint32 bucket_base;
+    Sint32 num_buckets;
+} SlowBlitFloatFormat;
+
+static void InitFloatFormat(SlowBlitFloatFormat *format, SDL_PixelFormat *fmt, SDL_Colorspace colorspace, float SDR_white_point)
+{
+    SDL_zerop(format);
+    format->access = GetPixelAccessMethod(fmt);
+    format->fmt = fmt;
+    format->transfer = SDL_COLORSPACETRANSFER(colorspace);
+    format->SDR_white_point = SDR_white_point;
+
+    switch (format->access) {
+    case SlowBlitPixelAccess_RGB:
+    case SlowBlitPixelAccess_RGBA:
+        format->max_value = 255;
+        break;
+    case SlowBlitPixelAccess_10Bit:
+        switch (fmt->format) {
+        case SDL_PIXELFORMAT_XRGB2101010:
+        case SDL_PIXELFORMAT_XBGR2101010:
+        case SDL_PIXELFORMAT_ARGB2101010:
+        case SDL_PIXELFORMAT_ABGR2101010:
+            format->max_value = 1023;
+            break;
+        default:
+            break;
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+static void QuitFloatFormat(SlowBlitFloatFormat *format)
+{
+    SDL_free(format->linear);
+    SDL_free(format->thresholds);
+    SDL_free(format->buckets);
+}
+
+static void BuildDecodeTable(SlowBlitFloatFormat *format)
+{
+    Uint32 i;
+
+    if (!format->max_value) {
+        return;
+    }
+
+    format->linear = (float *)SDL_malloc((format->max_value + 1) * sizeof(float));
+    if (!format->linear) {
+        /* We'll do the math for each pixel instead */
+        return;
+    }
+    for (i = 0; i <= format->max_value; ++i) {
+        format->linear[i] = ToLinear((float)i / (float)format->max_value, format->transfer, format->SDR_white_point);
+    }
+}
+
+static Uint32 EncodeChannel(const SlowBlitFloatFormat *format, float v)
+{
+    v = FromLinear(v, format->transfer, format->SDR_white_point);
+    return (Uint32)SDL_roundf(SDL_clamp(v, 0.0f, 1.0f) * (float)format->max_value);
+}
+
+static float FloatFromBits(Uint32 bits)
+{
+    FP32 v;
+
+    v.u = bits;
+    return v.f;
+}
+
+static float FindEncodeThreshold(const SlowBlitFloatFormat *format, Uint32 value)
+{
+    /* Non-negative floats sort the same way as their bit patterns, so search those */
+    const Uint32 max_bits = 0x7F7FFFFF;
+    FP32 guess;
+    Uint32 lo, hi, step;
+
+    guess.f = ToLinear(((float)value - 0.5f) / (float)format->max_value, format->transfer, format->SDR_white_point);
+    if (!(guess.f > 0.0f)) {
+        guess.u = 0;
+    } else if (guess.u > max_bits) {
+        guess.u = max_bits;
+    }
+
+    step = 1024;
+    lo = (guess.u > step) ? guess.u - step : 0;
+    while (lo > 0 && EncodeChannel(format, FloatFromBits(lo)) >= value) {
+        step *= 2;
+        lo = (lo > step) ? lo - step : 0;
+    }
+    if (lo == 0 && EncodeChannel(format, 0.0f) >= value) {
+        return 0.0f;
+    }
+
+    step = 1024;
+    hi = (max_bits - guess.u > step) ? guess.u + step : max_bits;
+    while (hi < max_bits && EncodeChannel(format, FloatFromBits(hi)) < value) {
+        step *= 2;
+        hi = (max_bits - hi > step) ? hi + step : max_bits;
+    }
+
+    while (hi - lo > 1) {
+        const Uint32 mid = lo + (hi - lo) / 2;
+        if (EncodeChannel(format, FloatFromBits(mid)) >= value) {
+            hi = mid;
+        } else {
+            lo = mid;
+        }
+    }
+    return FloatFromBits(hi);
+}
+
+static void BuildEncodeTable(SlowBlitFloatFormat *format)
+{
+    const int shift = 23 - SLOW_FLOAT_BUCKET_BITS;
+    FP32 lo, hi;
+    Sint32 i;
+    Uint32 value;
+
+    if (!format->max_value ||
+        (format->transfer != SDL_TRANSFER_CHARACTERISTICS_SRGB &&
+         format->transfer != SDL_TRANSFER_CHARACTERISTICS_PQ)) {
+        /* Other transfer functions are cheap enough to evaluate directly */
+        return;
+    }
+
+    format->thresholds = (float *)SDL_malloc(format->max_value * sizeof(float));
+    if (!format->thresholds) {
+        /* We'll do the math for each pixel instead */
+        return;
+    }
+    for (value = 0; value < format->max_value; ++value) {
+        format->thresholds[value] = FindEncodeThreshold(format, value + 1);
+        if (value > 0 && format->thresholds[value] < format->thresholds[value - 1]) {
+            format->thresholds[value] = format->thresholds[value - 1];
+        }
+    }
+
+    /* Cover whole powers of two from the first threshold to past the last one */
+    lo.f = format->thresholds[0];
+    hi.f = format->thresholds[format->max_value - 1];
+    if (!(lo.f > 0.0f) || hi.u >= 0x7F000000) {
+        SDL_free(format->thresholds);
+        format->thresholds = NULL;
+        return;
+    }
+    format->bucket_base = (Sint32)(lo.u & 0xFF800000);
+    format->num_buckets = (Sint32)(((hi.u & 0xFF800000) + 0x00800000 - (Uint32)format->bucket_base) >> shift);
+
+    format->buckets = (Uint16 *)SDL_malloc(format->num_buckets * sizeof(Uint16));
+    if (!format->buckets) {
+        SDL_free(format->thresholds);
+        format->thresholds = NULL;
+        return;
+    }
+    value = 0;
+    for (i = 0; i < format->num_buckets; ++i) {
+        const float edge = FloatFromBits((Uint32)format->bucket_base + ((Uint32)i << shift));
+        while (value < format->max_value && format->thresholds[value] <= edge) {
+            ++value;
+        }
+        format->buckets[i] = (Uint16)value;
+    }
+}
+
+static SDL_INLINE Uint32 EncodeChannelFromTable(const SlowBlitFloatFormat *format, float v)
+{
+    FP32 bits;
+    Sint32 index;
+    Uint32 value;
+
+    bits.f = v;
+    if ((Sint32)bits.u < format->bucket_base) {
+        /* Negative or below the first threshold */
+        return 0;
+    }
+    index = ((Sint32)bits.u - format->bucket_base) >> (23 - SLOW_FLOAT_BUCKET_BITS);
+    if (index >= format->num_buckets) {
+        return format->max_value;
+    }
+
+    value = format->buckets[index];
+    while (value < format->max_value && v >= format->thresholds[value]) {
+        ++value;
+    }
+    return value;
+}
+
+static void ReadFloatRow(const SlowBlitFloatFormat *format, const Uint8 *src, Uint64 posx, Uint64 incx, int count,
+                         float *R, float *G, float *B, float *A)
+{
+    SDL_PixelFormat *fmt = format->fmt;
+    const int bpp = fmt->bytes_per_pixel;
+    const float *linear = format->linear;
+    Uint32 pixel;
+    Uint32 r, g, b, a;
+    int i;
+
+    if (linear && format->access == SlowBlitPixelAccess_RGB) {
+        for (i = 0; i < count; ++i, posx += incx) {
+            const Uint8 *p = src + (posx >> 16) * bpp;
+            DISEMBLE_RGB(p, bpp, fmt, pixel, r, g, b);
+            R[i] = linear[r];
+            G[i] = linear[g];
+            B[i] = linear[b];
+            A[i] = 1.0f;
+        }
+    } else if (linear && format->access == SlowBlitPixelAccess_RGBA) {
+        for (i = 0; i < count; ++i, posx += incx) {
+            const Uint8 *p = src + (posx >> 16) * bpp;
+            DISEMBLE_RGBA(p, bpp, fmt, pixel, r, g, b, a);
+            R[i] = linear[r];
+            G[i] = linear[g];
+            B[i] = linear[b];
+            A[i] = (float)a / 255.0f;
+        }
+    } else if (linear && format->access == SlowBlitPixelAccess_10Bit) {
+        const SDL_bool bgr = (fmt->format == SDL_PIXELFORMAT_XBGR2101010 || fmt->format == SDL_PIXELFORMAT_ABGR2101010);
+        const SDL_bool opaque = (fmt->format == SDL_PIXELFORMAT_XRGB2101010 || fmt->format == SDL_PIXELFORMAT_XBGR2101010);
+        const int rshift = bgr ? 0 : 20;
+        const int bshift = bgr ? 20 : 0;
+
+        for (i = 0; i < count; ++i, posx += incx) {
+            pixel = *(const Uint32 *)(src + (posx >> 16) * 4);
+            R[i] = linear[(pixel >> rshift) & 0x3FF];
+            G[i] = linear[(pixel >> 10) & 0x3FF];
+            B[i] = linear[(pixel >> bshift) & 0x3FF];
+            A[i] = opaque ? 1.0f : (float)SDL_expand_byte[6][(pixel >> 30)] / 255.0f;
+        }
+    } else {
+        for (i = 0; i < count; ++i, posx += incx) {
+            ReadRawFloatPixel(src + (posx >> 16) * bpp, format->access, fmt, &R[i], &G[i], &B[i], &A[i]);
+            R[i] = ToLinear(R[i], format->transfer, format->SDR_white_point);
+            G[i] = ToLinear(G[i], format->transfer, format->SDR_white_point);
+            B[i] = ToLinear(B[i], format->transfer, format->SDR_white_point);
+        }
+    }
+}
+
+static SDL_INLINE Uint32 EncodeColor(const SlowBlitFloatFormat *format, float v)
+{
+    if (format->thresholds) {
+        return EncodeChannelFromTable(format, v);
+    }
+    return EncodeChannel(format, v);
+}
+
+static SDL_INLINE Uint32 EncodeAlpha(float a, float max_value)
+{
+    if (a >= 1.0f) {
+        /* Opaque, the common case */
+        return (Uint32)max_value;
+    }
+    return (Uint32)SDL_roundf(SDL_clamp(a, 0.0f, 1.0f) * max_value);
+}
+
+static void WriteFloatRow(const SlowBlitFloatFormat *format, Uint8 *dst, int count,
+                          const float *R, const float *G, const float *B, const float *A)
+{
+    SDL_PixelFormat *fmt = format->fmt;
+    const int bpp = fmt->bytes_per_pixel;
+    Uint32 r, g, b, a;
+    int i;
+
+    switch (format->max_value ? format->access : SlowBlitPixelAccess_Large) {
+    case SlowBlitPixelAccess_RGB:
+        for (i = 0; i < count; ++i, dst += bpp) {
+            r = EncodeColor(format, R[i]);
+            g = EncodeColor(format, G[i]);
+            b = EncodeColor(format, B[i]);
+            ASSEMBLE_RGB(dst, bpp, fmt, r, g, b);
+        }
+        break;
+    case SlowBlitPixelAccess_RGBA:
+        for (i = 0; i < count; ++i, dst += bpp) {
+            r = EncodeColor(format, R[i]);
+            g = EncodeColor(format, G[i]);
+            b = EncodeColor(format, B[i]);
+            a = EncodeAlpha(A[i], 255.0f);
+            ASSEMBLE_RGBA(dst, bpp, fmt, r, g, b, a);
+        }
+        break;
+    case SlowBlitPixelAccess_10Bit:
+    {
+        const SDL_bool bgr = (fmt->format == SDL_PIXELFORMAT_XBGR2101010 || fmt->format == SDL_PIXELFORMAT_ABGR2101010);
+        const SDL_bool opaque = (fmt->format == SDL_PIXELFORMAT_XRGB2101010 || fmt->format == SDL_PIXELFORMAT_XBGR2101010);
+        const int rshift = bgr ? 0 : 20;
+        const int bshift = bgr ? 20 : 0;
+
+        for (i = 0; i < count; ++i, dst += 4) {
+            r = EncodeColor(format, R[i]);
+            g = EncodeColor(format, G[i]);
+            b = EncodeColor(format, B[i]);
+            a = opaque ? 3 : EncodeAlpha(A[i], 3.0f);
+            *(Uint32 *)dst = (a << 30) | (r << rshift) | (g << 10) | (b << bshift);
+        }
+        break;
+    }
+    default:
+        for (i = 0; i < count; ++i, dst += bpp) {
+            WriteRawFloatPixel(dst, format->access, fmt,
+                               FromLinear(R[i], format->transfer, format->SDR_white_point),
+                               FromLinear(G[i], format->transfer, format->SDR_white_point),
+                               FromLinear(B[i], format->transfer, format->SDR_white_point),
+                               A[i]);
+        }
+        break;
+    }
+}
+
 typedef enum
 {
     SDL_TONEMAP_NONE,
@@ -692,11 +1024,93 @@ typedef struct
 
 } SDL_TonemapContext;
 
-static void TonemapLinear(float *r, float *g, float *b, float scale)
+#ifdef SDL_SSE_INTRINSICS
+static void SDL_TARGETING("sse") ConvertColorPrimariesRowSSE(float *R, float *G, float *B, int count, const float *matrix)
 {
-    *r *= scale;
-    *g *= scale;
-    *b *= scale;
+    const __m128 m00 = _mm_set1_ps(matrix[0 * 3 + 0]);
+    const __m128 m01 = _mm_set1_ps(matrix[0 * 3 + 1]);
+    const __m128 m02 = _mm_set1_ps(matrix[0 * 3 + 2]);
+    const __m128 m10 = _mm_set1_ps(matrix[1 * 3 + 0]);
+    const __m128 m11 = _mm_set1_ps(matrix[1 * 3 + 1]);
+    const __m128 m12 = _mm_set1_ps(matrix[1 * 3 + 2]);
+    const __m128 m20 = _mm_set1_ps(matrix[2 * 3 + 0]);
+    const __m128 m21 = _mm_set1_ps(matrix[2 * 3 + 1]);
+    const __m128 m22 = _mm_set1_ps(matrix[2 * 3 + 2]);
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        const __m128 r = _mm_loadu_ps(&R[i]);
+        const __m128 g = _mm_loadu_ps(&G[i]);
+        const __m128 b = _mm_loadu_ps(&B[i]);
+
+        _mm_storeu_ps(&R[i], _mm_add_ps(_mm_add_ps(_mm_mul_ps(m00, r), _mm_mul_ps(m01, g)), _mm_mul_ps(m02, b)));
+        _mm_storeu_ps(&G[i], _mm_add_ps(_mm_add_ps(_mm_mul_ps(m10, r), _mm_mul_ps(m11, g)), _mm_mul_ps(m12, b)));
+        _mm_storeu_ps(&B[i], _mm_add_ps(_mm_add_ps(_mm_mul_ps(m20, r), _mm_mul_ps(m21, g)), _mm_mul_ps(m22, b)));
+    }
+    for (; i < count; ++i) {
+        SDL_ConvertColorPrimaries(&R[i], &G[i], &B[i], matrix);
+    }
+}
+
+static void SDL_TARGETING("sse") TonemapChromeRowSSE(float *R, float *G, float *B, int count, float tonemap_a, float tonemap_b)
+{
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 a = _mm_set1_ps(tonemap_a);
+    const __m128 b = _mm_set1_ps(tonemap_b);
+    int i;
+
+    for (i = 0; i + 4 <= count; i += 4) {
+        const __m128 r = _mm_loadu_ps(&R[i]);
+        const __m128 g = _mm_loadu_ps(&G[i]);
+        const __m128 bl = _mm_loadu_ps(&B[i]);
+        const __m128 vmax = _mm_max_ps(r, _mm_max_ps(g, bl));
+        const __m128 positive = _mm_cmpgt_ps(vmax, zero);
+        __m128 scale = _mm_div_ps(_mm_add_ps(one, _mm_mul_ps(a, vmax)), _mm_add_ps(one, _mm_mul_ps(b, vmax)));
+
+        /* Leave pixels without a positive channel alone */
+        scale = _mm_or_ps(_mm_and_ps(positive, scale), _mm_andnot_ps(positive, one));
+        _mm_storeu_ps(&R[i], _mm_mul_ps(r, scale));
+        _mm_storeu_ps(&G[i], _mm_mul_ps(g, scale));
+        _mm_storeu_ps(&B[i], _mm_mul_ps(bl, scale));
+    }
+    for (; i < count; ++i) {
+        const float vmax = SDL_max(R[i], SDL_max(G[i], B[i]));
+
+        if (vmax > 0.0f) {
+            const float scale = (1.0f + tonemap_a * vmax) / (1.0f + tonemap_b * vmax);
+            R[i] *= scale;
+            G[i] *= scale;
+            B[i] *= scale;
+        }
+    }
+}
+#endif /* SDL_SSE_INTRINSICS */
+
+static void ConvertColorPrimariesRow(float *R, float *G, float *B, int count, const float *matrix)
+{
+    int i;
+
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        ConvertColorPrimariesRowSSE(R, G, B, count, matrix);
+        return;
+    }
+#endif
+    for (i = 0; i < count; ++i) {
+        SDL_ConvertColorPrimaries(&R[i], &G[i], &B[i], matrix);
+    }
+}
+
+static void TonemapLinearRow(float *R, float *G, float *B, int count, float scale)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        R[i] *= scale;
+        G[i] *= scale;
+        B[i] *= scale;
+    }
 }
 
 /* This uses the same tonemapping algorithm developed by Google for Chrome:
@@ -710,30 +1124,39 @@ static void TonemapLinear(float *r, float *g, float *b, float scale)
  * Then you normalize your source color by the HDR whitepoint,
  * and calculate a final scaling factor in BT.2020 colorspace.
  */
-static void TonemapChrome(float *r, float *g, float *b, float tonemap_a, float tonemap_b)
+static void TonemapChromeRow(float *R, float *G, float *B, int count, float tonemap_a, float tonemap_b)
 {
-    float v1 = *r;
-    float v2 = *g;
-    float v3 = *b;
-    float vmax = SDL_max(v1, SDL_max(v2, v3));
+    int i;
 
-    if (vmax > 0.0f) {
-        float scale = (1.0f + tonemap_a * vmax) / (1.0f + tonemap_b * vmax);
-        TonemapLinear(r, g, b, scale);
+#ifdef SDL_SSE_INTRINSICS
+    if (SDL_HasSSE()) {
+        TonemapChromeRowSSE(R, G, B, count, tonemap_a, tonemap_b);
+        return;
+    }
+#endif
+    for (i = 0; i < count; ++i) {
+        const float vmax = SDL_max(R[i], SDL_max(G[i], B[i]));
+
+        if (vmax > 0.0f) {
+            const float scale = (1.0f + tonemap_a * vmax) / (1.0f + tonemap_b * vmax);
+            R[i] *= scale;
+            G[i] *= scale;
+            B[i] *= scale;
+        }
     }
 }
 
-static void ApplyTonemap(SDL_TonemapContext *ctx, float *r, float *g, float *b)
+static void ApplyTonemapRow(SDL_TonemapContext *ctx, float *R, float *G, float *B, int count)
 {
     switch (ctx->op) {
     case SDL_TONEMAP_LINEAR:
-        TonemapLinear(r, g, b, ctx->data.linear.scale);
+        TonemapLinearRow(R, G, B, count, ctx->data.linear.scale);
         break;
     case SDL_TONEMAP_CHROME:
         if (ctx->data.chrome.color_primaries_matrix) {
-            SDL_ConvertColorPrimaries(r, g, b, ctx->data.chrome.color_primaries_matrix);
+            ConvertColorPrimariesRow(R, G, B, count, ctx->data.chrome.color_primaries_matrix);
         }
-        TonemapChrome(r, g, b, ctx->data.chrome.a, ctx->data.chrome.b);
+        TonemapChromeRow(R, G, B, count, ctx->data.chrome.a, ctx->data.chrome.b);
         break;
     default:
         break;
@@ -742,25 +1165,31 @@ static void ApplyTonemap(SDL_TonemapContext *ctx, float *r, float *g, float *b)
 
 /* The SECOND TRUE BLITTER
  * This one is even slower than the first, but also handles large pixel formats and colorspace conversion
+ *
+ * It works on a row at a time: each stage converts the whole row, with the
+ * channels kept in separate arrays of linear values so the color math can
+ * be done on several pixels at once.
  */
 void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
 {
     const int flags = info->flags;
+    const int blend = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
     const Uint32 modulateR = info->r;
     const Uint32 modulateG = info->g;
     const Uint32 modulateB = info->b;
     const Uint32 modulateA = info->a;
-    float srcR, srcG, srcB, srcA;
-    float dstR, dstG, dstB, dstA;
-    Uint64 srcy, srcx;
-    Uint64 posy, posx;
+    const int width = info->dst_w;
+    float *row;
+    float *srcR, *srcG, *srcB, *srcA;
+    float *dstR, *dstG, *dstB, *dstA;
+    Uint64 srcy;
+    Uint64 posy;
     Uint64 incy, incx;
+    Sint64 num_pixels;
     SDL_PixelFormat *src_fmt = info->src_fmt;
     SDL_PixelFormat *dst_fmt = info->dst_fmt;
-    int srcbpp = src_fmt->bytes_per_pixel;
-    int dstbpp = dst_fmt->bytes_per_pixel;
-    SlowBlitPixelAccess src_access;
-    SlowBlitPixelAccess dst_access;
+    SlowBlitFloatFormat src_format;
+    SlowBlitFloatFormat dst_format;
     SDL_Colorspace src_colorspace;
     SDL_Colorspace dst_colorspace;
     SDL_ColorPrimaries src_primaries;
@@ -771,6 +1200,7 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
     float dst_headroom;
     float src_headroom;
     SDL_TonemapContext tonemap;
+    int i;
 
     if (SDL_GetSurfaceColorspace(info->src_surface, &src_colorspace) < 0 ||
         SDL_GetSurfaceColorspace(info->dst_surface, &dst_colorspace) < 0) {
@@ -821,96 +1251,127 @@ void SDL_Blit_Slow_Float(SDL_BlitInfo *info)
         color_primaries_matrix = SDL_GetColorPrimariesConversionMatrix(src_primaries, dst_primaries);
     }
 
-    src_access = GetPixelAccessMethod(src_fmt);
-    dst_access = GetPixelAccessMethod(dst_fmt);
+    row = (float *)SDL_malloc(8 * (size_t)width * sizeof(float));
+    if (!row) {
+        SDL_OutOfMemory();
+        return;
+    }
+    srcR = row;
+    srcG = srcR + width;
+    srcB = srcG + width;
+    srcA = srcB + width;
+    dstR = srcA + width;
+    dstG = dstR + width;
+    dstB = dstG + width;
+    dstA = dstB + width;
+
+    InitFloatFormat(&src_format, src_fmt, src_colorspace, src_white_point);
+    InitFloatFormat(&dst_format, dst_fmt, dst_colorspace, dst_white_point);
+
+    /* Building a table costs about a conversion per entry for decoding and
+     * a few dozen per entry for encoding, so only do that when there are
+     * enough pixels to make up for it.
+     */
+    num_pixels = (Sint64)width * info->dst_h;
+    if (num_pixels > (Sint64)src_format.max_value) {
+        BuildDecodeTable(&src_format);
+    }
+    if (blend && num_pixels > (Sint64)dst_format.max_value) {
+        BuildDecodeTable(&dst_format);
+    }
+    if (num_pixels > 32 * (Sint64)dst_format.max_value) {
+        BuildEncodeTable(&dst_format);
+    }
 
     incy = ((Uint64)info->src_h << 16) / info->dst_h;
     incx = ((Uint64)info->src_w << 16) / info->dst_w;
     posy = incy / 2; /* start at the middle of pixel */
 
     while (info->dst_h--) {
-        Uint8 *src = 0;
-        Uint8 *dst = info->dst;
-        int n = info->dst_w;
-        posx = incx / 2; /* start at the middle of pixel */
         srcy = posy >> 16;
-        while (n--) {
-            srcx = posx >> 16;
-            src = (info->src + (srcy * info->src_pitch) + (srcx * srcbpp));
 
-            ReadFloatPixel(src, src_access, src_fmt, src_colorspace, src_white_point, &srcR, &srcG, &srcB, &srcA);
+        ReadFloatRow(&src_format, info->src + (srcy * info->src_pitch), incx / 2 /* start at the middle of pixel */, incx, width, srcR, srcG, srcB, srcA);
 
-            if (tonemap.op) {
-                ApplyTonemap(&tonemap, &srcR, &srcG, &srcB);
-            }
+        if (tonemap.op) {
+            ApplyTonemapRow(&tonemap, srcR, srcG, srcB, width);
+        }
 
-            if (color_primaries_matrix) {
-                SDL_ConvertColorPrimaries(&srcR, &srcG, &srcB, color_primaries_matrix);
-            }
+        if (color_primaries_matrix) {
+            ConvertColorPrimariesRow(srcR, srcG, srcB, width, color_primaries_matrix);
+        }
 
-            if (flags & SDL_COPY_COLORKEY) {
-                /* colorkey isn't supported */
-            }
-            if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL))) {
-                ReadFloatPixel(dst, dst_access, dst_fmt, dst_colorspace, dst_white_point, &dstR, &dstG, &dstB, &dstA);
-            } else {
-                /* don't care */
-                dstR = dstG = dstB = dstA = 0.0f;
-            }
+        if (flags & SDL_COPY_COLORKEY) {
+            /* colorkey isn't supported */
+        }
+        if (blend) {
+            ReadFloatRow(&dst_format, info->dst, 0, (Uint64)1 << 16, width, dstR, dstG, dstB, dstA);
+        }
 
-            if (flags & SDL_COPY_MODULATE_COLOR) {
-                srcR = (srcR * modulateR) / 255;
-                srcG = (srcG * modulateG) / 255;
-                srcB = (srcB * modulateB) / 255;
+        if (flags & SDL_COPY_MODULATE_COLOR) {
+            for (i = 0; i < width; ++i) {
+                srcR[i] = (srcR[i] * modulateR) / 255;
+                srcG[i] = (srcG[i] * modulateG) / 255;
+                srcB[i] = (srcB[i] * modulateB) / 255;
             }
-            if (flags & SDL_COPY_MODULATE_ALPHA) {
-                srcA = (srcA * modulateA) / 255;
+        }
+        if (flags & SDL_COPY_MODULATE_ALPHA) {
+            for (i = 0; i < width; ++i) {
+                srcA[i] = (srcA[i] * modulateA) / 255;
             }
-            if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
-                /* This goes away if we ever use premultiplied alpha */
-                if (srcA < 1.0f) {
-                    srcR = (srcR * srcA);
-                    srcG = (srcG * srcA);
-                    srcB = (srcB * srcA);
+        }
+        if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
+            /* This goes away if we ever use premultiplied alpha */
+            for (i = 0; i < width; ++i) {
+                if (srcA[i] < 1.0f) {
+                    srcR[i] = (srcR[i] * srcA[i]);
+                    srcG[i] = (srcG[i] * srcA[i]);
+                    srcB[i] = (srcB[i] * srcA[i]);
                 }
             }
-            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
-            case 0:
-                dstR = srcR;
-                dstG = srcG;
-                dstB = srcB;
-                dstA = srcA;
-                break;
-            case SDL_COPY_BLEND:
-                dstR = srcR + ((1.0f - srcA) * dstR);
-                dstG = srcG + ((1.0f - srcA) * dstG);
-                dstB = srcB + ((1.0f - srcA) * dstB);
-                dstA = srcA + ((1.0f - srcA) * dstA);
-                break;
-            case SDL_COPY_ADD:
-                dstR = srcR + dstR;
-                dstG = srcG + dstG;
-                dstB = srcB + dstB;
-                break;
-            case SDL_COPY_MOD:
-                dstR = (srcR * dstR);
-                dstG = (srcG * dstG);
-                dstB = (srcB * dstB);
-                break;
-            case SDL_COPY_MUL:
-                dstR = ((srcR * dstR) + (dstR * (1.0f - srcA)));
-                dstG = ((srcG * dstG) + (dstG * (1.0f - srcA)));
-                dstB = ((srcB * dstB) + (dstB * (1.0f - srcA)));
-                break;
+        }
+        switch (blend) {
+        case 0:
+            WriteFloatRow(&dst_format, info->dst, width, srcR, srcG, srcB, srcA);
+            break;
+        case SDL_COPY_BLEND:
+            for (i = 0; i < width; ++i) {
+                dstR[i] = srcR[i] + ((1.0f - srcA[i]) * dstR[i]);
+                dstG[i] = srcG[i] + ((1.0f - srcA[i]) * dstG[i]);
+                dstB[i] = srcB[i] + ((1.0f - srcA[i]) * dstB[i]);
+                dstA[i] = srcA[i] + ((1.0f - srcA[i]) * dstA[i]);
             }
-
-            WriteFloatPixel(dst, dst_access, dst_fmt, dst_colorspace, dst_white_point, dstR, dstG, dstB, dstA);
-
-            posx += incx;
-            dst += dstbpp;
+            break;
+        case SDL_COPY_ADD:
+            for (i = 0; i < width; ++i) {
+                dstR[i] = srcR[i] + dstR[i];
+                dstG[i] = srcG[i] + dstG[i];
+                dstB[i] = srcB[i] + dstB[i];
+            }
+            break;
+        case SDL_COPY_MOD:
+            for (i = 0; i < width; ++i) {
+                dstR[i] = (srcR[i] * dstR[i]);
+                dstG[i] = (srcG[i] * dstG[i]);
+                dstB[i] = (srcB[i] * dstB[i]);
+            }
+            break;
+        case SDL_COPY_MUL:
+            for (i = 0; i < width; ++i) {
+                dstR[i] = ((srcR[i] * dstR[i]) + (dstR[i] * (1.0f - srcA[i])));
+                dstG[i] = ((srcG[i] * dstG[i]) + (dstG[i] * (1.0f - srcA[i])));
+                dstB[i] = ((srcB[i] * dstB[i]) + (dstB[i] * (1.0f - srcA[i])));
+            }
+            break;
         }
+        if (blend) {
+            WriteFloatRow(&dst_format, info->dst, width, dstR, dstG, dstB, dstA);
+        }
+
         posy += incy;
         info->dst += info->dst_pitch;
     }
-}
 
+    QuitFloatFormat(&src_format);
+    QuitFloatFormat(&dst_format);
+    SDL_free(row);
+}
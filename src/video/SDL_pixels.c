@@ -26,6 +26,7 @@
 #include "SDL_blit.h"
 #include "SDL_pixels_c.h"
 #include "SDL_RLEaccel_c.h"
+#include "../SDL_hashtable.h"
 #include "../SDL_list.h"
 
 /* Lookup tables to expand partial bytes to the full 0..255 range */
@@ -1034,6 +1035,217 @@ void SDL_ConvertColorPrimaries(float *fR, float *fG, float *fB, const float *mat
     *fB = matrix[2 * 3 + 0] * v[0] + matrix[2 * 3 + 1] * v[1] + matrix[2 * 3 + 2] * v[2];
 }
 
+/* Nearest color search for SDL_FindColor()
+ *
+ * RGBA space is split into cells, and each cell lists the palette entries
+ * that could be the nearest to some color inside it: those whose closest
+ * point in the cell is no farther than the farthest point of the entry that
+ * is best in the worst case. A search then only has to compare against that
+ * list, in palette order, so it finds exactly what a search of the whole
+ * palette would. Cells are filled in the first time a color lands in them.
+ *
+ * Lookups live in a table keyed by the palettes made by SDL_CreatePalette(),
+ * so SDL_Palette itself doesn't change. Palettes built anywhere else aren't
+ * in it, and are always searched in full. Each search holds a reference on
+ * the lookup it uses, so a palette can drop its lookup while another thread
+ * is still searching it.
+ */
+#define PALETTE_LOOKUP_MIN_COLORS 32 /* smaller palettes are quicker to search directly */
+#define PALETTE_CELL_BITS_RGB     3
+#define PALETTE_CELL_BITS_A       2
+#define PALETTE_NUM_CELLS         (1 << (3 * PALETTE_CELL_BITS_RGB + PALETTE_CELL_BITS_A))
+
+typedef struct SDL_PaletteLookup
+{
+    SDL_AtomicInt refcount;
+
+    /* The palette the cells were built from */
+    Uint32 version;
+    int ncolors;
+
+    /* NULL until used, then the number of entries minus one followed by their indices */
+    Uint8 *cells[PALETTE_NUM_CELLS];
+} SDL_PaletteLookup;
+
+static SDL_HashTable *palette_lookups;
+static SDL_SpinLock palette_lookups_lock = 0;
+
+static int SDL_GetPaletteCell(Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    return ((r >> (8 - PALETTE_CELL_BITS_RGB)) << (2 * PALETTE_CELL_BITS_RGB + PALETTE_CELL_BITS_A)) |
+           ((g >> (8 - PALETTE_CELL_BITS_RGB)) << (PALETTE_CELL_BITS_RGB + PALETTE_CELL_BITS_A)) |
+           ((b >> (8 - PALETTE_CELL_BITS_RGB)) << PALETTE_CELL_BITS_A) |
+           (a >> (8 - PALETTE_CELL_BITS_A));
+}
+
+/* Squared distances from v to the closest and farthest ends of [lo, hi] */
+static void SDL_GetRangeDistances(int v, int lo, int hi, unsigned int *nearest, unsigned int *farthest)
+{
+    int near_d = (v < lo) ? (lo - v) : (v > hi) ? (v - hi) : 0;
+    int far_d = SDL_max(SDL_abs(v - lo), SDL_abs(v - hi));
+
+    *nearest += (unsigned int)(near_d * near_d);
+    *farthest += (unsigned int)(far_d * far_d);
+}
+
+static Uint8 *SDL_BuildPaletteCell(const SDL_Palette *pal, int cell)
+{
+    const int rgb_size = 1 << (8 - PALETTE_CELL_BITS_RGB);
+    const int a_size = 1 << (8 - PALETTE_CELL_BITS_A);
+    const int r0 = ((cell >> (2 * PALETTE_CELL_BITS_RGB + PALETTE_CELL_BITS_A)) & ((1 << PALETTE_CELL_BITS_RGB) - 1)) * rgb_size;
+    const int g0 = ((cell >> (PALETTE_CELL_BITS_RGB + PALETTE_CELL_BITS_A)) & ((1 << PALETTE_CELL_BITS_RGB) - 1)) * rgb_size;
+    const int b0 = ((cell >> PALETTE_CELL_BITS_A) & ((1 << PALETTE_CELL_BITS_RGB) - 1)) * rgb_size;
+    const int a0 = (cell & ((1 << PALETTE_CELL_BITS_A) - 1)) * a_size;
+    unsigned int nearest[256];
+    unsigned int bound = ~0U;
+    Uint8 *entries;
+    int i, count;
+
+    for (i = 0; i < pal->ncolors; ++i) {
+        const SDL_Color *color = &pal->colors[i];
+        unsigned int farthest = 0;
+
+        nearest[i] = 0;
+        SDL_GetRangeDistances(color->r, r0, r0 + rgb_size - 1, &nearest[i], &farthest);
+        SDL_GetRangeDistances(color->g, g0, g0 + rgb_size - 1, &nearest[i], &farthest);
+        SDL_GetRangeDistances(color->b, b0, b0 + rgb_size - 1, &nearest[i], &farthest);
+        SDL_GetRangeDistances(color->a, a0, a0 + a_size - 1, &nearest[i], &farthest);
+        bound = SDL_min(bound, farthest);
+    }
+
+    count = 0;
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (nearest[i] <= bound) {
+            ++count;
+        }
+    }
+
+    entries = (Uint8 *)SDL_malloc(1 + count);
+    if (!entries) {
+        return NULL;
+    }
+    entries[0] = (Uint8)(count - 1);
+    count = 0;
+    for (i = 0; i < pal->ncolors; ++i) {
+        if (nearest[i] <= bound) {
+            entries[1 + count++] = (Uint8)i;
+        }
+    }
+    return entries;
+}
+
+static void SDL_ReleasePaletteLookup(SDL_PaletteLookup *lookup)
+{
+    int i;
+
+    if (lookup && SDL_AtomicDecRef(&lookup->refcount)) {
+        for (i = 0; i < PALETTE_NUM_CELLS; ++i) {
+            SDL_free(lookup->cells[i]);
+        }
+        SDL_free(lookup);
+    }
+}
+
+/* Give a palette from SDL_CreatePalette() an entry, so searches can build a lookup for it */
+static void SDL_AddPaletteLookup(SDL_Palette *palette)
+{
+    if (palette->ncolors < PALETTE_LOOKUP_MIN_COLORS || palette->ncolors > 256) {
+        return;
+    }
+
+    SDL_LockSpinlock(&palette_lookups_lock);
+    if (!palette_lookups) {
+        palette_lookups = SDL_CreateHashTable(NULL, 32, SDL_HashID, SDL_KeyMatchID, NULL, SDL_FALSE);
+    }
+    /* If this fails, the palette is just searched in full */
+    SDL_InsertIntoHashTable(palette_lookups, palette, NULL);
+    SDL_UnlockSpinlock(&palette_lookups_lock);
+}
+
+/* Drop the palette's lookup, and its entry too if the palette is going away */
+static void SDL_ResetPaletteLookup(SDL_Palette *palette, SDL_bool destroyed)
+{
+    const void *value = NULL;
+
+    SDL_LockSpinlock(&palette_lookups_lock);
+    if (SDL_FindInHashTable(palette_lookups, palette, &value)) {
+        SDL_RemoveFromHashTable(palette_lookups, palette);
+        if (!destroyed) {
+            /* This can't fail, the slot we just freed is still there */
+            SDL_InsertIntoHashTable(palette_lookups, palette, NULL);
+        } else if (SDL_HashTableEmpty(palette_lookups)) {
+            SDL_DestroyHashTable(palette_lookups);
+            palette_lookups = NULL;
+        }
+    }
+    SDL_UnlockSpinlock(&palette_lookups_lock);
+
+    /* Searches still using it hold their own reference */
+    SDL_ReleasePaletteLookup((SDL_PaletteLookup *)value);
+}
+
+/* Returns a reference to the palette's lookup, or NULL to search the whole palette */
+static SDL_PaletteLookup *SDL_AcquirePaletteLookup(SDL_Palette *pal)
+{
+    SDL_PaletteLookup *lookup = NULL;
+    SDL_PaletteLookup *stale = NULL;
+    const void *value;
+
+    if (pal->ncolors < PALETTE_LOOKUP_MIN_COLORS || pal->ncolors > 256) {
+        return NULL;
+    }
+
+    SDL_LockSpinlock(&palette_lookups_lock);
+    if (SDL_FindInHashTable(palette_lookups, pal, &value)) {
+        lookup = (SDL_PaletteLookup *)value;
+        if (lookup && (lookup->version != pal->version || lookup->ncolors != pal->ncolors)) {
+            /* The palette changed without SDL_SetPaletteColors(), which drops the lookup */
+            stale = lookup;
+            lookup = NULL;
+        }
+        if (!lookup) {
+            lookup = (SDL_PaletteLookup *)SDL_calloc(1, sizeof(*lookup));
+            if (lookup) {
+                SDL_AtomicSet(&lookup->refcount, 1);
+                lookup->version = pal->version;
+                lookup->ncolors = pal->ncolors;
+            }
+            SDL_RemoveFromHashTable(palette_lookups, pal);
+            SDL_InsertIntoHashTable(palette_lookups, pal, lookup);
+        }
+        if (lookup) {
+            SDL_AtomicIncRef(&lookup->refcount);
+        }
+    }
+    SDL_UnlockSpinlock(&palette_lookups_lock);
+
+    SDL_ReleasePaletteLookup(stale);
+
+    return lookup;
+}
+
+/* Returns the palette entries that might be nearest to the color, or NULL to search them all */
+static const Uint8 *SDL_GetPaletteCellEntries(SDL_PaletteLookup *lookup, const SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    Uint8 *entries;
+    int cell;
+
+    cell = SDL_GetPaletteCell(r, g, b, a);
+    entries = (Uint8 *)SDL_AtomicGetPtr((void **)&lookup->cells[cell]);
+    if (!entries) {
+        entries = SDL_BuildPaletteCell(pal, cell);
+        if (!entries) {
+            return NULL;
+        }
+        if (!SDL_AtomicCompareAndSwapPointer((void **)&lookup->cells[cell], NULL, entries)) {
+            /* Another thread got there first */
+            SDL_free(entries);
+            entries = (Uint8 *)SDL_AtomicGetPtr((void **)&lookup->cells[cell]);
+        }
+    }
+    return entries;
+}
+
 SDL_Palette *SDL_CreatePalette(int ncolors)
 {
     SDL_Palette *palette;
@@ -1059,6 +1271,7 @@ SDL_Palette *SDL_CreatePalette(int ncolors)
     palette->refcount = 1;
 
     SDL_memset(palette->colors, 0xFF, ncolors * sizeof(*palette->colors));
+    SDL_AddPaletteLookup(palette);
 
     return palette;
 }
@@ -1108,6 +1321,7 @@ int SDL_SetPaletteColors(SDL_Palette *palette, const SDL_Color *colors,
         SDL_memcpy(palette->colors + firstcolor, colors,
                    ncolors * sizeof(*colors));
     }
+    SDL_ResetPaletteLookup(palette, SDL_FALSE);
     ++palette->version;
     if (!palette->version) {
         palette->version = 1;
@@ -1124,6 +1338,7 @@ void SDL_DestroyPalette(SDL_Palette *palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_ResetPaletteLookup(palette, SDL_TRUE);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -1168,7 +1383,34 @@ Uint8 SDL_FindColor(SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     int i;
     Uint8 pixel = 0;
 
+    SDL_PaletteLookup *lookup = SDL_AcquirePaletteLookup(pal);
+    const Uint8 *entries = lookup ? SDL_GetPaletteCellEntries(lookup, pal, r, g, b, a) : NULL;
+
     smallest = ~0U;
+    if (entries) {
+        const int count = entries[0] + 1;
+        int j;
+
+        for (j = 1; j <= count; ++j) {
+            i = entries[j];
+            rd = pal->colors[i].r - r;
+            gd = pal->colors[i].g - g;
+            bd = pal->colors[i].b - b;
+            ad = pal->colors[i].a - a;
+            distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+            if (distance < smallest) {
+                pixel = (Uint8)i;
+                if (distance == 0) { /* Perfect match! */
+                    break;
+                }
+                smallest = distance;
+            }
+        }
+        SDL_ReleasePaletteLookup(lookup);
+        return pixel;
+    }
+    SDL_ReleasePaletteLookup(lookup);
+
     for (i = 0; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
         gd = pal->colors[i].g - g;
@@ -22,18 +22,40 @@
 
 #include "SDL_blit.h"
 
-static int SDL_LowerSoftStretchNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
-static int SDL_LowerSoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
+static int SDL_LowerSoftStretchNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, int y_start, int y_end);
+static int SDL_LowerSoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, int y_start, int y_end);
+
+typedef struct
+{
+    SDL_Surface *src;
+    const SDL_Rect *srcrect;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    SDL_ScaleMode scaleMode;
+} SDL_StretchBands;
+
+static void SDL_SoftStretchBand(void *userdata, int band, int num_bands)
+{
+    const SDL_StretchBands *bands = (const SDL_StretchBands *)userdata;
+    const int y_start = (int)((Sint64)bands->dstrect->h * band / num_bands);
+    const int y_end = (int)((Sint64)bands->dstrect->h * (band + 1) / num_bands);
+
+    if (bands->scaleMode == SDL_SCALEMODE_NEAREST) {
+        SDL_LowerSoftStretchNearest(bands->src, bands->srcrect, bands->dst, bands->dstrect, y_start, y_end);
+    } else {
+        SDL_LowerSoftStretchLinear(bands->src, bands->srcrect, bands->dst, bands->dstrect, y_start, y_end);
+    }
+}
 
 int SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
                     SDL_Surface *dst, const SDL_Rect *dstrect,
                     SDL_ScaleMode scaleMode)
 {
-    int ret;
     int src_locked;
     int dst_locked;
     SDL_Rect full_src;
     SDL_Rect full_dst;
+    SDL_StretchBands bands;
 
 
     if (src->format->format != dst->format->format) {
@@ -111,11 +133,13 @@ int SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
         src_locked = 1;
     }
 
-    if (scaleMode == SDL_SCALEMODE_NEAREST) {
-        ret = SDL_LowerSoftStretchNearest(src, srcrect, dst, dstrect);
-    } else {
-        ret = SDL_LowerSoftStretchLinear(src, srcrect, dst, dstrect);
-    }
+    /* Each band of destination rows is scaled independently, maybe on another thread */
+    bands.src = src;
+    bands.srcrect = srcrect;
+    bands.dst = dst;
+    bands.dstrect = dstrect;
+    bands.scaleMode = scaleMode;
+    SDL_RunBlitBands(SDL_SoftStretchBand, &bands, dstrect->w, dstrect->h);
 
     /* We need to unlock the surfaces if they're locked */
     if (dst_locked) {
@@ -125,7 +149,7 @@ int SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
         SDL_UnlockSurface(src);
     }
 
-    return ret;
+    return 0;
 }
 
 /* bilinear interpolation precision must be < 8
@@ -156,7 +180,9 @@ int SDL_SoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
     left_pad_w_init = left_pad_w;                                                     \
     right_pad_w_init = right_pad_w;                                                   \
     dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
+    middle_init = dst_w - left_pad_w - right_pad_w;                                   \
+    fp_sum_h += (Sint64)y_start * fp_step_h;                                          \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)y_start * dst_pitch);
 
 #define BILINEAR___HEIGHT                                              \
     int index_h, frac_h0, frac_h1, middle;                             \
@@ -284,11 +310,11 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
 }
 
 static int scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch,
-                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
 
         BILINEAR___HEIGHT
 
@@ -404,11 +430,11 @@ static SDL_INLINE void SDL_TARGETING("sse2") INTERPOL_BILINEAR_SSE(const Uint32
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static int SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static int SDL_TARGETING("sse2") scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         int nb_block2;
         __m128i v_frac_h0;
         __m128i v_frac_h1;
@@ -568,11 +594,11 @@ static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1
     *dst = vget_lane_u32(CAST_uint32x2_t e0, 0);
 }
 
-static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     BILINEAR___START
 
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         int nb_block4;
         uint8x8_t v_frac_h0, v_frac_h1;
 
@@ -787,7 +813,7 @@ static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch
 #endif
 
 int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
-                               SDL_Surface *d, const SDL_Rect *dstrect)
+                               SDL_Surface *d, const SDL_Rect *dstrect, int y_start, int y_end)
 {
     int ret = -1;
     int src_w = srcrect->w;
@@ -801,18 +827,18 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
 
 #ifdef SDL_NEON_INTRINSICS
     if (ret == -1 && hasNEON()) {
-        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     }
 #endif
 
 #ifdef SDL_SSE2_INTRINSICS
     if (ret == -1 && hasSSE2()) {
-        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     }
 #endif
 
     if (ret == -1) {
-        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     }
 
     return ret;
@@ -828,7 +854,8 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + y_start * incy;     \
+    dst = (Uint32 *)((Uint8 *)dst + (size_t)y_start * dst_pitch);
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -838,11 +865,11 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     n = dst_w;
 
 static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -858,11 +885,11 @@ static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -878,11 +905,11 @@ static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -900,11 +927,11 @@ static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y_start, int y_end)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y_start; i < y_end; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -920,7 +947,7 @@ static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
-                                SDL_Surface *d, const SDL_Rect *dstrect)
+                                SDL_Surface *d, const SDL_Rect *dstrect, int y_start, int y_end)
 {
     int src_w = srcrect->w;
     int src_h = srcrect->h;
@@ -935,12 +962,12 @@ int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
     Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
 
     if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch, y_start, y_end);
     }
 }
@@ -61,6 +61,9 @@ extern int SDL_SetWindowTextureVSync(struct SDL_VideoDevice *_this, SDL_Window *
 
 extern int SDL_ReadSurfacePixel(SDL_Surface *surface, int x, int y, Uint8 *r, Uint8 *g, Uint8 *b, Uint8 *a);
 
+/* Stops the worker threads used by large surface blits, if there are any */
+extern void SDL_QuitBlitThreads(void);
+
 #if defined(SDL_VIDEO_DRIVER_X11) || defined(SDL_VIDEO_DRIVER_WAYLAND) || defined(SDL_VIDEO_DRIVER_EMSCRIPTEN)
 const char *SDL_GetCSSCursorName(SDL_SystemCursor id, const char **fallback_name);
 #endif
@@ -85,6 +85,101 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
 );
 
+# Where each channel lives in the formats above, used by the SIMD blitters
+my %format_shifts = (
+    "XRGB8888" => { "R" => 16, "G" => 8, "B" => 0 },
+    "XBGR8888" => { "B" => 16, "G" => 8, "R" => 0 },
+    "ARGB8888" => { "A" => 24, "R" => 16, "G" => 8, "B" => 0 },
+    "RGBA8888" => { "R" => 24, "G" => 16, "B" => 8, "A" => 0 },
+    "ABGR8888" => { "A" => 24, "B" => 16, "G" => 8, "R" => 0 },
+    "BGRA8888" => { "B" => 24, "G" => 16, "R" => 8, "A" => 0 },
+);
+
+# The SIMD instruction sets we generate blitters for.
+# Each channel is unpacked into its own 32-bit lane per pixel, so the math
+# below mirrors the scalar blitters exactly, one statement at a time.
+# Channel products never exceed 255 * 255, so a 16-bit multiply is enough.
+my %simd = (
+    "SSE4_1" => {
+        "define" => "SDL_SSE4_1_INTRINSICS",
+        "cpu" => "SDL_CPU_SSE4_1",
+        "target" => " SDL_TARGETING(\"sse4.1\")",
+        "type" => "__m128i",
+        "width" => 4,
+        "set1" => "_mm_set1_epi32(%s)",
+        "load" => "_mm_loadu_si128((const __m128i *)%s)",
+        "store" => "_mm_storeu_si128((__m128i *)%s, %s)",
+        "and" => "_mm_and_si128(%s, %s)",
+        "or" => "_mm_or_si128(%s, %s)",
+        "add" => "_mm_add_epi32(%s, %s)",
+        "sub" => "_mm_sub_epi32(%s, %s)",
+        "mul" => "_mm_mullo_epi16(%s, %s)",
+        "min" => "_mm_min_epi32(%s, %s)",
+        "srl" => "_mm_srli_epi32(%s, %s)",
+        "sll" => "_mm_slli_epi32(%s, %s)",
+        "shuffle" => "_mm_shuffle_epi8(%s, %s)",
+        "bytes" => "_mm_setr_epi8(%s)",
+        "setr" => "_mm_setr_epi32(%s)",
+    },
+    "AVX2" => {
+        "define" => "SDL_AVX2_INTRINSICS",
+        "cpu" => "SDL_CPU_AVX2",
+        "target" => " SDL_TARGETING(\"avx2\")",
+        "type" => "__m256i",
+        "width" => 8,
+        "set1" => "_mm256_set1_epi32(%s)",
+        "load" => "_mm256_loadu_si256((const __m256i *)%s)",
+        "store" => "_mm256_storeu_si256((__m256i *)%s, %s)",
+        "and" => "_mm256_and_si256(%s, %s)",
+        "or" => "_mm256_or_si256(%s, %s)",
+        "add" => "_mm256_add_epi32(%s, %s)",
+        "sub" => "_mm256_sub_epi32(%s, %s)",
+        "mul" => "_mm256_mullo_epi16(%s, %s)",
+        "min" => "_mm256_min_epi32(%s, %s)",
+        "srl" => "_mm256_srli_epi32(%s, %s)",
+        "sll" => "_mm256_slli_epi32(%s, %s)",
+        "shuffle" => "_mm256_shuffle_epi8(%s, %s)",
+        "bytes" => "_mm256_setr_epi8(%s)",
+        "setr" => "_mm256_setr_epi32(%s)",
+    },
+    "NEON" => {
+        "define" => "SDL_NEON_INTRINSICS",
+        "cpu" => "SDL_CPU_NEON",
+        "target" => "",
+        "type" => "uint32x4_t",
+        "width" => 4,
+        "set1" => "vdupq_n_u32(%s)",
+        "load" => "vld1q_u32(%s)",
+        "store" => "vst1q_u32(%s, %s)",
+        "and" => "vandq_u32(%s, %s)",
+        "or" => "vorrq_u32(%s, %s)",
+        "add" => "vaddq_u32(%s, %s)",
+        "sub" => "vsubq_u32(%s, %s)",
+        "mul" => "vmulq_u32(%s, %s)",
+        "min" => "vminq_u32(%s, %s)",
+        "srl" => "vshrq_n_u32(%s, %s)",
+        "sll" => "vshlq_n_u32(%s, %s)",
+    },
+);
+
+# The NEON variants haven't been built and checked with test/testblitauto on ARM yet,
+# run with --neon to generate them anyway
+my $generate_neon = (@ARGV && $ARGV[0] eq "--neon");
+
+# The order the variants are listed in the blit table, best first
+my @simd_isas = grep { $generate_neon || $_ ne "NEON" } (
+    "AVX2",
+    "SSE4_1",
+    "NEON",
+);
+
+# The order the variants are written to SDL_blit_auto.c
+my @simd_sections = grep { $generate_neon || $_ ne "NEON" } (
+    "SSE4_1",
+    "AVX2",
+    "NEON",
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Can't open $name.new: $!";
@@ -152,6 +247,7 @@ sub output_copyfuncname
     my $scale = shift;
     my $args = shift;
     my $suffix = shift;
+    my $isa = shift;
 
     print FILE "$prefix SDL_Blit_${src}_${dst}";
     if ( $modulate ) {
@@ -163,6 +259,9 @@ sub output_copyfuncname
     if ( $scale ) {
         print FILE "_Scale";
     }
+    if ( defined $isa ) {
+        print FILE "_$isa";
+    }
     if ( $args ) {
         print FILE "(SDL_BlitInfo *info)";
     }
@@ -575,6 +674,551 @@ __EOF__
 __EOF__
 }
 
+sub simd_op
+{
+    my $isa = shift;
+    my $op = shift;
+
+    return sprintf($simd{$isa}{$op}, @_);
+}
+
+sub simd_byte_mask
+{
+    my $isa = shift;
+    my @bytes = @_;
+    my @mask;
+
+    # AVX2 shuffles within each 128-bit half, so the pattern repeats every 4 pixels
+    for (my $i = 0; $i < $simd{$isa}{width}; ++$i) {
+        for (my $j = 0; $j < 4; ++$j) {
+            my $byte = $bytes[$j];
+            if ( $byte >= 0 ) {
+                $byte += ($i % 4) * 4;
+            }
+            push(@mask, $byte);
+        }
+    }
+    return simd_op($isa, "bytes", join(", ", @mask));
+}
+
+sub output_simdhelpers
+{
+    my $isa = shift;
+    my $type = $simd{$isa}{type};
+    my $width = $simd{$isa}{width};
+    my $target = $simd{$isa}{target};
+    my $ff = simd_op($isa, "set1", "0xFF");
+
+    my $load_partial = simd_op($isa, "load", "pixels");
+    my $load = simd_op($isa, "load", "src");
+    my $store_partial = simd_op($isa, "store", "pixels", "v");
+    my $store = simd_op($isa, "store", "dst", "v");
+    my $gather;
+    if ( defined $simd{$isa}{setr} ) {
+        # Setting the lanes directly avoids a store forwarding stall when loading them back
+        my @lanes;
+        for (my $i = 0; $i < $width; ++$i) {
+            push(@lanes, "*(const Uint32 *)(src + ((x + $i * incx) >> 16) * 4)");
+        }
+        my $setr = simd_op($isa, "setr", "\n            " . join(",\n            ", @lanes));
+        $gather = <<__EOF__;
+    if (count >= $width) {
+        const Uint64 x = *posx;
+        *posx += $width * incx;
+        return $setr;
+    } else {
+        Uint32 pixels[$width] = { 0 };
+        int i;
+        for (i = 0; i < count; ++i) {
+            pixels[i] = *(const Uint32 *)(src + (*posx >> 16) * 4);
+            *posx += incx;
+        }
+        return $load_partial;
+    }
+__EOF__
+    } else {
+        $gather = <<__EOF__;
+    Uint32 pixels[$width] = { 0 };
+    int i;
+    for (i = 0; i < count && i < $width; ++i) {
+        pixels[i] = *(const Uint32 *)(src + (*posx >> 16) * 4);
+        *posx += incx;
+    }
+    return $load_partial;
+__EOF__
+    }
+    chomp($gather);
+    my $divide = simd_op($isa, "srl", simd_op($isa, "add", simd_op($isa, "add", "x", simd_op($isa, "set1", "1")), simd_op($isa, "srl", "x", "8")), "8");
+    my $invert = simd_op($isa, "sub", simd_op($isa, "set1", "255"), "a");
+    my $clamp = simd_op($isa, "min", "x", simd_op($isa, "set1", "255"));
+    my $channel0 = simd_op($isa, "and", "v", $ff);
+    my $channel8;
+    my $channel16;
+    my $channel24 = simd_op($isa, "srl", "v", "24");
+    if ( defined $simd{$isa}{shuffle} ) {
+        $channel8 = simd_op($isa, "shuffle", "v", simd_byte_mask($isa, 1, -1, -1, -1));
+        $channel16 = simd_op($isa, "shuffle", "v", simd_byte_mask($isa, 2, -1, -1, -1));
+    } else {
+        $channel8 = simd_op($isa, "and", simd_op($isa, "srl", "v", "8"), $ff);
+        $channel16 = simd_op($isa, "and", simd_op($isa, "srl", "v", "16"), $ff);
+    }
+
+    print FILE <<__EOF__;
+static SDL_INLINE $type$target SDL_Blit_LoadPixels_$isa(const Uint32 *src, int count)
+{
+    if (count < $width) {
+        Uint32 pixels[$width] = { 0 };
+        SDL_memcpy(pixels, src, count * sizeof(Uint32));
+        return $load_partial;
+    }
+    return $load;
+}
+
+static SDL_INLINE void$target SDL_Blit_StorePixels_$isa(Uint32 *dst, $type v, int count)
+{
+    if (count < $width) {
+        Uint32 pixels[$width];
+        $store_partial;
+        SDL_memcpy(dst, pixels, count * sizeof(Uint32));
+    } else {
+        $store;
+    }
+}
+
+/* Fetch the next pixels of a scaled row, advancing posx past them */
+static SDL_INLINE $type$target SDL_Blit_GatherPixels_$isa(const Uint8 *src, Uint64 *posx, Uint64 incx, int count)
+{
+$gather
+}
+
+/* Exact x / 255 for x < 65535, and at least 255 for anything larger */
+static SDL_INLINE $type$target SDL_Blit_DivideBy255_$isa($type x)
+{
+    return $divide;
+}
+
+static SDL_INLINE $type$target SDL_Blit_InvertAlpha_$isa($type a)
+{
+    return $invert;
+}
+
+static SDL_INLINE $type$target SDL_Blit_Clamp_$isa($type x)
+{
+    return $clamp;
+}
+
+static SDL_INLINE $type$target SDL_Blit_Channel0_$isa($type v)
+{
+    return $channel0;
+}
+
+static SDL_INLINE $type$target SDL_Blit_Channel8_$isa($type v)
+{
+    return $channel8;
+}
+
+static SDL_INLINE $type$target SDL_Blit_Channel16_$isa($type v)
+{
+    return $channel16;
+}
+
+static SDL_INLINE $type$target SDL_Blit_Channel24_$isa($type v)
+{
+    return $channel24;
+}
+
+__EOF__
+}
+
+sub simd_get_rgba
+{
+    my $isa = shift;
+    my $prefix = shift;
+    my $format = shift;
+    my $ignore_alpha = shift;
+    my $shifts = $format_shifts{$format};
+
+    foreach my $channel ("R", "G", "B", "A") {
+        if ( !exists $shifts->{$channel} || ($ignore_alpha && $channel eq "A") ) {
+            next;
+        }
+        print FILE "            ${prefix}$channel = SDL_Blit_Channel$shifts->{$channel}_$isa(${prefix}pixel);\n";
+    }
+}
+
+sub simd_set_rgba
+{
+    my $isa = shift;
+    my $prefix = shift;
+    my $format = shift;
+    my $shifts = $format_shifts{$format};
+    my $string = "";
+
+    foreach my $channel (sort { $shifts->{$b} <=> $shifts->{$a} } keys %$shifts) {
+        my $term = "${prefix}$channel";
+        if ( $shifts->{$channel} ) {
+            $term = simd_op($isa, "sll", $term, $shifts->{$channel});
+        }
+        if ( $string eq "" ) {
+            $string = $term;
+        } else {
+            $string = simd_op($isa, "or", $string, $term);
+        }
+    }
+    print FILE "            ${prefix}pixel = $string;\n";
+}
+
+sub output_simdcore
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $is_modulateA_done = shift;
+    my $A_is_const_FF = shift;
+    my $s = "";
+    my $d = "";
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
+
+    if (!$modulate && !$blend) {
+        if ( $src eq $dst ) {
+            return;
+        }
+        if ( defined $simd{$isa}{shuffle} ) {
+            print FILE "            pixel = " . simd_op($isa, "shuffle", "pixel", "swizzle") . ";\n";
+            if ( $dst_has_alpha && !$src_has_alpha ) {
+                print FILE "            pixel = " . simd_op($isa, "or", "pixel", "A") . ";\n";
+            }
+            return;
+        }
+    }
+
+    if ( $blend ) {
+        simd_get_rgba($isa, "src", $src, $ignore_dst_alpha);
+        simd_get_rgba($isa, "dst", $dst, !$dst_has_alpha);
+        $s = "src";
+        $d = "dst";
+    } else {
+        simd_get_rgba($isa, "", $src, $ignore_dst_alpha);
+    }
+
+    my $Div = "SDL_Blit_DivideBy255_$isa";
+    my $Inv = "SDL_Blit_InvertAlpha_$isa";
+    my $Clamp = "SDL_Blit_Clamp_$isa";
+    my %mul;
+    my %add;
+    foreach my $c ("R", "G", "B", "A") {
+        $mul{"$c*mod"} = simd_op($isa, "mul", "${s}$c", "modulate$c");
+        $mul{"$c*A"} = simd_op($isa, "mul", "${s}$c", "${s}A");
+        $mul{"inv*$c"} = simd_op($isa, "mul", "$Inv(${s}A)", "${d}$c");
+        $mul{"$c*$c"} = simd_op($isa, "mul", "${s}$c", "${d}$c");
+        $add{"blend$c"} = simd_op($isa, "add", "${s}$c", "$Div($mul{\"inv*$c\"})");
+        $add{"add$c"} = simd_op($isa, "add", "${s}$c", "${d}$c");
+        $add{"mul$c"} = simd_op($isa, "add", $mul{"$c*$c"}, simd_op($isa, "mul", "${d}$c", "$Inv(${s}A)"));
+    }
+
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+            if (flags & SDL_COPY_MODULATE_COLOR) {
+                ${s}R = $Div($mul{"R*mod"});
+                ${s}G = $Div($mul{"G*mod"});
+                ${s}B = $Div($mul{"B*mod"});
+            }
+__EOF__
+        if (!$ignore_dst_alpha && !$is_modulateA_done) {
+            print FILE <<__EOF__;
+            if (flags & SDL_COPY_MODULATE_ALPHA) {
+                ${s}A = $Div($mul{"A*mod"});
+            }
+__EOF__
+        }
+    }
+    if ( $blend ) {
+        if (!$A_is_const_FF) {
+            print FILE <<__EOF__;
+            if (flags & (SDL_COPY_BLEND|SDL_COPY_ADD)) {
+                /* This goes away if we ever use premultiplied alpha, and is a no-op for opaque pixels */
+                ${s}R = $Div($mul{"R*A"});
+                ${s}G = $Div($mul{"G*A"});
+                ${s}B = $Div($mul{"B*A"});
+            }
+__EOF__
+        }
+        print FILE <<__EOF__;
+            switch (flags & (SDL_COPY_BLEND|SDL_COPY_ADD|SDL_COPY_MOD|SDL_COPY_MUL)) {
+            case SDL_COPY_BLEND:
+__EOF__
+        if ($A_is_const_FF) {
+            print FILE <<__EOF__;
+                ${d}R = ${s}R;
+                ${d}G = ${s}G;
+                ${d}B = ${s}B;
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+                ${d}R = $add{"blendR"};
+                ${d}G = $add{"blendG"};
+                ${d}B = $add{"blendB"};
+__EOF__
+        }
+        if ( $dst_has_alpha ) {
+            if ($A_is_const_FF) {
+                my $ff = simd_op($isa, "set1", "0xFF");
+                print FILE <<__EOF__;
+                ${d}A = $ff;
+__EOF__
+            } else {
+                print FILE <<__EOF__;
+                ${d}A = $add{"blendA"};
+__EOF__
+            }
+        }
+
+        print FILE <<__EOF__;
+                break;
+            case SDL_COPY_ADD:
+                ${d}R = $Clamp($add{"addR"});
+                ${d}G = $Clamp($add{"addG"});
+                ${d}B = $Clamp($add{"addB"});
+                break;
+            case SDL_COPY_MOD:
+                ${d}R = $Div($mul{"R*R"});
+                ${d}G = $Div($mul{"G*G"});
+                ${d}B = $Div($mul{"B*B"});
+                break;
+            case SDL_COPY_MUL:
+__EOF__
+        if ($A_is_const_FF) {
+            print FILE <<__EOF__;
+                ${d}R = $Div($mul{"R*R"});
+                ${d}G = $Div($mul{"G*G"});
+                ${d}B = $Div($mul{"B*B"});
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+                ${d}R = $Clamp($Div($add{"mulR"}));
+                ${d}G = $Clamp($Div($add{"mulG"}));
+                ${d}B = $Clamp($Div($add{"mulB"}));
+__EOF__
+        }
+
+        print FILE <<__EOF__;
+                break;
+            }
+__EOF__
+    }
+    if ( $blend ) {
+        simd_set_rgba($isa, "dst", $dst);
+    } else {
+        simd_set_rgba($isa, "", $dst);
+    }
+}
+
+sub output_simdfunc
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $type = $simd{$isa}{type};
+    my $width = $simd{$isa}{width};
+
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $ignore_dst_alpha = !$dst_has_alpha && !$blend;
+
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+
+    my $is_modulateA_done = 0;
+    my $A_is_const_FF = 0;
+
+    my $copy = (!$modulate && !$blend && $src eq $dst) ? 1 : 0;
+    my $swizzle = (!$modulate && !$blend && !$copy && defined $simd{$isa}{shuffle}) ? 1 : 0;
+    my $srcpixel = $blend ? "srcpixel" : "pixel";
+    my $dstpixel = $blend ? "dstpixel" : "pixel";
+
+    output_copyfuncname("static void$simd{$isa}{target}", $src, $dst, $modulate, $blend, $scale, 1, "\n", $isa);
+    print FILE <<__EOF__;
+{
+__EOF__
+    if ( $modulate || $blend ) {
+        print FILE <<__EOF__;
+    const int flags = info->flags;
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE "    const $type modulateR = " . simd_op($isa, "set1", "info->r") . ";\n";
+        print FILE "    const $type modulateG = " . simd_op($isa, "set1", "info->g") . ";\n";
+        print FILE "    const $type modulateB = " . simd_op($isa, "set1", "info->b") . ";\n";
+        if (!$ignore_dst_alpha && $src_has_alpha) {
+            print FILE "    const $type modulateA = " . simd_op($isa, "set1", "info->a") . ";\n";
+        }
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    $type srcpixel;
+__EOF__
+        if (!$ignore_dst_alpha && !$src_has_alpha) {
+            if ($modulate){
+                $is_modulateA_done = 1;
+                print FILE "    const $type srcA = " . simd_op($isa, "set1", "(flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF") . ";\n";
+            } else {
+                $A_is_const_FF = 1;
+            }
+            print FILE <<__EOF__;
+    $type srcR, srcG, srcB;
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+    $type srcR, srcG, srcB, srcA;
+__EOF__
+        }
+        print FILE <<__EOF__;
+    $type dstpixel;
+__EOF__
+        if ($dst_has_alpha) {
+            print FILE <<__EOF__;
+    $type dstR, dstG, dstB, dstA;
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+    $type dstR, dstG, dstB;
+__EOF__
+        }
+    } elsif ( $copy ) {
+        print FILE <<__EOF__;
+    $type pixel;
+__EOF__
+    } elsif ( $swizzle ) {
+        my $dst_shifts = $format_shifts{$dst};
+        my $src_shifts = $format_shifts{$src};
+        my @bytes = (-1, -1, -1, -1);
+        foreach my $channel (keys %$dst_shifts) {
+            if ( exists $src_shifts->{$channel} ) {
+                $bytes[$dst_shifts->{$channel} / 8] = $src_shifts->{$channel} / 8;
+            }
+        }
+        print FILE "    const $type swizzle = " . simd_byte_mask($isa, @bytes) . ";\n";
+        if ( $dst_has_alpha && !$src_has_alpha ) {
+            my $alpha = sprintf("(int)0x%08X", 0xFF << $dst_shifts->{"A"});
+            print FILE "    const $type A = " . simd_op($isa, "set1", $alpha) . ";\n";
+        }
+        print FILE <<__EOF__;
+    $type pixel;
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    $type pixel;
+__EOF__
+        if ( !$ignore_dst_alpha && !$src_has_alpha ) {
+            if ( $modulate ) {
+                $is_modulateA_done = 1;
+                print FILE "    const $type A = " . simd_op($isa, "set1", "(flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 0xFF") . ";\n";
+            } else {
+                $A_is_const_FF = 1;
+                print FILE "    const $type A = " . simd_op($isa, "set1", "0xFF") . ";\n";
+            }
+            print FILE <<__EOF__;
+    $type R, G, B;
+__EOF__
+        } elsif ( !$ignore_dst_alpha ) {
+            print FILE <<__EOF__;
+    $type R, G, B, A;
+__EOF__
+        } else {
+            print FILE <<__EOF__;
+    $type R, G, B;
+__EOF__
+        }
+    }
+    if ( $scale ) {
+        print FILE <<__EOF__;
+    Uint64 srcy;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        int x;
+        posx = incx / 2;
+
+        srcy = posy >> 16;
+        src = info->src + (srcy * info->src_pitch);
+        for (x = 0; x < n; x += $width) {
+            $srcpixel = SDL_Blit_GatherPixels_$isa(src, &posx, incx, n - x);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            $dstpixel = SDL_Blit_LoadPixels_$isa(dst + x, n - x);
+__EOF__
+        }
+        output_simdcore($isa, $src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
+        print FILE <<__EOF__;
+            SDL_Blit_StorePixels_$isa(dst + x, $dstpixel, n - x);
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        $format_type{$src} *src = ($format_type{$src} *)info->src;
+        $format_type{$dst} *dst = ($format_type{$dst} *)info->dst;
+        int n = info->dst_w;
+        int x;
+        for (x = 0; x < n; x += $width) {
+            $srcpixel = SDL_Blit_LoadPixels_$isa(src + x, n - x);
+__EOF__
+        if ( $blend ) {
+            print FILE <<__EOF__;
+            $dstpixel = SDL_Blit_LoadPixels_$isa(dst + x, n - x);
+__EOF__
+        }
+        output_simdcore($isa, $src, $dst, $modulate, $blend, $is_modulateA_done, $A_is_const_FF);
+        print FILE <<__EOF__;
+            SDL_Blit_StorePixels_$isa(dst + x, $dstpixel, n - x);
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+__EOF__
+    }
+    print FILE <<__EOF__;
+}
+
+__EOF__
+}
+
+sub output_simdfunc_c
+{
+    my $isa = shift;
+    my $src = shift;
+    my $dst = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            for (my $scale = 0; $scale <= 1; ++$scale) {
+                if ( $modulate || $blend || $scale ) {
+                    output_simdfunc($isa, $src, $dst, $modulate, $blend, $scale);
+                }
+            }
+        }
+    }
+}
+
 sub output_copyfunc_h
 {
 }
@@ -601,7 +1245,6 @@ __EOF__
                 for (my $blend = 0; $blend <= 1; ++$blend) {
                     for (my $scale = 0; $scale <= 1; ++$scale) {
                         if ( $modulate || $blend || $scale ) {
-                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             my $flags = "";
                             my $flag = "";
                             if ( $modulate ) {
@@ -631,6 +1274,13 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
+                            foreach my $isa (@simd_isas) {
+                                print FILE "#ifdef $simd{$isa}{define}\n";
+                                print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ($flags), $simd{$isa}{cpu},";
+                                output_copyfuncname("", $src, $dst, $modulate, $blend, $scale, 0, " },\n", $isa);
+                                print FILE "#endif\n";
+                            }
+                            print FILE "    { SDL_PIXELFORMAT_$src, SDL_PIXELFORMAT_$dst, ";
                             print FILE "($flags), SDL_CPU_ANY,";
                             output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
                         }
@@ -679,5 +1329,15 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+foreach my $isa (@simd_sections) {
+    print FILE "#ifdef $simd{$isa}{define}\n\n";
+    output_simdhelpers($isa);
+    for (my $i = 0; $i <= $#src_formats; ++$i) {
+        for (my $j = 0; $j <= $#dst_formats; ++$j) {
+            output_simdfunc_c($isa, $src_formats[$i], $dst_formats[$j]);
+        }
+    }
+    print FILE "#endif /* $simd{$isa}{define} */\n\n";
+}
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
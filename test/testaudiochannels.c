@@ -0,0 +1,221 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Check each of the SIMD channel converters that this CPU supports against
+   the scalar ones, both in-place and out-of-place, and report their throughput
+   for every pair of channel layouts.
+*/
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "../src/audio/SDL_sysaudio.h"
+#include "../src/audio/SDL_audio_channel_converters.h"
+
+#define MAX_ERROR 1e-6f
+
+typedef struct
+{
+    const char *name;
+    const SDL_AudioChannelConverter (*converters)[8];
+    SDL_bool supported;
+} Kernel;
+
+static int num_frames = 48000;
+static int iterations = 20;
+
+static int TestConverter(const Kernel *kernel, int src_channels, int dst_channels)
+{
+    const SDL_AudioChannelConverter scalar = channel_converters[src_channels - 1][dst_channels - 1];
+    const SDL_AudioChannelConverter converter = kernel->converters[src_channels - 1][dst_channels - 1];
+    const int buffer_channels = SDL_max(src_channels, dst_channels);
+    float *input = (float *)SDL_malloc(num_frames * src_channels * sizeof(float));
+    float *expected = (float *)SDL_malloc(num_frames * dst_channels * sizeof(float));
+    float *actual = (float *)SDL_malloc((num_frames * dst_channels + 1) * sizeof(float));
+    float *inplace = (float *)SDL_malloc(num_frames * buffer_channels * sizeof(float));
+    float max_error = 0.0f;
+    SDL_bool overrun;
+    Uint64 start, elapsed;
+    int i;
+
+    if (!input || !expected || !actual || !inplace) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_free(input);
+        SDL_free(expected);
+        SDL_free(actual);
+        SDL_free(inplace);
+        return -1;
+    }
+
+    for (i = 0; i < num_frames * src_channels; ++i) {
+        input[i] = SDL_randf() * 2.0f - 1.0f;
+    }
+
+    scalar(expected, input, num_frames);
+
+    /* Out-of-place, making sure nothing is written past the last frame */
+    actual[num_frames * dst_channels] = 42.0f;
+    converter(actual, input, num_frames);
+    overrun = (actual[num_frames * dst_channels] != 42.0f);
+    for (i = 0; i < num_frames * dst_channels; ++i) {
+        max_error = SDL_max(max_error, SDL_fabsf(actual[i] - expected[i]));
+    }
+
+    /* In-place, like SDL_AudioStream does it */
+    SDL_memcpy(inplace, input, num_frames * src_channels * sizeof(float));
+    converter(inplace, inplace, num_frames);
+    for (i = 0; i < num_frames * dst_channels; ++i) {
+        max_error = SDL_max(max_error, SDL_fabsf(inplace[i] - expected[i]));
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        converter(actual, input, num_frames);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Log("%-8s %d -> %d channels: %8.2f Mframes/sec, max error %g",
+            kernel->name, src_channels, dst_channels,
+            (double)num_frames * iterations * SDL_GetPerformanceFrequency() / (double)elapsed / 1e6,
+            (double)max_error);
+
+    SDL_free(input);
+    SDL_free(expected);
+    SDL_free(actual);
+    SDL_free(inplace);
+
+    if (max_error > MAX_ERROR || overrun) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s converter from %d to %d channels doesn't match the scalar one\n", kernel->name, src_channels, dst_channels);
+        return -1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    Kernel kernels[4];
+    SDLTest_CommonState *state;
+    int num_kernels = 0;
+    int errors = 0;
+    int i, j, k;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--frames") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    num_frames = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && num_frames > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    iterations = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && iterations > 0) {
+                        consumed = 2;
+                    }
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--frames NB]",
+                "[--iterations NB]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    kernels[num_kernels].name = "scalar";
+    kernels[num_kernels].converters = channel_converters;
+    kernels[num_kernels].supported = SDL_TRUE;
+    ++num_kernels;
+#ifdef SDL_SSE_INTRINSICS
+    kernels[num_kernels].name = "SSE";
+    kernels[num_kernels].converters = channel_converters_SSE;
+    kernels[num_kernels].supported = SDL_HasSSE();
+    ++num_kernels;
+#ifdef SDL_AVX2_INTRINSICS
+    kernels[num_kernels].name = "AVX2";
+    kernels[num_kernels].converters = channel_converters_AVX2;
+    kernels[num_kernels].supported = SDL_HasSSE() && SDL_HasAVX2();
+    ++num_kernels;
+#endif
+#endif
+#ifdef SDL_NEON_CHANNEL_CONVERTERS
+    kernels[num_kernels].name = "NEON";
+    kernels[num_kernels].converters = channel_converters_NEON;
+    kernels[num_kernels].supported = SDL_HasNEON();
+    ++num_kernels;
+#endif
+
+    for (i = 0; i < num_kernels; ++i) {
+        if (!kernels[i].supported) {
+            SDL_Log("%-8s not supported by this CPU, skipped", kernels[i].name);
+            continue;
+        }
+        for (j = 1; j <= 8; ++j) {
+            for (k = 1; k <= 8; ++k) {
+                /* SIMD tables leave out the pairs they don't accelerate */
+                if (j != k && kernels[i].converters[j - 1][k - 1]) {
+                    if (TestConverter(&kernels[i], j, k) < 0) {
+                        ++errors;
+                    }
+                }
+            }
+        }
+    }
+
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
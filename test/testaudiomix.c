@@ -0,0 +1,357 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Bind many resampling streams, each with its own gain, to one playback
+   device and report how long each device iteration spends pulling and mixing
+   them, first on the device thread alone and then with
+   SDL_HINT_AUDIO_MIXING_THREADS worker threads. The mixed output of both runs
+   is compared, since it should not change. Use --rate 48000 to skip the
+   resampling, so streams are mixed straight out of their queues.
+   Before that, report how long SDL_MixAudio takes to mix the same number of
+   48 kHz stereo buffers together.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#define NUM_COMPARED_PERIODS 16
+
+typedef struct
+{
+    float phase;
+    float step;
+    float *buffer;
+    int buffer_size;
+} StreamData;
+
+typedef struct
+{
+    SDL_SpinLock lock;
+    Uint64 period_start;
+    Uint64 total_ticks;
+    Uint64 max_ticks;
+    int periods;
+    Uint32 checksums[NUM_COMPARED_PERIODS];
+} MixStats;
+
+static int nb_streams = 64;
+static int nb_threads = 3;
+static int seconds = 2;
+static int src_rate = 44100;
+static MixStats stats;
+
+static void SDLCALL
+FeedStream(void *userdata, SDL_AudioStream *stream, int additional_amount, int total_amount)
+{
+    StreamData *data = (StreamData *)userdata;
+    const int frames = additional_amount / (int)(sizeof(float) * 2);
+    int i;
+
+    SDL_LockSpinlock(&stats.lock);
+    if (!stats.period_start) {
+        stats.period_start = SDL_GetPerformanceCounter();
+    }
+    SDL_UnlockSpinlock(&stats.lock);
+
+    if (frames <= 0) {
+        return;
+    }
+
+    /* Generate the tone once and keep feeding the same buffer, so the timings are mostly about mixing */
+    if (additional_amount > data->buffer_size) {
+        float *buffer = (float *)SDL_realloc(data->buffer, additional_amount);
+        if (!buffer) {
+            return;
+        }
+        data->buffer = buffer;
+        data->buffer_size = additional_amount;
+
+        for (i = 0; i < frames; ++i) {
+            const float sample = SDL_sinf(data->phase) * 0.01f;
+            data->buffer[i * 2 + 0] = sample;
+            data->buffer[i * 2 + 1] = sample;
+            data->phase += data->step;
+            if (data->phase >= 2.0f * SDL_PI_F) {
+                data->phase -= 2.0f * SDL_PI_F;
+            }
+        }
+    }
+    SDL_PutAudioStreamData(stream, data->buffer, frames * (int)(sizeof(float) * 2));
+}
+
+static void SDLCALL
+MeasurePostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    const Uint64 now = SDL_GetPerformanceCounter();
+    Uint64 ticks;
+
+    SDL_LockSpinlock(&stats.lock);
+    ticks = stats.period_start ? (now - stats.period_start) : 0;
+    stats.period_start = 0;
+    SDL_UnlockSpinlock(&stats.lock);
+
+    if (stats.periods < NUM_COMPARED_PERIODS) {
+        const Uint8 *bytes = (const Uint8 *)buffer;
+        Uint32 hash = 2166136261u;
+        int i;
+
+        for (i = 0; i < buflen; ++i) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+        stats.checksums[stats.periods] = hash;
+    }
+
+    stats.total_ticks += ticks;
+    stats.max_ticks = SDL_max(stats.max_ticks, ticks);
+    stats.periods++;
+}
+
+static void
+BenchmarkMixAudio(SDL_AudioFormat format, const char *name, float volume)
+{
+    const int period_frames = 480; /* 10 ms at 48 kHz */
+    const int len = period_frames * 2 * SDL_AUDIO_BYTESIZE(format);
+    const int periods = 100;
+    Uint8 *buffers = (Uint8 *)SDL_malloc((size_t)(nb_streams + 1) * len);
+    Uint8 *dst = buffers;
+    Uint64 start, elapsed;
+    int i, j;
+
+    if (!buffers) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return;
+    }
+    for (i = 0; i < (nb_streams + 1) * len / SDL_AUDIO_BYTESIZE(format); ++i) {
+        const float sample = (SDL_randf() - 0.5f) * 0.01f;
+        if (format == SDL_AUDIO_F32) {
+            ((float *)buffers)[i] = sample;
+        } else if (format == SDL_AUDIO_S16) {
+            ((Sint16 *)buffers)[i] = (Sint16)(sample * SDL_MAX_SINT16);
+        } else {
+            ((Sint32 *)buffers)[i] = (Sint32)(sample * (float)SDL_MAX_SINT32);
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < periods; ++i) {
+        SDL_memset(dst, 0, len);
+        for (j = 1; j <= nb_streams; ++j) {
+            SDL_MixAudio(dst, buffers + (size_t)j * len, format, len, volume);
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Log("SDL_MixAudio, %s at volume %.2f: %.1f us to mix %d streams of 10 ms of 48 kHz stereo",
+            name, volume,
+            (double)elapsed * 1e6 / SDL_GetPerformanceFrequency() / periods, nb_streams);
+
+    SDL_free(buffers);
+}
+
+static int
+RunMix(int threads, Uint32 *checksums)
+{
+    const SDL_AudioSpec srcspec = { SDL_AUDIO_F32, 2, src_rate };
+    const SDL_AudioSpec dstspec = { SDL_AUDIO_F32, 2, 48000 };
+    const double frequency = (double)SDL_GetPerformanceFrequency();
+    SDL_AudioStream **streams;
+    StreamData *data;
+    SDL_AudioSpec spec;
+    SDL_AudioDeviceID devid;
+    char value[16];
+    int sample_frames = 0;
+    int result = -1;
+    int i;
+
+    (void)SDL_snprintf(value, sizeof(value), "%d", threads);
+    SDL_SetHint(SDL_HINT_AUDIO_MIXING_THREADS, value);
+
+    devid = SDL_OpenAudioDevice(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &dstspec);
+    if (!devid) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open audio device: %s\n", SDL_GetError());
+        return -1;
+    }
+    SDL_PauseAudioDevice(devid);
+    SDL_GetAudioDeviceFormat(devid, &spec, &sample_frames);
+
+    streams = (SDL_AudioStream **)SDL_calloc(nb_streams, sizeof(*streams));
+    data = (StreamData *)SDL_calloc(nb_streams, sizeof(*data));
+    if (!streams || !data) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        goto done;
+    }
+
+    for (i = 0; i < nb_streams; ++i) {
+        streams[i] = SDL_CreateAudioStream(&srcspec, NULL);
+        if (!streams[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create audio stream: %s\n", SDL_GetError());
+            goto done;
+        }
+        data[i].step = 2.0f * SDL_PI_F * (220.0f + i * 10.0f) / srcspec.freq;
+        SDL_SetAudioStreamGetCallback(streams[i], FeedStream, &data[i]);
+        SDL_SetAudioStreamGain(streams[i], 0.25f + (i % 4) * 0.25f);
+    }
+
+    SDL_zero(stats);
+    SDL_SetAudioPostmixCallback(devid, MeasurePostmix, NULL);
+    if (SDL_BindAudioStreams(devid, streams, nb_streams) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't bind audio streams: %s\n", SDL_GetError());
+        goto done;
+    }
+    SDL_ResumeAudioDevice(devid);
+    SDL_Delay(seconds * 1000);
+    SDL_PauseAudioDevice(devid);  /* the postmix callback won't run again after this */
+    SDL_UnbindAudioStreams(streams, nb_streams);
+
+    if (stats.periods > 0) {
+        const double average = (double)stats.total_ticks / frequency / stats.periods;
+        SDL_Log("%d worker threads: %d periods of %d frames (%.2f ms), mixing took %.3f ms on average, %.3f ms at most",
+                threads, stats.periods, sample_frames, sample_frames * 1000.0 / spec.freq,
+                average * 1000.0, (double)stats.max_ticks * 1000.0 / frequency);
+        SDL_Log("%d worker threads: mixed %.2f GB/s of stream output",
+                threads, (double)nb_streams * sample_frames * SDL_AUDIO_FRAMESIZE(dstspec) / average / 1e9);
+        SDL_memcpy(checksums, stats.checksums, sizeof(stats.checksums));
+        result = SDL_min(stats.periods, NUM_COMPARED_PERIODS);
+    } else {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "The audio device never ran\n");
+    }
+
+done:
+    SDL_CloseAudioDevice(devid);
+    if (streams) {
+        for (i = 0; i < nb_streams; ++i) {
+            SDL_DestroyAudioStream(streams[i]);
+        }
+    }
+    if (data) {
+        for (i = 0; i < nb_streams; ++i) {
+            SDL_free(data[i].buffer);
+        }
+    }
+    SDL_free(data);
+    SDL_free(streams);
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    Uint32 serial_checksums[NUM_COMPARED_PERIODS];
+    Uint32 threaded_checksums[NUM_COMPARED_PERIODS];
+    int serial_periods, threaded_periods;
+    int errors = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--streams") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    nb_streams = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && nb_streams > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--threads") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    nb_threads = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && nb_threads > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--rate") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    src_rate = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && src_rate > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--seconds") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    seconds = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && seconds > 0) {
+                        consumed = 2;
+                    }
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--streams NB]",
+                "[--threads NB]",
+                "[--rate NB]",
+                "[--seconds NB]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    /* The dummy driver runs anywhere; SDL_AUDIO_DRIVER=disk still works, since the environment wins */
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    BenchmarkMixAudio(SDL_AUDIO_F32, "F32", 1.0f);
+    BenchmarkMixAudio(SDL_AUDIO_F32, "F32", 0.5f);
+    BenchmarkMixAudio(SDL_AUDIO_S16, "S16", 1.0f);
+    BenchmarkMixAudio(SDL_AUDIO_S16, "S16", 0.5f);
+    BenchmarkMixAudio(SDL_AUDIO_S32, "S32", 1.0f);
+    BenchmarkMixAudio(SDL_AUDIO_S32, "S32", 0.5f);
+
+    SDL_Log("Mixing %d streams on the '%s' audio driver", nb_streams, SDL_GetCurrentAudioDriver());
+
+    serial_periods = RunMix(0, serial_checksums);
+    threaded_periods = RunMix(nb_threads, threaded_checksums);
+    if (serial_periods < 0 || threaded_periods < 0) {
+        ++errors;
+    } else {
+        const int compared = SDL_min(serial_periods, threaded_periods);
+        for (i = 0; i < compared; ++i) {
+            if (serial_checksums[i] != threaded_checksums[i]) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Period %d mixed differently with worker threads\n", i);
+                ++errors;
+            }
+        }
+        if (!errors) {
+            SDL_Log("The first %d periods mixed identically with and without worker threads", compared);
+        }
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,378 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Check each of the audio resampler's kernels that this CPU supports against
+   the scalar one, and report their throughput for 44.1->48 kHz and 48->96 kHz
+   with mono, stereo, 5.1 and 7.1 audio.
+
+   Then do the same for each resampling quality (with and without a filter
+   bank), reporting the cost and the signal-to-noise ratio of a resampled
+   10 kHz sine wave.
+*/
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "../src/audio/SDL_audioresample.c"
+
+#define MAX_ERROR 1e-5f
+
+/* How far the filter banks may stray from the interpolated filters they replace */
+#define MAX_BANK_ERROR 1e-3f
+
+#define SINE_FREQUENCY 10000.0
+
+typedef struct
+{
+    const char *name;
+    ResampleFramesFunc func;
+    SDL_bool supported;
+} Kernel;
+
+typedef struct
+{
+    int src_rate;
+    int dst_rate;
+} RatePair;
+
+typedef struct
+{
+    const char *name;
+    SDL_AudioResamplingQuality quality;
+    SDL_bool use_bank;
+} Tier;
+
+static Cubic ScalarFilter[RESAMPLER_SAMPLES_PER_ZERO_CROSSING][RESAMPLER_SAMPLES_PER_FRAME];
+static int inframes = 48000;
+static int iterations = 20;
+
+/* The scalar resampler, using a copy of the filter from before SetupAudioResampler transposed it */
+static void ResampleFrames_Scalar(const float *src, float *dst, int outframes, Sint64 srcpos, Sint64 resample_rate, int chans)
+{
+    int i;
+
+    for (i = 0; i < outframes; ++i, srcpos += resample_rate, dst += chans) {
+        const Uint32 srcfraction = (Uint32)(srcpos & 0xFFFFFFFF);
+        const float frac = (float)(srcfraction & (RESAMPLER_FILTER_INTERP_RANGE - 1)) * (1.0f / RESAMPLER_FILTER_INTERP_RANGE);
+        const Cubic *filter = ScalarFilter[srcfraction >> RESAMPLER_FILTER_INTERP_BITS];
+
+        ResampleFrame_Generic(&src[GetResamplerIndex(srcpos) * chans], dst, filter, frac, chans);
+    }
+}
+
+static int TestKernel(const Kernel *kernel, const RatePair *rates, int chans)
+{
+    const int padding = RESAMPLER_MAX_PADDING_FRAMES;
+    const Sint64 resample_rate = SDL_GetResampleRate(rates->src_rate, rates->dst_rate);
+    Sint64 offset = 0;
+    const int outframes = (int)SDL_GetResamplerOutputFrames(inframes, resample_rate, &offset);
+    float *input = (float *)SDL_malloc((inframes + padding * 2) * chans * sizeof(float));
+    float *expected = (float *)SDL_malloc(outframes * chans * sizeof(float));
+    float *actual = (float *)SDL_malloc(outframes * chans * sizeof(float));
+    const float *src;
+    float max_error = 0.0f;
+    Uint64 start, elapsed;
+    int i;
+
+    if (!input || !expected || !actual) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_free(input);
+        SDL_free(expected);
+        SDL_free(actual);
+        return -1;
+    }
+
+    for (i = 0; i < (inframes + padding * 2) * chans; ++i) {
+        input[i] = SDL_randf() * 2.0f - 1.0f;
+    }
+    src = &input[(padding - (RESAMPLER_ZERO_CROSSINGS - 1)) * chans];
+
+    ResampleFrames_Scalar(src, expected, outframes, 0, resample_rate, chans);
+    kernel->func(src, actual, outframes, 0, resample_rate, chans);
+
+    for (i = 0; i < outframes * chans; ++i) {
+        max_error = SDL_max(max_error, SDL_fabsf(actual[i] - expected[i]));
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        kernel->func(src, actual, outframes, 0, resample_rate, chans);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Log("%-8s %5d -> %5d Hz, %d channels: %7.2f Mframes/sec, max error %g",
+            kernel->name, rates->src_rate, rates->dst_rate, chans,
+            (double)outframes * iterations * SDL_GetPerformanceFrequency() / (double)elapsed / 1e6,
+            (double)max_error);
+
+    SDL_free(input);
+    SDL_free(expected);
+    SDL_free(actual);
+
+    if (max_error > MAX_ERROR) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s kernel doesn't match the scalar resampler for %d channels\n", kernel->name, chans);
+        return -1;
+    }
+    return 0;
+}
+
+static void ResampleTier(const Tier *tier, const SDL_ResamplerFilterBank *bank, const float *src, float *dst, int outframes, Sint64 resample_rate, int chans)
+{
+    Sint64 offset = 0;
+    SDL_ResampleAudio(chans, src, inframes, dst, outframes, resample_rate, &offset, tier->quality, tier->use_bank ? bank : NULL);
+}
+
+static float MaxError(const float *a, const float *b, int count)
+{
+    float max_error = 0.0f;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        max_error = SDL_max(max_error, SDL_fabsf(a[i] - b[i]));
+    }
+    return max_error;
+}
+
+static int TestTier(const Tier *tier, const RatePair *rates, int chans)
+{
+    const int padding = SDL_GetResamplerHistoryFrames();
+    const Sint64 resample_rate = SDL_GetResampleRate(rates->src_rate, rates->dst_rate);
+    Sint64 offset = 0;
+    const int outframes = (int)SDL_GetResamplerOutputFrames(inframes, resample_rate, &offset);
+    SDL_ResamplerFilterBank *bank = tier->use_bank ? SDL_CreateResamplerFilterBank(tier->quality, rates->src_rate, rates->dst_rate) : NULL;
+    float *input = (float *)SDL_malloc((inframes + padding * 2) * chans * sizeof(float));
+    float *expected = (float *)SDL_malloc(outframes * chans * sizeof(float));
+    float *actual = (float *)SDL_malloc(outframes * chans * sizeof(float));
+    const float *src;
+    double signal = 0.0, noise = 0.0;
+    float max_error = 0.0f;
+    Uint64 start, elapsed;
+    int retval = 0;
+    int i, c;
+
+    if (!input || !expected || !actual || (tier->use_bank && !bank)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the %s resampler: %s\n", tier->name, SDL_GetError());
+        retval = -1;
+        goto done;
+    }
+
+    /* A sine wave, continuing into the padding, so the ends resample as cleanly as the middle */
+    for (i = 0; i < inframes + padding * 2; ++i) {
+        for (c = 0; c < chans; ++c) {
+            input[i * chans + c] = (float)(0.5 * SDL_sin(2.0 * SDL_PI_D * SINE_FREQUENCY * (i - padding) / rates->src_rate + c));
+        }
+    }
+    src = &input[padding * chans];
+
+    ResampleTier(tier, bank, src, actual, outframes, resample_rate, chans);
+
+    for (i = 0; i < outframes; ++i) {
+        const double pos = (double)(i * resample_rate) / 4294967296.0;
+        for (c = 0; c < chans; ++c) {
+            const double ideal = 0.5 * SDL_sin(2.0 * SDL_PI_D * SINE_FREQUENCY * pos / rates->src_rate + c);
+            const double error = actual[i * chans + c] - ideal;
+            signal += ideal * ideal;
+            noise += error * error;
+        }
+    }
+
+    if (bank) {
+        /* The SIMD kernels should match the generic one... */
+        const ResampleFramesBankFunc func = ResampleFrames_Bank;
+        const Tier interpolated = { tier->name, tier->quality, SDL_FALSE };
+        ResampleFrames_Bank = ResampleFrames_Bank_Generic;
+        ResampleTier(tier, bank, src, expected, outframes, resample_rate, chans);
+        ResampleFrames_Bank = func;
+
+        max_error = MaxError(actual, expected, outframes * chans);
+        if (max_error > MAX_ERROR) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s doesn't match the generic kernel for %d channels (max error %g)\n", tier->name, chans, (double)max_error);
+            retval = -1;
+        }
+
+        /* ...and the bank should be a close approximation of the interpolated filter */
+        ResampleTier(&interpolated, NULL, src, expected, outframes, resample_rate, chans);
+        max_error = MaxError(actual, expected, outframes * chans);
+        if (max_error > MAX_BANK_ERROR) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s strays too far from the interpolated filter for %d channels (max error %g)\n", tier->name, chans, (double)max_error);
+            retval = -1;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        ResampleTier(tier, bank, src, actual, outframes, resample_rate, chans);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Log("%-12s %5d -> %5d Hz, %d channels: %7.2f Mframes/sec, %5.1f dB SNR",
+            tier->name, rates->src_rate, rates->dst_rate, chans,
+            (double)outframes * iterations * SDL_GetPerformanceFrequency() / (double)elapsed / 1e6,
+            10.0 * SDL_log10(signal / noise));
+
+done:
+    SDL_DestroyResamplerFilterBank(bank);
+    SDL_free(input);
+    SDL_free(expected);
+    SDL_free(actual);
+    return retval;
+}
+
+int main(int argc, char *argv[])
+{
+    static const RatePair rates[] = { { 44100, 48000 }, { 48000, 96000 } };
+    static const int channels[] = { 1, 2, 3, 4, 6, 8 };
+    static const Tier tiers[] = {
+        { "low", SDL_AUDIO_RESAMPLING_LOW, SDL_FALSE },
+        { "medium", SDL_AUDIO_RESAMPLING_MEDIUM, SDL_FALSE },
+        { "medium/bank", SDL_AUDIO_RESAMPLING_MEDIUM, SDL_TRUE },
+        { "high", SDL_AUDIO_RESAMPLING_HIGH, SDL_FALSE },
+        { "high/bank", SDL_AUDIO_RESAMPLING_HIGH, SDL_TRUE },
+    };
+    Kernel kernels[4];
+    SDLTest_CommonState *state;
+    int num_kernels = 0;
+    int errors = 0;
+    int i, j, k;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--frames") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    inframes = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && inframes > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    iterations = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && iterations > 0) {
+                        consumed = 2;
+                    }
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--frames NB]",
+                "[--iterations NB]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    /* Keep the filter as the scalar resampler sees it, then let the SIMD kernels transpose it */
+    GenerateResamplerFilter();
+    SDL_memcpy(ScalarFilter, ResamplerFilter, sizeof(ScalarFilter));
+    SDL_SetupAudioResampler();
+
+    kernels[num_kernels].name = "scalar";
+    kernels[num_kernels].func = ResampleFrames_Scalar;
+    kernels[num_kernels].supported = SDL_TRUE;
+    ++num_kernels;
+#ifdef SDL_SSE_INTRINSICS
+    kernels[num_kernels].name = "SSE";
+    kernels[num_kernels].func = ResampleFrames_Generic_SSE;
+    kernels[num_kernels].supported = SDL_HasSSE();
+    ++num_kernels;
+#ifdef SDL_AVX2_INTRINSICS
+    kernels[num_kernels].name = "AVX2";
+    kernels[num_kernels].func = ResampleFrames_AVX2;
+    kernels[num_kernels].supported = SDL_HasSSE() && SDL_HasAVX2();
+    ++num_kernels;
+#ifdef SDL_AVX512F_INTRINSICS
+    kernels[num_kernels].name = "AVX512F";
+    kernels[num_kernels].func = ResampleFrames_AVX512F;
+    kernels[num_kernels].supported = SDL_HasSSE() && SDL_HasAVX2() && SDL_HasAVX512F();
+    ++num_kernels;
+#endif
+#endif
+#endif
+#ifdef SDL_NEON_INTRINSICS
+    kernels[num_kernels].name = "NEON";
+    kernels[num_kernels].func = ResampleFrames_Generic_NEON;
+    kernels[num_kernels].supported = SDL_HasNEON();
+    ++num_kernels;
+#endif
+
+    for (i = 0; i < num_kernels; ++i) {
+        if (!kernels[i].supported) {
+            SDL_Log("%-8s not supported by this CPU, skipped", kernels[i].name);
+            continue;
+        }
+        for (j = 0; j < SDL_arraysize(rates); ++j) {
+            for (k = 0; k < SDL_arraysize(channels); ++k) {
+                if (TestKernel(&kernels[i], &rates[j], channels[k]) < 0) {
+                    ++errors;
+                }
+            }
+        }
+    }
+
+    /* Check the medium quality banks, even if this CPU has faster kernels to use instead */
+    UseMediumResamplerBanks = SDL_TRUE;
+
+    for (i = 0; i < SDL_arraysize(tiers); ++i) {
+        for (j = 0; j < SDL_arraysize(rates); ++j) {
+            for (k = 0; k < SDL_arraysize(channels); ++k) {
+                if (TestTier(&tiers[i], &rates[j], channels[k]) < 0) {
+                    ++errors;
+                }
+            }
+        }
+    }
+
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
@@ -1365,6 +1365,923 @@ cleanup:
 
     return status;
 }
+/**
+ * Check that SDL_MixAudio gives the expected results, with and without volume, for every buffer length up to a few SIMD registers.
+ *
+ * \sa SDL_MixAudio
+ */
+static int audio_mixAudio(void *arg)
+{
+    const float volumes[] = { 1.0f, 0.75f, 0.5f, 0.1f };
+    const int max_samples = 67;
+    Sint16 src16[67], dst16[67], expected16[67];
+    Sint32 src32[67], dst32[67], expected32[67];
+    float srcf[67], dstf[67], expectedf[67];
+    int v, num_samples, i;
+
+    for (v = 0; v < SDL_arraysize(volumes); ++v) {
+        const float fvolume = volumes[v];
+        const int volume = (int)SDL_roundf(fvolume * 128);
+
+        for (num_samples = 0; num_samples <= max_samples; ++num_samples) {
+            int errors16 = 0, errors32 = 0, errorsf = 0;
+
+            for (i = 0; i < num_samples; ++i) {
+                Sint64 sample;
+
+                src16[i] = SDLTest_RandomSint16();
+                dst16[i] = SDLTest_RandomSint16();
+                sample = (((Sint64)src16[i] * volume) / 128) + dst16[i];
+                expected16[i] = (Sint16)SDL_clamp(sample, SDL_MIN_SINT16, SDL_MAX_SINT16);
+
+                src32[i] = SDLTest_RandomSint32();
+                dst32[i] = SDLTest_RandomSint32();
+                sample = (((Sint64)src32[i] * volume) / 128) + dst32[i];
+                expected32[i] = (Sint32)SDL_clamp(sample, SDL_MIN_SINT32, SDL_MAX_SINT32);
+
+                srcf[i] = SDLTest_RandomUnitFloat() * 3.0f - 1.5f;
+                dstf[i] = SDLTest_RandomUnitFloat() * 3.0f - 1.5f;
+                expectedf[i] = SDL_clamp((srcf[i] * fvolume) + dstf[i], -1.0f, 1.0f);
+            }
+
+            SDLTest_AssertCheck(SDL_MixAudio((Uint8 *)dst16, (const Uint8 *)src16, SDL_AUDIO_S16, num_samples * sizeof(Sint16), fvolume) == 0, "SDL_MixAudio(SDL_AUDIO_S16) should succeed");
+            SDLTest_AssertCheck(SDL_MixAudio((Uint8 *)dst32, (const Uint8 *)src32, SDL_AUDIO_S32, num_samples * sizeof(Sint32), fvolume) == 0, "SDL_MixAudio(SDL_AUDIO_S32) should succeed");
+            SDLTest_AssertCheck(SDL_MixAudio((Uint8 *)dstf, (const Uint8 *)srcf, SDL_AUDIO_F32, num_samples * sizeof(float), fvolume) == 0, "SDL_MixAudio(SDL_AUDIO_F32) should succeed");
+
+            for (i = 0; i < num_samples; ++i) {
+                errors16 += (dst16[i] != expected16[i]);
+                errors32 += (dst32[i] != expected32[i]);
+                errorsf += (dstf[i] != expectedf[i]);
+            }
+
+            if (errors16 || errors32 || errorsf) {
+                SDLTest_AssertCheck(SDL_FALSE, "Mixing %d samples at volume %f: %d S16, %d S32 and %d F32 samples differ from the expected result",
+                                    num_samples, fvolume, errors16, errors32, errorsf);
+                return TEST_ABORTED;
+            }
+        }
+    }
+
+    SDLTest_AssertPass("All mixed samples matched the expected result");
+    return TEST_COMPLETED;
+}
+
+/**
+ * Check that an audio stream's gain can be set and queried, and scales the stream's output.
+ *
+ * \sa SDL_SetAudioStreamGain
+ * \sa SDL_GetAudioStreamGain
+ */
+static int audio_streamGain(void *arg)
+{
+    const SDL_AudioSpec srcspec = { SDL_AUDIO_F32, 2, 48000 };
+    const int dst_rates[] = { 48000, 44100 };
+    const int num_frames = 4800;
+    float *input, *expected, *actual;
+    SDL_AudioStream *stream;
+    int r, i, len;
+
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(NULL) == -1.0f, "SDL_GetAudioStreamGain(NULL) should fail");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(NULL, 1.0f) == -1, "SDL_SetAudioStreamGain(NULL) should fail");
+
+    stream = SDL_CreateAudioStream(&srcspec, &srcspec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 1.0f, "New streams should have a gain of 1.0");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, -0.5f) == -1, "SDL_SetAudioStreamGain(-0.5) should fail");
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 1.0f, "A failed SDL_SetAudioStreamGain shouldn't change the gain");
+    SDLTest_AssertCheck(SDL_SetAudioStreamGain(stream, 0.5f) == 0, "SDL_SetAudioStreamGain(0.5) should succeed");
+    SDLTest_AssertCheck(SDL_GetAudioStreamGain(stream) == 0.5f, "SDL_GetAudioStreamGain should return 0.5");
+    SDL_DestroyAudioStream(stream);
+
+    len = num_frames * SDL_AUDIO_FRAMESIZE(srcspec);
+    input = (float *)SDL_malloc(len);
+    expected = (float *)SDL_malloc(len);
+    actual = (float *)SDL_malloc(len);
+    if (!SDLTest_AssertCheck(input && expected && actual, "Expected buffers to be allocated")) {
+        SDL_free(input);
+        SDL_free(expected);
+        SDL_free(actual);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < num_frames * srcspec.channels; ++i) {
+        input[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+    }
+
+    for (r = 0; r < SDL_arraysize(dst_rates); ++r) {
+        SDL_AudioSpec dstspec = srcspec;
+        int expected_len, actual_len, errors = 0;
+
+        dstspec.freq = dst_rates[r];
+
+        /* Halving is exact in float, so the output with a gain of 0.5 should be exactly half of the output without it */
+        stream = SDL_CreateAudioStream(&srcspec, &dstspec);
+        SDL_PutAudioStreamData(stream, input, len);
+        SDL_FlushAudioStream(stream);
+        expected_len = SDL_GetAudioStreamData(stream, expected, len);
+        SDL_DestroyAudioStream(stream);
+
+        stream = SDL_CreateAudioStream(&srcspec, &dstspec);
+        SDL_SetAudioStreamGain(stream, 0.5f);
+        SDL_PutAudioStreamData(stream, input, len);
+        SDL_FlushAudioStream(stream);
+        actual_len = SDL_GetAudioStreamData(stream, actual, len);
+        SDL_DestroyAudioStream(stream);
+
+        SDLTest_AssertCheck(expected_len > 0 && actual_len == expected_len, "Expected the same amount of output with and without gain at %d Hz, got %d and %d bytes", dstspec.freq, expected_len, actual_len);
+        for (i = 0; i < (int)(SDL_min(expected_len, actual_len) / sizeof(float)); ++i) {
+            errors += (actual[i] != expected[i] * 0.5f);
+        }
+        SDLTest_AssertCheck(errors == 0, "Expected the output at %d Hz to be scaled by the gain, %d samples differ", dstspec.freq, errors);
+    }
+
+    SDL_free(input);
+    SDL_free(expected);
+    SDL_free(actual);
+
+    return TEST_COMPLETED;
+}
+
+typedef struct
+{
+    const void *buf;
+    int buflen;
+    int calls;
+} ReleasedBuffer;
+
+static void SDLCALL audio_releaseAudioBuffer(void *userdata, const void *buf, int buflen)
+{
+    ReleasedBuffer *released = (ReleasedBuffer *)userdata;
+
+    released->buf = buf;
+    released->buflen = buflen;
+    released->calls++;
+}
+
+/**
+ * Check that SDL_PutAudioStreamBuffer reads from the caller's buffer, and releases it once it has been consumed or the stream is cleared.
+ *
+ * \sa SDL_PutAudioStreamBuffer
+ */
+static int audio_putAudioStreamBuffer(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+    const SDL_AudioSpec resampled_spec = { SDL_AUDIO_F32, 2, 44100 };
+    const int num_frames = 4096;
+    const int len = num_frames * SDL_AUDIO_FRAMESIZE(spec);
+    ReleasedBuffer released1, released2;
+    float *buffer1, *buffer2, *output;
+    SDL_AudioStream *stream;
+    int i, ret, errors = 0;
+
+    buffer1 = (float *)SDL_malloc(len);
+    buffer2 = (float *)SDL_malloc(len);
+    output = (float *)SDL_malloc(len * 2);
+    if (!SDLTest_AssertCheck(buffer1 && buffer2 && output, "Expected buffers to be allocated")) {
+        SDL_free(buffer1);
+        SDL_free(buffer2);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < num_frames * spec.channels; ++i) {
+        buffer1[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+        buffer2[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+    }
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+
+    SDL_zero(released1);
+    SDLTest_AssertCheck(SDL_PutAudioStreamBuffer(NULL, buffer1, len, audio_releaseAudioBuffer, &released1) == -1, "SDL_PutAudioStreamBuffer(NULL stream) should fail");
+    SDLTest_AssertCheck(SDL_PutAudioStreamBuffer(stream, NULL, len, audio_releaseAudioBuffer, &released1) == -1, "SDL_PutAudioStreamBuffer(NULL buf) should fail");
+    SDLTest_AssertCheck(SDL_PutAudioStreamBuffer(stream, buffer1, len - 1, audio_releaseAudioBuffer, &released1) == -1, "SDL_PutAudioStreamBuffer with a partial sample frame should fail");
+    SDLTest_AssertCheck(released1.calls == 0, "A failed SDL_PutAudioStreamBuffer shouldn't release the buffer");
+
+    /* Read the buffer back in two parts; it should only be released after the second */
+    ret = SDL_PutAudioStreamBuffer(stream, buffer1, len, audio_releaseAudioBuffer, &released1);
+    SDLTest_AssertCheck(ret == 0, "SDL_PutAudioStreamBuffer should succeed, returned %d", ret);
+    ret = SDL_GetAudioStreamData(stream, output, len / 2);
+    SDLTest_AssertCheck(ret == len / 2, "Expected %d bytes from SDL_GetAudioStreamData, got %d", len / 2, ret);
+    SDLTest_AssertCheck(released1.calls == 0, "The buffer shouldn't be released while data remains in it");
+    ret = SDL_GetAudioStreamData(stream, output + (len / 2) / sizeof(float), len / 2);
+    SDLTest_AssertCheck(ret == len / 2, "Expected %d bytes from SDL_GetAudioStreamData, got %d", len / 2, ret);
+    SDLTest_AssertCheck(released1.calls == 1, "The buffer should be released once, as soon as it's consumed, released %d times", released1.calls);
+    SDLTest_AssertCheck(released1.buf == buffer1 && released1.buflen == len, "The release callback should get the original buffer and length");
+    SDLTest_AssertCheck(SDL_memcmp(output, buffer1, len) == 0, "Expected the stream to output the buffer unchanged");
+
+    /* Buffers that are never read are released when the stream is cleared */
+    SDL_zero(released1);
+    SDL_zero(released2);
+    SDL_PutAudioStreamBuffer(stream, buffer1, len, audio_releaseAudioBuffer, &released1);
+    SDL_PutAudioStreamBuffer(stream, buffer2, len, audio_releaseAudioBuffer, &released2);
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == len * 2, "Expected both buffers to be queued");
+    SDL_ClearAudioStream(stream);
+    SDLTest_AssertCheck(released1.calls == 1 && released2.calls == 1, "Clearing the stream should release both buffers");
+    SDL_DestroyAudioStream(stream);
+
+    /* A resampling stream still reads the buffers in place, and releases them once they're flushed and read */
+    stream = SDL_CreateAudioStream(&spec, &resampled_spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+    SDL_zero(released1);
+    SDL_zero(released2);
+    SDL_PutAudioStreamBuffer(stream, buffer1, len, audio_releaseAudioBuffer, &released1);
+    SDL_PutAudioStreamBuffer(stream, buffer2, len, audio_releaseAudioBuffer, &released2);
+    SDL_FlushAudioStream(stream);
+    while ((ret = SDL_GetAudioStreamData(stream, output, len)) > 0) {
+        for (i = 0; i < ret / (int)sizeof(float); ++i) {
+            errors += (output[i] != output[i]);
+        }
+    }
+    SDLTest_AssertCheck(ret == 0, "Expected SDL_GetAudioStreamData to run out of data, returned %d", ret);
+    SDLTest_AssertCheck(errors == 0, "Expected no NaNs in the resampled output");
+    SDLTest_AssertCheck(released1.calls == 1 && released2.calls == 1, "Reading everything should release both buffers");
+    SDL_DestroyAudioStream(stream);
+
+    SDL_free(buffer1);
+    SDL_free(buffer2);
+    SDL_free(output);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Writes a WAVE file with random audio data into buf and returns its size.
+ * For the ADPCM encodings, blockalign is the block size and the block
+ * headers are filled with valid values.
+ */
+static size_t audio_writeTestWAV(Uint8 *buf, Uint16 encoding, Uint16 channels, Uint16 bits, Uint16 blockalign, Uint32 datalen)
+{
+    static const Sint16 ms_adpcm_coeffs[14] = { 256, 0, 512, -256, 0, 0, 192, 64, 240, 0, 460, -208, 392, -232 };
+    Uint16 samplesperblock = 0;
+    Uint8 *p = buf;
+    Uint32 fmtlen = 16;
+    Uint32 i, c;
+
+#define PUT16(v) do { Uint16 v16 = (Uint16)(v); *p++ = (Uint8)(v16 & 0xff); *p++ = (Uint8)(v16 >> 8); } while (0)
+#define PUT32(v) do { Uint32 v32 = (Uint32)(v); PUT16(v32 & 0xffff); PUT16(v32 >> 16); } while (0)
+
+    if (encoding == 0x0002) {
+        samplesperblock = (Uint16)((blockalign - 7 * channels) * 8 / (4 * channels) + 2);
+        fmtlen = 18 + 4 + 7 * 4;
+    } else if (encoding == 0x0011) {
+        samplesperblock = (Uint16)((blockalign - 4 * channels) * 8 / (4 * channels) + 1);
+        fmtlen = 18 + 2;
+    }
+
+    SDL_memcpy(p, "RIFF", 4);
+    p += 4;
+    PUT32(4 + 8 + fmtlen + 8 + datalen);
+    SDL_memcpy(p, "WAVEfmt ", 8);
+    p += 8;
+    PUT32(fmtlen);
+    PUT16(encoding);
+    PUT16(channels);
+    PUT32(22050);
+    PUT32(22050 * blockalign);
+    PUT16(blockalign);
+    PUT16(bits);
+    if (encoding == 0x0002) {
+        PUT16(4 + 7 * 4);
+        PUT16(samplesperblock);
+        PUT16(7);
+        for (i = 0; i < 14; ++i) {
+            PUT16(ms_adpcm_coeffs[i]);
+        }
+    } else if (encoding == 0x0011) {
+        PUT16(2);
+        PUT16(samplesperblock);
+    }
+    SDL_memcpy(p, "data", 4);
+    p += 4;
+    PUT32(datalen);
+
+    for (i = 0; i < datalen; ++i) {
+        p[i] = (Uint8)SDLTest_RandomUint8();
+    }
+    for (i = 0; i < datalen; i += blockalign) {
+        Uint8 *block = p + i;
+        if (encoding == 0x0002) {
+            for (c = 0; c < channels; ++c) {
+                block[c] = (Uint8)SDLTest_RandomIntegerInRange(0, 6);
+                block[channels + c * 2] = (Uint8)SDLTest_RandomIntegerInRange(16, 255);
+                block[channels + c * 2 + 1] = 0;
+            }
+        } else if (encoding == 0x0011) {
+            for (c = 0; c < channels; ++c) {
+                block[c * 4 + 2] = (Uint8)SDLTest_RandomIntegerInRange(0, 88);
+                block[c * 4 + 3] = 0;
+            }
+        }
+    }
+    p += datalen;
+
+#undef PUT16
+#undef PUT32
+
+    return p - buf;
+}
+
+/**
+ * Check that a WAVE stream decodes the same data as SDL_LoadWAV_IO, and that it can seek.
+ */
+static int audio_loadWAVStream(void *arg)
+{
+    static const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 bits;
+        Uint16 blockalign;
+        Uint32 datalen;
+    } files[] = {
+        { "16-bit PCM", 0x0001, 2, 16, 4, 40000 },
+        { "24-bit PCM", 0x0001, 3, 24, 9, 40500 },
+        { "float", 0x0003, 1, 32, 4, 40000 },
+        { "mu-law", 0x0007, 2, 8, 2, 40000 },
+        { "A-law", 0x0006, 1, 8, 1, 40000 },
+        { "MS ADPCM", 0x0002, 2, 4, 512, 512 * 60 },
+        { "IMA ADPCM", 0x0011, 2, 4, 1024, 1024 * 30 },
+        { "truncated IMA ADPCM", 0x0011, 1, 4, 256, 256 * 40 + 100 },
+    };
+    const size_t wavsize = 256 * 1024;
+    Uint8 *wav = (Uint8 *)SDL_malloc(wavsize);
+    Uint8 *output = (Uint8 *)SDL_malloc(wavsize * 4);
+    int i;
+
+    if (!SDLTest_AssertCheck(wav && output, "Expected buffers to be allocated")) {
+        SDL_free(wav);
+        SDL_free(output);
+        return TEST_ABORTED;
+    }
+
+    SDLTest_AssertCheck(SDL_LoadWAVStream_IO(NULL, SDL_FALSE, NULL) == NULL, "SDL_LoadWAVStream_IO(NULL) should fail");
+    SDLTest_AssertCheck(SDL_SeekWAVStream(NULL, 0) == -1, "SDL_SeekWAVStream(NULL) should fail");
+
+    for (i = 0; i < (int)SDL_arraysize(files); ++i) {
+        const size_t size = audio_writeTestWAV(wav, files[i].encoding, files[i].channels, files[i].bits, files[i].blockalign, files[i].datalen);
+        SDL_AudioSpec spec, streamspec;
+        SDL_AudioStream *stream;
+        Uint8 *expected = NULL;
+        Uint32 expected_len = 0;
+        int framesize, frames, total, seekframe, ret;
+
+        SDLTest_Log("Checking %s", files[i].name);
+
+        ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, &spec, &expected, &expected_len);
+        if (!SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to succeed, error: %s", SDL_GetError())) {
+            continue;
+        }
+        framesize = SDL_AUDIO_FRAMESIZE(spec);
+        frames = (int)expected_len / framesize;
+
+        stream = SDL_LoadWAVStream_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, &streamspec);
+        if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_LoadWAVStream_IO to succeed, error: %s", SDL_GetError())) {
+            SDL_free(expected);
+            continue;
+        }
+        SDLTest_AssertCheck(spec.format == streamspec.format && spec.channels == streamspec.channels && spec.freq == streamspec.freq,
+                            "Expected the same spec as SDL_LoadWAV_IO");
+        SDLTest_AssertCheck(SDL_GetNumberProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_WAVE_FRAMES_NUMBER, -1) == frames,
+                            "Expected the stream to report %d sample frames", frames);
+        SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == 0, "Expected nothing to be decoded up front");
+
+        /* Read everything in odd sized pieces */
+        total = 0;
+        while ((ret = SDL_GetAudioStreamData(stream, output + total, framesize * 333)) > 0) {
+            total += ret;
+        }
+        SDLTest_AssertCheck(total == (int)expected_len, "Expected %d bytes from the stream, got %d", (int)expected_len, total);
+        SDLTest_AssertCheck(total == (int)expected_len && SDL_memcmp(output, expected, expected_len) == 0, "Expected the stream to decode the same data as SDL_LoadWAV_IO");
+
+        /* Seek into the middle of a block and read the rest */
+        seekframe = frames / 2 + 7;
+        ret = SDL_SeekWAVStream(stream, seekframe);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_SeekWAVStream to succeed, returned %d", ret);
+        total = 0;
+        while ((ret = SDL_GetAudioStreamData(stream, output + total, framesize * 1000)) > 0) {
+            total += ret;
+        }
+        SDLTest_AssertCheck(total == (frames - seekframe) * framesize, "Expected %d bytes after seeking, got %d", (frames - seekframe) * framesize, total);
+        SDLTest_AssertCheck(total == (frames - seekframe) * framesize && SDL_memcmp(output, expected + seekframe * framesize, total) == 0, "Expected the same data after seeking");
+
+        SDLTest_AssertCheck(SDL_SeekWAVStream(stream, frames + 1) == -1, "Seeking past the end should fail");
+        SDLTest_AssertCheck(SDL_SeekWAVStream(stream, frames) == 0, "Seeking to the end should succeed");
+        SDLTest_AssertCheck(SDL_GetAudioStreamData(stream, output, framesize) == 0, "Expected no data at the end");
+
+        SDL_DestroyAudioStream(stream);
+        SDL_free(expected);
+    }
+
+    /* A corrupt block stops decoding and leaves the error on the stream */
+    {
+        const Uint32 datalen = 512 * 60;
+        const size_t size = audio_writeTestWAV(wav, 0x0002, 2, 4, 512, datalen);
+        const int framesize = 2 * (int)sizeof(Sint16);
+        const int blockframes = 500;
+        SDL_AudioStream *stream;
+        int total, ret;
+
+        SDLTest_Log("Checking a corrupt MS ADPCM block");
+
+        /* An out of range coefficient index in the header of block 30 */
+        wav[size - datalen + 512 * 30] = 100;
+
+        stream = SDL_LoadWAVStream_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, NULL);
+        if (SDLTest_AssertCheck(stream != NULL, "Expected SDL_LoadWAVStream_IO to succeed, error: %s", SDL_GetError())) {
+            SDL_PropertiesID props = SDL_GetAudioStreamProperties(stream);
+
+            total = 0;
+            while ((ret = SDL_GetAudioStreamData(stream, output + total, framesize * 333)) > 0) {
+                total += ret;
+            }
+            SDLTest_AssertCheck(total == 30 * blockframes * framesize, "Expected %d bytes before the corrupt block, got %d", 30 * blockframes * framesize, total);
+            SDLTest_AssertCheck(SDL_GetStringProperty(props, SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING, NULL) != NULL,
+                                "Expected the stream to report the decoding error");
+
+            ret = SDL_SeekWAVStream(stream, 29 * blockframes);
+            SDLTest_AssertCheck(ret == 0, "Expected SDL_SeekWAVStream to succeed, returned %d", ret);
+            SDLTest_AssertCheck(SDL_GetStringProperty(props, SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING, NULL) == NULL,
+                                "Expected seeking to clear the decoding error");
+            total = 0;
+            while ((ret = SDL_GetAudioStreamData(stream, output + total, framesize * 333)) > 0) {
+                total += ret;
+            }
+            SDLTest_AssertCheck(total == blockframes * framesize, "Expected %d bytes after seeking, got %d", blockframes * framesize, total);
+            SDLTest_AssertCheck(SDL_GetStringProperty(props, SDL_PROP_AUDIOSTREAM_WAVE_ERROR_STRING, NULL) != NULL,
+                                "Expected the stream to report the decoding error again");
+            SDL_DestroyAudioStream(stream);
+        }
+    }
+
+    /* Only streams from WAVE files can seek */
+    {
+        const SDL_AudioSpec spec = { SDL_AUDIO_S16, 1, 22050 };
+        SDL_AudioStream *stream = SDL_CreateAudioStream(&spec, &spec);
+        SDLTest_AssertCheck(SDL_SeekWAVStream(stream, 0) == -1, "SDL_SeekWAVStream on a regular stream should fail");
+        SDL_DestroyAudioStream(stream);
+    }
+
+    SDL_free(wav);
+    SDL_free(output);
+
+    return TEST_COMPLETED;
+}
+
+/* SDL_HINT_AUDIO_OFFLINE_RENDERING and the timing below depend on one of these drivers. */
+static SDL_bool audio_isVirtualDriver(void)
+{
+    const char *driver = SDL_GetCurrentAudioDriver();
+    return driver && (SDL_strcmp(driver, "dummy") == 0 || SDL_strcmp(driver, "disk") == 0);
+}
+
+/**
+ * Check that playback devices count periods, underruns and short reads, and report them through properties.
+ *
+ * \sa SDL_GetAudioDeviceProperties
+ * \sa SDL_GetAudioStreamProperties
+ */
+static int audio_deviceProperties(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int num_frames = spec.freq / 20;  /* 50ms of audio, then the stream runs dry. */
+    char *old_driver;
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    SDL_PropertiesID props;
+    const Sint64 *histogram;
+    Sint64 periods, underruns, short_reads, total = 0;
+    float *data;
+    int i, buckets;
+
+    SDLTest_AssertCheck(SDL_GetAudioDeviceProperties(0) == 0, "SDL_GetAudioDeviceProperties(0) should fail");
+
+    /* The dummy driver plays in real time, without needing any hardware. */
+    old_driver = SDL_GetHint(SDL_HINT_AUDIO_DRIVER) ? SDL_strdup(SDL_GetHint(SDL_HINT_AUDIO_DRIVER)) : NULL;
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, "dummy");
+    if (!SDLTest_AssertCheck(SDL_InitSubSystem(SDL_INIT_AUDIO) == 0, "Expected the dummy audio driver to initialize")) {
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, old_driver);
+        SDL_free(old_driver);
+        return TEST_ABORTED;
+    }
+
+    data = (float *)SDL_calloc(num_frames, SDL_AUDIO_FRAMESIZE(spec));
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL);
+    if (!SDLTest_AssertCheck(data && stream, "Expected SDL_OpenAudioDeviceStream to succeed")) {
+        SDL_free(data);
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+        SDL_SetHint(SDL_HINT_AUDIO_DRIVER, old_driver);
+        SDL_free(old_driver);
+        audioSetUp(NULL);
+        return TEST_ABORTED;
+    }
+    devid = SDL_GetAudioStreamDevice(stream);
+
+    SDL_PutAudioStreamData(stream, data, num_frames * SDL_AUDIO_FRAMESIZE(spec));
+    SDL_ResumeAudioDevice(devid);
+    SDL_Delay(300);
+    SDL_PauseAudioDevice(devid);
+
+    props = SDL_GetAudioDeviceProperties(devid);
+    SDLTest_AssertCheck(props != 0, "Expected SDL_GetAudioDeviceProperties to succeed");
+
+    periods = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER, -1);
+    underruns = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_UNDERRUNS_NUMBER, -1);
+    short_reads = SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_SHORT_READS_NUMBER, -1);
+    buckets = (int)SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_BUCKETS_NUMBER, 0);
+    histogram = (const Sint64 *)SDL_GetProperty(props, SDL_PROP_AUDIO_DEVICE_ITERATE_HISTOGRAM_POINTER, NULL);
+
+    SDLTest_AssertCheck(periods > 0, "Expected the device to have played some periods, got %" SDL_PRIs64, periods);
+    SDLTest_AssertCheck(underruns > 0 && underruns < periods, "Expected some but not all periods to underrun, got %" SDL_PRIs64 " of %" SDL_PRIs64, underruns, periods);
+    SDLTest_AssertCheck(short_reads >= underruns, "Expected at least one short read per underrun, got %" SDL_PRIs64, short_reads);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_MAX_ITERATE_NS_NUMBER, -1) >= 0, "Expected a maximum iteration time");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIO_DEVICE_LATE_WAKEUPS_NUMBER, -1) >= 0, "Expected a late wakeup count");
+    if (SDLTest_AssertCheck(histogram != NULL && buckets > 0, "Expected an iteration time histogram")) {
+        for (i = 0; i < buckets; i++) {
+            total += histogram[i];
+        }
+        SDLTest_AssertCheck(total == periods, "Expected the histogram to count every period, got %" SDL_PRIs64 " of %" SDL_PRIs64, total, periods);
+    }
+
+    props = SDL_GetAudioStreamProperties(stream);
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_SHORT_READS_NUMBER, -1) > 0, "Expected the stream to report short reads");
+    SDLTest_AssertCheck(SDL_GetNumberProperty(props, SDL_PROP_AUDIOSTREAM_DEVICE_QUEUED_FRAMES_NUMBER, -1) == 0, "Expected the stream to have been drained");
+
+    SDL_DestroyAudioStream(stream);
+    SDL_free(data);
+
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    SDL_SetHint(SDL_HINT_AUDIO_DRIVER, old_driver);
+    SDL_free(old_driver);
+    audioSetUp(NULL);
+
+    return TEST_COMPLETED;
+}
+
+typedef struct
+{
+    float *buf;
+    int len;
+    int capacity;
+} CapturedAudio;
+
+static void SDLCALL audio_capturePostmix(void *userdata, const SDL_AudioSpec *spec, float *buffer, int buflen)
+{
+    CapturedAudio *captured = (CapturedAudio *)userdata;
+    const int len = SDL_min(buflen, captured->capacity - captured->len);
+
+    SDL_memcpy((Uint8 *)captured->buf + captured->len, buffer, len);
+    captured->len += len;
+}
+
+/* Plays `data` on a device opened in offline mode, capturing the final mix. Returns the number of buffers rendered. */
+static Sint64 audio_renderOffline(const SDL_AudioSpec *spec, const float *data, int num_frames, CapturedAudio *captured)
+{
+    SDL_AudioStream *stream;
+    SDL_AudioDeviceID devid;
+    SDL_AudioSpec devspec;
+    Sint64 expected_periods, periods = 0;
+    Uint64 start;
+    int sample_frames = 0;
+
+    stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, spec, NULL, NULL);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_OpenAudioDeviceStream to succeed")) {
+        return -1;
+    }
+    devid = SDL_GetAudioStreamDevice(stream);
+    SDL_GetAudioDeviceFormat(devid, &devspec, &sample_frames);
+    expected_periods = ((Sint64)num_frames + sample_frames - 1) / sample_frames;
+    SDLTest_AssertCheck(devspec.freq == spec->freq, "Expected the device to run at %d Hz, got %d", spec->freq, devspec.freq);
+    SDL_SetAudioPostmixCallback(devid, audio_capturePostmix, captured);
+
+    /* Resume first: in offline mode, nothing is rendered until there's data, so this doesn't add any silence. */
+    SDL_ResumeAudioDevice(devid);
+    SDL_Delay(20);
+    SDL_PutAudioStreamData(stream, data, num_frames * SDL_AUDIO_FRAMESIZE(*spec));
+    SDL_FlushAudioStream(stream);
+
+    start = SDL_GetTicks();
+    while (SDL_GetTicks() - start < 10000) {
+        periods = SDL_GetNumberProperty(SDL_GetAudioDeviceProperties(devid), SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER, 0);
+        if (periods >= expected_periods) {
+            break;
+        }
+        SDL_Delay(1);
+    }
+    SDLTest_Log("Rendered %d frames in %d ms", num_frames, (int)(SDL_GetTicks() - start));
+
+    /* Once the stream is drained, the device should stop instead of rendering silence. */
+    SDL_Delay(50);
+    periods = SDL_GetNumberProperty(SDL_GetAudioDeviceProperties(devid), SDL_PROP_AUDIO_DEVICE_PERIODS_NUMBER, 0);
+    SDLTest_AssertCheck(periods == expected_periods, "Expected %" SDL_PRIs64 " periods, got %" SDL_PRIs64, expected_periods, periods);
+
+    SDL_DestroyAudioStream(stream);
+
+    return periods;
+}
+
+/**
+ * Check that devices render as fast as they are fed, and the same every time, with SDL_HINT_AUDIO_OFFLINE_RENDERING.
+ *
+ * \sa SDL_HINT_AUDIO_OFFLINE_RENDERING
+ */
+static int audio_offlineRendering(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_F32, 2, 48000 };
+    const int num_frames = spec.freq * 2;  /* this would take two seconds in real time. */
+    const int len = num_frames * SDL_AUDIO_FRAMESIZE(spec);
+    CapturedAudio first, second;
+    float *data;
+    int i, errors = 0;
+
+    if (!audio_isVirtualDriver()) {
+        SDLTest_Log("This test needs the dummy or disk audio driver, skipping");
+        return TEST_SKIPPED;
+    }
+
+    SDL_zero(first);
+    SDL_zero(second);
+    first.capacity = second.capacity = len * 2;
+    first.buf = (float *)SDL_malloc(first.capacity);
+    second.buf = (float *)SDL_malloc(second.capacity);
+    data = (float *)SDL_malloc(len);
+    if (!SDLTest_AssertCheck(first.buf && second.buf && data, "Expected buffers to be allocated")) {
+        SDL_free(first.buf);
+        SDL_free(second.buf);
+        SDL_free(data);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < num_frames * spec.channels; ++i) {
+        data[i] = SDLTest_RandomUnitFloat() * 2.0f - 1.0f;
+    }
+
+    /* The hint is read when the physical device opens, so make sure nothing (like the test harness) has it open already. */
+    SDL_SetHint(SDL_HINT_AUDIO_OFFLINE_RENDERING, "1");
+    while (SDL_WasInit(SDL_INIT_AUDIO)) {
+        SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    }
+    audioSetUp(NULL);
+
+    audio_renderOffline(&spec, data, num_frames, &first);
+    audio_renderOffline(&spec, data, num_frames, &second);
+    SDL_ResetHint(SDL_HINT_AUDIO_OFFLINE_RENDERING);
+
+    SDLTest_AssertCheck(first.len >= len && first.len == second.len, "Expected both renders to be complete and the same length, got %d and %d bytes", first.len, second.len);
+    SDLTest_AssertCheck(SDL_memcmp(first.buf, second.buf, SDL_min(first.len, second.len)) == 0, "Expected both renders to be identical");
+    for (i = 0; i < (int)(SDL_min(first.len, len) / sizeof(float)); ++i) {
+        errors += (first.buf[i] != data[i]);
+    }
+    SDLTest_AssertCheck(errors == 0, "Expected the render to start with the input, without any silence; %d samples differ", errors);
+
+    SDL_free(first.buf);
+    SDL_free(second.buf);
+    SDL_free(data);
+
+    return TEST_COMPLETED;
+}
+
+#define SINGLE_PRODUCER_FRAMES (1024 * 1024)
+
+typedef struct
+{
+    SDL_AudioStream *stream;
+    const SDL_AudioSpec *spec;
+    int failures;
+} SingleProducerData;
+
+static void SDLCALL audio_freeReleasedBuffer(void *userdata, const void *buf, int buflen)
+{
+    SDL_free((void *)buf);
+}
+
+static int SDLCALL audio_singleProducerThread(void *arg)
+{
+    SingleProducerData *data = (SingleProducerData *)arg;
+    Uint32 seed = 0x1234;
+    Sint32 buffer[4096];
+    Sint32 next = 0;
+    int puts = 0;
+
+    while (next < SINGLE_PRODUCER_FRAMES) {
+        int i, frames, result;
+
+        /* not SDLTest_Random*, which isn't thread safe. */
+        seed = seed * 1103515245 + 12345;
+        frames = SDL_min(1 + (int)((seed >> 16) % SDL_arraysize(buffer)), SINGLE_PRODUCER_FRAMES - next);
+        for (i = 0; i < frames; i++) {
+            buffer[i] = next++;
+        }
+
+        /* Mix in a few puts that have to lock, so they need to stay in order with the ones that don't. */
+        puts++;
+        if ((puts % 64) == 0) {
+            void *copy = SDL_malloc(frames * sizeof(Sint32));
+            if (copy) {
+                SDL_memcpy(copy, buffer, frames * sizeof(Sint32));
+            }
+            result = copy ? SDL_PutAudioStreamBuffer(data->stream, copy, frames * sizeof(Sint32), audio_freeReleasedBuffer, NULL) : -1;
+        } else {
+            if ((puts % 100) == 0) {
+                SDL_SetAudioStreamFormat(data->stream, data->spec, NULL);  /* the next put takes the lock to pick this up. */
+            }
+            result = SDL_PutAudioStreamData(data->stream, buffer, frames * sizeof(Sint32));
+        }
+        if (result != 0) {
+            data->failures++;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Check that a stream with SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN returns exactly what one thread put into it while another reads.
+ *
+ * \sa SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN
+ */
+static int audio_singleProducerStream(void *arg)
+{
+    const SDL_AudioSpec spec = { SDL_AUDIO_S32, 1, 48000 };
+    SingleProducerData data;
+    SDL_AudioStream *stream;
+    SDL_Thread *thread;
+    Sint32 buffer[3000];
+    Sint32 expected = 0;
+    Uint64 start;
+    int errors = 0;
+
+    stream = SDL_CreateAudioStream(&spec, &spec);
+    if (!SDLTest_AssertCheck(stream != NULL, "Expected SDL_CreateAudioStream to succeed")) {
+        return TEST_ABORTED;
+    }
+    SDLTest_AssertCheck(SDL_SetBooleanProperty(SDL_GetAudioStreamProperties(stream), SDL_PROP_AUDIOSTREAM_SINGLE_PRODUCER_BOOLEAN, SDL_TRUE) == 0, "Expected SDL_SetBooleanProperty to succeed");
+
+    data.stream = stream;
+    data.spec = &spec;
+    data.failures = 0;
+    thread = SDL_CreateThread(audio_singleProducerThread, "SingleProducer", &data);
+    if (!SDLTest_AssertCheck(thread != NULL, "Expected SDL_CreateThread to succeed")) {
+        SDL_DestroyAudioStream(stream);
+        return TEST_ABORTED;
+    }
+
+    start = SDL_GetTicks();
+    while ((expected < SINGLE_PRODUCER_FRAMES) && (SDL_GetTicks() - start < 30000)) {
+        const int want = 1 + SDLTest_RandomIntegerInRange(0, SDL_arraysize(buffer) - 1);
+        const int got = SDL_GetAudioStreamData(stream, buffer, want * sizeof(Sint32));
+        int i;
+
+        if (got < 0) {
+            break;
+        }
+        for (i = 0; i < got / (int)sizeof(Sint32); i++) {
+            if (buffer[i] != expected++) {
+                errors++;
+                expected = buffer[i] + 1;  /* resync, so one mistake doesn't count as thousands. */
+            }
+        }
+    }
+
+    SDL_WaitThread(thread, NULL);
+
+    SDLTest_AssertCheck(data.failures == 0, "Expected every put to succeed, %d failed", data.failures);
+    SDLTest_AssertCheck(expected == SINGLE_PRODUCER_FRAMES, "Expected to get %d frames, got %d", SINGLE_PRODUCER_FRAMES, (int)expected);
+    SDLTest_AssertCheck(errors == 0, "Expected every frame in order, %d were out of place", errors);
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 0, "Expected nothing left in the stream");
+
+    /* The lock-free puts still have to be visible to everything else that looks at the queue. */
+    SDL_PutAudioStreamData(stream, buffer, 100 * sizeof(Sint32));
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 100 * sizeof(Sint32), "Expected SDL_GetAudioStreamQueued to include lock-free puts");
+    SDLTest_AssertCheck(SDL_GetAudioStreamAvailable(stream) == 100 * sizeof(Sint32), "Expected SDL_GetAudioStreamAvailable to include lock-free puts");
+    SDL_ClearAudioStream(stream);
+    SDLTest_AssertCheck(SDL_GetAudioStreamQueued(stream) == 0, "Expected SDL_ClearAudioStream to clear lock-free puts");
+
+    SDL_PutAudioStreamData(stream, buffer, 100 * sizeof(Sint32));
+    SDL_DestroyAudioStream(stream);  /* with data still in the inbox; shouldn't leak. */
+
+    return TEST_COMPLETED;
+}
+
+/* The companding laws, as written in the G.711 standard. */
+static Sint16 audio_expandCompanded(Uint16 encoding, Uint8 code)
+{
+    if (encoding == 0x0006) {
+        const Uint8 bits = (Uint8)(code ^ 0x55);
+        const int exponent = (bits >> 4) & 0x07;
+        int value = ((bits & 0x0f) << 4) + 8;
+        if (exponent > 0) {
+            value = (value + 0x100) << (exponent - 1);
+        }
+        return (Sint16)((code & 0x80) ? value : -value);
+    } else {
+        const Uint8 bits = (Uint8)~code;
+        const int exponent = (bits >> 4) & 0x07;
+        const int value = ((((bits & 0x0f) << 3) + 0x84) << exponent) - 0x84;
+        return (Sint16)((bits & 0x80) ? -value : value);
+    }
+}
+
+/**
+ * Check the companded decoders against the standard, and that large ADPCM
+ * files decode the same on one thread and on several.
+ */
+static int audio_decodeWAV(void *arg)
+{
+    static const struct
+    {
+        const char *name;
+        Uint16 encoding;
+        Uint16 channels;
+        Uint16 blockalign;
+    } adpcm[] = {
+        { "MS ADPCM mono", 0x0002, 1, 512 },
+        { "MS ADPCM stereo", 0x0002, 2, 1024 },
+        { "IMA ADPCM mono", 0x0011, 1, 512 },
+        { "IMA ADPCM stereo", 0x0011, 2, 1024 },
+        { "IMA ADPCM 3 channels", 0x0011, 3, 1536 },
+    };
+    const Uint32 numblocks = 300; /* Enough sample frames for a few threads. */
+    const size_t wavsize = 1536 * 301;
+    Uint8 *wav = (Uint8 *)SDL_malloc(wavsize);
+    int i, j;
+
+    if (!SDLTest_AssertCheck(wav != NULL, "Expected buffer to be allocated")) {
+        return TEST_ABORTED;
+    }
+
+    /* Every code in turn, with an odd length so the vector decoders leave some for the scalar code. */
+    for (i = 0; i < 2; ++i) {
+        const Uint16 encoding = i ? 0x0006 : 0x0007;
+        const Uint32 datalen = 256 * 5 + 13;
+        const size_t size = audio_writeTestWAV(wav, encoding, 1, 8, 1, datalen);
+        Uint8 *data = wav + size - datalen;
+        SDL_AudioSpec spec;
+        Uint8 *output = NULL;
+        Uint32 output_len = 0;
+        int mismatches = 0;
+        int ret;
+
+        for (j = 0; j < (int)datalen; ++j) {
+            data[j] = (Uint8)(j * 7);
+        }
+        ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, &spec, &output, &output_len);
+        SDLTest_AssertCheck(ret == 0, "Expected SDL_LoadWAV_IO to decode %s, error: %s", i ? "A-law" : "mu-law", SDL_GetError());
+        SDLTest_AssertCheck(output_len == datalen * sizeof(Sint16), "Expected %d bytes, got %d", (int)(datalen * sizeof(Sint16)), (int)output_len);
+        if (ret == 0 && output_len == datalen * sizeof(Sint16)) {
+            for (j = 0; j < (int)datalen; ++j) {
+                if (((Sint16 *)output)[j] != audio_expandCompanded(encoding, data[j])) {
+                    ++mismatches;
+                }
+            }
+        }
+        SDLTest_AssertCheck(mismatches == 0, "Expected every %s code to expand as specified, %d didn't", i ? "A-law" : "mu-law", mismatches);
+        SDL_free(output);
+    }
+
+    for (i = 0; i < (int)SDL_arraysize(adpcm); ++i) {
+        /* Half a block at the end gets decoded after the threads are done. */
+        const Uint32 datalen = adpcm[i].blockalign * numblocks + adpcm[i].blockalign / 2;
+        const size_t size = audio_writeTestWAV(wav, adpcm[i].encoding, adpcm[i].channels, 4, adpcm[i].blockalign, datalen);
+        Uint8 *serial = NULL, *threaded = NULL;
+        Uint32 serial_len = 0, threaded_len = 0;
+        SDL_AudioSpec spec;
+        int serial_ret, threaded_ret;
+
+        SDLTest_Log("Checking %s", adpcm[i].name);
+
+        SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+        serial_ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, &spec, &serial, &serial_len);
+        SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "4");
+        threaded_ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, &spec, &threaded, &threaded_len);
+        SDLTest_AssertCheck(serial_ret == 0 && threaded_ret == 0, "Expected SDL_LoadWAV_IO to succeed, error: %s", SDL_GetError());
+        SDLTest_AssertCheck(serial_len > 0 && serial_len == threaded_len && SDL_memcmp(serial, threaded, serial_len) == 0,
+                            "Expected the same %d bytes with and without threads", (int)serial_len);
+        SDL_free(serial);
+        SDL_free(threaded);
+
+        if (adpcm[i].encoding == 0x0002) {
+            /* A bad block header in the middle still has to fail the whole file. */
+            wav[size - datalen + adpcm[i].blockalign * (numblocks * 2 / 3)] = 200;
+            serial = threaded = NULL;
+            threaded_ret = SDL_LoadWAV_IO(SDL_IOFromConstMem(wav, size), SDL_TRUE, &spec, &threaded, &threaded_len);
+            SDLTest_AssertCheck(threaded_ret == -1 && threaded == NULL, "Expected SDL_LoadWAV_IO to fail on an invalid coefficient index");
+            SDLTest_AssertCheck(SDL_strstr(SDL_GetError(), "coefficient") != NULL, "Expected the error to be about the coefficient index: %s", SDL_GetError());
+        }
+    }
+
+    SDL_ResetHint(SDL_HINT_WAVE_DECODE_THREADS);
+    SDL_free(wav);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test Case References ================== */
 
 /* Audio test cases */
@@ -1442,12 +2359,45 @@ static const SDLTest_TestCaseReference audioTest18 = {
     audio_formatChange, "audio_formatChange", "Check handling of format changes.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference audioTest19 = {
+    audio_mixAudio, "audio_mixAudio", "Check the results of SDL_MixAudio.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest20 = {
+    audio_streamGain, "audio_streamGain", "Check that audio stream gain scales the output.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest21 = {
+    audio_putAudioStreamBuffer, "audio_putAudioStreamBuffer", "Check that buffers added without copying are released when done.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest22 = {
+    audio_loadWAVStream, "audio_loadWAVStream", "Check that WAVE streams decode the same data as SDL_LoadWAV_IO and can seek.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest23 = {
+    audio_deviceProperties, "audio_deviceProperties", "Check that audio devices report periods and underruns through properties.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest24 = {
+    audio_offlineRendering, "audio_offlineRendering", "Check that offline rendering is fast and deterministic.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest25 = {
+    audio_singleProducerStream, "audio_singleProducerStream", "Check that single producer streams return exactly what was put, across threads.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference audioTest26 = {
+    audio_decodeWAV, "audio_decodeWAV", "Check the companded decoders and threaded ADPCM decoding of WAVE files.", TEST_ENABLED
+};
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] = {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
     &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
-    &audioTest17, &audioTest18, NULL
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, &audioTest22,
+    &audioTest23, &audioTest24, &audioTest25, &audioTest26, NULL
 };
 
 /* Audio test suite (global) */
@@ -175,6 +175,230 @@ static int events_addDelEventWatchWithUserdata(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Push a run of numbered user events onto the queue */
+static void events_pushNumberedUserevents(int count)
+{
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    for (i = 0; i < count; ++i) {
+        event.common.timestamp = 0;
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+}
+
+/**
+ * Polls many events at once and compares the cost with polling them one by one.
+ *
+ * \sa SDL_PollEvents
+ * \sa SDL_PollEvent
+ */
+static int events_pollEventsBatch(void *arg)
+{
+    const int count = 4096;
+    SDL_Event events[64];
+    SDL_Event event;
+    Uint64 start, single_ticks, batch_ticks;
+    int expected = 0;
+    int result;
+    int i;
+
+    /* Start from an empty queue */
+    while (SDL_PollEvent(&event)) {
+    }
+
+    events_pushNumberedUserevents(count);
+    SDLTest_AssertPass("Call to SDL_PushEvent() x %d", count);
+
+    while ((result = SDL_PollEvents(events, SDL_arraysize(events))) > 0) {
+        for (i = 0; i < result; ++i) {
+            if (events[i].type != SDL_EVENT_USER) {
+                continue;
+            }
+            if (events[i].user.code != expected) {
+                break;
+            }
+            ++expected;
+        }
+    }
+    SDLTest_AssertPass("Call to SDL_PollEvents()");
+    SDLTest_AssertCheck(result == 0, "Check final result from SDL_PollEvents, expected: 0, got: %d", result);
+    SDLTest_AssertCheck(expected == count, "Check user events received in order, expected: %d, got: %d", count, expected);
+
+    result = SDL_PollEvents(NULL, 1);
+    SDLTest_AssertCheck(result < 0, "Check SDL_PollEvents with NULL events fails, got: %d", result);
+
+    /* A loop ends at the end of the poll cycle, even with events arriving all the time */
+    events_pushNumberedUserevents(100);
+    for (i = 0; i < count; ++i) {
+        result = SDL_PollEvents(events, SDL_arraysize(events));
+        if (result <= 0) {
+            break;
+        }
+        events_pushNumberedUserevents(8);
+    }
+    SDLTest_AssertCheck(result == 0, "Check SDL_PollEvents loop ends with events still arriving, expected: 0, got: %d after %d calls", result, i + 1);
+    while (SDL_PollEvent(&event)) {
+    }
+
+    /* Compare the cost of draining the queue one event at a time and in batches */
+    events_pushNumberedUserevents(count);
+    start = SDL_GetPerformanceCounter();
+    while (SDL_PollEvent(&event)) {
+    }
+    single_ticks = SDL_GetPerformanceCounter() - start;
+
+    events_pushNumberedUserevents(count);
+    start = SDL_GetPerformanceCounter();
+    while (SDL_PollEvents(events, SDL_arraysize(events)) > 0) {
+    }
+    batch_ticks = SDL_GetPerformanceCounter() - start;
+
+    SDLTest_Log("Polling %d events: SDL_PollEvent %.1f ns/event, SDL_PollEvents %.1f ns/event",
+                count,
+                (double)single_ticks * 1e9 / SDL_GetPerformanceFrequency() / count,
+                (double)batch_ticks * 1e9 / SDL_GetPerformanceFrequency() / count);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Peeks, gets and flushes ranges of event types while many other events are queued.
+ *
+ * \sa SDL_PeepEvents
+ * \sa SDL_HasEvent
+ * \sa SDL_FlushEvent
+ */
+static int events_typeFilteredQueries(void *arg)
+{
+    const int count = 3000;
+    const Uint32 types[] = { SDL_EVENT_USER, SDL_EVENT_USER + 1, SDL_EVENT_USER + 0x100 };
+    SDL_Event events[64];
+    SDL_Event event;
+    Uint64 start, ticks;
+    int expected = 0;
+    int received = 0;
+    int in_order = 1;
+    int result;
+    int i;
+
+    /* Start from an empty queue */
+    while (SDL_PollEvent(&event)) {
+    }
+
+    SDL_zero(event);
+    for (i = 0; i < count; ++i) {
+        event.type = types[i % SDL_arraysize(types)];
+        event.common.timestamp = 0;
+        event.user.code = i;
+        SDL_PushEvent(&event);
+    }
+    SDLTest_AssertPass("Call to SDL_PushEvent() x %d", count);
+
+    result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, types[2], types[2]);
+    SDLTest_AssertCheck(result == count / 3, "Check SDL_PeepEvents count, expected: %d, got: %d", count / 3, result);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < 1000; ++i) {
+        result = SDL_HasEvent(SDL_EVENT_QUIT);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    SDLTest_AssertCheck(!result, "Check SDL_HasEvent(SDL_EVENT_QUIT), expected: SDL_FALSE, got: %d", result);
+    SDLTest_Log("SDL_HasEvent(SDL_EVENT_QUIT) with %d events queued: %.1f ns/call",
+                count, (double)ticks * 1e9 / SDL_GetPerformanceFrequency() / 1000);
+
+    SDL_FlushEvent(types[1]);
+    SDLTest_AssertPass("Call to SDL_FlushEvent()");
+    result = SDL_PeepEvents(NULL, 0, SDL_PEEKEVENT, SDL_EVENT_USER, SDL_EVENT_USER + 0xff);
+    SDLTest_AssertCheck(result == count / 3, "Check SDL_PeepEvents count after flush, expected: %d, got: %d", count / 3, result);
+
+    /* Events of different types must still come out in the order they went in */
+    while ((result = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, types[0], types[2])) > 0) {
+        for (i = 0; i < result; ++i) {
+            if (events[i].user.code < expected || events[i].type == types[1]) {
+                in_order = 0;
+            }
+            expected = events[i].user.code + 1;
+        }
+        received += result;
+    }
+    SDLTest_AssertCheck(received == 2 * count / 3, "Check events received, expected: %d, got: %d", 2 * count / 3, received);
+    SDLTest_AssertCheck(in_order, "Check events were received in order");
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Allocates event memory for many events and checks it stays valid until they're handled.
+ *
+ * \sa SDL_AllocateEventMemory
+ */
+static int events_allocateEventMemory(void *arg)
+{
+    const int count = 1000;
+    SDL_Event event;
+    Uint64 start, ticks;
+    int received = 0;
+    int intact = 1;
+    int aligned = 1;
+    int i;
+
+    /* Start from an empty queue */
+    while (SDL_PollEvent(&event)) {
+    }
+
+    SDL_zero(event);
+    event.type = SDL_EVENT_USER;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < count; ++i) {
+        /* Vary the size so allocations straddle arena blocks, including some large ones */
+        const int size = (i % 100 == 0) ? 10000 : 1 + (i % 61);
+        Uint8 *memory = (Uint8 *)SDL_AllocateEventMemory(size);
+
+        if (!memory) {
+            SDLTest_AssertCheck(memory != NULL, "Check SDL_AllocateEventMemory(%d) result", size);
+            return TEST_ABORTED;
+        }
+        if (((uintptr_t)memory % sizeof(void *)) != 0) {
+            aligned = 0;
+        }
+        SDL_memset(memory, (Uint8)i, size);
+
+        event.common.timestamp = 0;
+        event.user.code = size;
+        event.user.data1 = memory;
+        SDL_PushEvent(&event);
+    }
+    ticks = SDL_GetPerformanceCounter() - start;
+    SDLTest_AssertPass("Call to SDL_AllocateEventMemory() x %d", count);
+    SDLTest_AssertCheck(aligned, "Check event memory is pointer aligned");
+
+    while (SDL_PollEvent(&event)) {
+        const Uint8 *memory = (const Uint8 *)event.user.data1;
+        int j;
+
+        if (event.type != SDL_EVENT_USER) {
+            continue;
+        }
+        for (j = 0; j < event.user.code; ++j) {
+            if (memory[j] != (Uint8)received) {
+                intact = 0;
+                break;
+            }
+        }
+        ++received;
+    }
+    SDLTest_AssertCheck(received == count, "Check events received, expected: %d, got: %d", count, received);
+    SDLTest_AssertCheck(intact, "Check event memory was intact when the events were handled");
+    SDLTest_Log("SDL_AllocateEventMemory + SDL_PushEvent: %.1f ns/event",
+                (double)ticks * 1e9 / SDL_GetPerformanceFrequency() / count);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -190,9 +414,21 @@ static const SDLTest_TestCaseReference eventsTest3 = {
     (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference eventsTest4 = {
+    (SDLTest_TestCaseFp)events_pollEventsBatch, "events_pollEventsBatch", "Polls many events at once and compares the cost with SDL_PollEvent", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest5 = {
+    (SDLTest_TestCaseFp)events_typeFilteredQueries, "events_typeFilteredQueries", "Peeks, gets and flushes ranges of event types while many other events are queued", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference eventsTest6 = {
+    (SDLTest_TestCaseFp)events_allocateEventMemory, "events_allocateEventMemory", "Allocates event memory for many events and checks it stays valid until they're handled", TEST_ENABLED
+};
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] = {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, &eventsTest6, NULL
 };
 
 /* Events test suite (global) */
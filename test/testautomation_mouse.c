@@ -488,6 +488,65 @@ static int mouse_warpMouseInWindow(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Check that consecutive mouse motion is merged when SDL_HINT_EVENT_COALESCE_MOTION is set
+ *
+ * \sa SDL_HINT_EVENT_COALESCE_MOTION
+ * \sa SDL_GetCoalescedEventCount
+ */
+static int mouse_coalesceMotion(void *arg)
+{
+    const int numMoves = 10;
+    SDL_Window *window;
+    SDL_Event event;
+    int motionEvents = 0;
+    int coalesced;
+    float x = 0.0f, y = 0.0f;
+    int i;
+
+    if (!SDL_strcmp(SDL_GetCurrentVideoDriver(), "wayland")) {
+        SDLTest_Log("Skipping mouse coalescing test: Wayland does not support warping the mouse pointer");
+        return TEST_SKIPPED;
+    }
+
+    window = createMouseSuiteTestWindow();
+    if (!window) {
+        return TEST_ABORTED;
+    }
+
+    SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "1");
+    SDLTest_AssertPass("SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, \"1\")");
+
+    /* Move into the window and start from an empty queue */
+    SDL_WarpMouseInWindow(window, 1.0f, 1.0f);
+    while (SDL_PollEvent(&event)) {
+    }
+    coalesced = SDL_GetCoalescedEventCount(SDL_EVENT_MOUSE_MOTION);
+
+    for (i = 0; i < numMoves; ++i) {
+        SDL_WarpMouseInWindow(window, (float)(10 + i), (float)(20 + i));
+    }
+    while (SDL_PollEvent(&event)) {
+        if (event.type == SDL_EVENT_MOUSE_MOTION) {
+            ++motionEvents;
+            x = event.motion.x;
+            y = event.motion.y;
+        }
+    }
+    coalesced = SDL_GetCoalescedEventCount(SDL_EVENT_MOUSE_MOTION) - coalesced;
+
+    SDLTest_AssertCheck(motionEvents < numMoves, "Check motion events were merged, expected: < %d, got: %d", numMoves, motionEvents);
+    SDLTest_AssertCheck(motionEvents + coalesced == numMoves, "Check coalesced count, expected: %d, got: %d", numMoves - motionEvents, coalesced);
+    SDLTest_AssertCheck(x == (float)(10 + numMoves - 1) && y == (float)(20 + numMoves - 1),
+                        "Check last motion has the latest position, expected: %d,%d, got: %.f,%.f",
+                        10 + numMoves - 1, 20 + numMoves - 1, x, y);
+
+    SDL_ResetHint(SDL_HINT_EVENT_COALESCE_MOTION);
+    destroyMouseSuiteTestWindow(window);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * Check call to SDL_GetMouseFocus
  *
@@ -646,10 +705,15 @@ static const SDLTest_TestCaseReference mouseTest12 = {
     (SDLTest_TestCaseFp)mouse_getGlobalMouseState, "mouse_getGlobalMouseState", "Check call to mouse_getGlobalMouseState", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference mouseTest13 = {
+    (SDLTest_TestCaseFp)mouse_coalesceMotion, "mouse_coalesceMotion", "Check that consecutive mouse motion is merged when SDL_HINT_EVENT_COALESCE_MOTION is set", TEST_ENABLED
+};
+
 /* Sequence of Mouse test cases */
 static const SDLTest_TestCaseReference *mouseTests[] = {
     &mouseTest1, &mouseTest2, &mouseTest3, &mouseTest4, &mouseTest5, &mouseTest6,
-    &mouseTest7, &mouseTest8, &mouseTest9, &mouseTest10, &mouseTest11, &mouseTest12, NULL
+    &mouseTest7, &mouseTest8, &mouseTest9, &mouseTest10, &mouseTest11, &mouseTest12,
+    &mouseTest13, NULL
 };
 
 /* Mouse test suite (global) */
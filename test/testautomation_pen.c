@@ -70,6 +70,8 @@
 #define SDL_GetMouse              SDL_Mock_GetMouse
 #define SDL_MousePositionInWindow SDL_Mock_MousePositionInWindow
 #define SDL_SetMouseFocus         SDL_Mock_SetMouseFocus
+/* Queue motion events the same way as any other event: */
+#define SDL_PushMotionEvent       SDL_PushEvent
 
 /* Mock mouse API */
 static int SDL_SendMouseMotion(Uint64 timestamp, SDL_Window *window, SDL_MouseID mouseID, SDL_bool relative, float x, float y);
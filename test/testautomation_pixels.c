@@ -367,6 +367,458 @@ static int pixels_allocFreePalette(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Double precision reference transfer functions for the colorspace conversion tests */
+static double pixels_sRGBtoLinear(double v)
+{
+    if (v <= 0.04045) {
+        return v / 12.92;
+    }
+    return SDL_pow((v + 0.055) / 1.055, 2.4);
+}
+
+static double pixels_sRGBfromLinear(double v)
+{
+    if (v <= 0.0031308) {
+        return v * 12.92;
+    }
+    return SDL_pow(v, 1.0 / 2.4) * 1.055 - 0.055;
+}
+
+static double pixels_PQtoNits(double v)
+{
+    const double c1 = 0.8359375;
+    const double c2 = 18.8515625;
+    const double c3 = 18.6875;
+    const double oo_m1 = 1.0 / 0.1593017578125;
+    const double oo_m2 = 1.0 / 78.84375;
+
+    double num = SDL_max(SDL_pow(v, oo_m2) - c1, 0.0);
+    double den = c2 - c3 * SDL_pow(v, oo_m2);
+    return 10000.0 * SDL_pow(num / den, oo_m1);
+}
+
+static double pixels_PQfromNits(double v)
+{
+    const double c1 = 0.8359375;
+    const double c2 = 18.8515625;
+    const double c3 = 18.6875;
+    const double m1 = 0.1593017578125;
+    const double m2 = 78.84375;
+
+    double y = SDL_clamp(v / 10000.0, 0.0, 1.0);
+    double num = c1 + c2 * SDL_pow(y, m1);
+    double den = 1.0 + c3 * SDL_pow(y, m1);
+    return SDL_pow(num / den, m2);
+}
+
+static void pixels_convertPrimaries(const double *matrix, double *rgb)
+{
+    double r = rgb[0], g = rgb[1], b = rgb[2];
+
+    rgb[0] = matrix[0] * r + matrix[1] * g + matrix[2] * b;
+    rgb[1] = matrix[3] * r + matrix[4] * g + matrix[5] * b;
+    rgb[2] = matrix[6] * r + matrix[7] * g + matrix[8] * b;
+}
+
+static int pixels_encodeChannel(double v, int max_value)
+{
+    return (int)SDL_floor(SDL_clamp(v, 0.0, 1.0) * max_value + 0.5);
+}
+
+static double pixels_ticksToMS(Uint64 ticks)
+{
+    return (double)ticks * 1000.0 / (double)SDL_GetPerformanceFrequency();
+}
+
+/* Blits a 1080p frame between the formats and logs how long it took */
+static void pixels_benchmarkConversion(const char *name, SDL_PixelFormatEnum src_format, SDL_Colorspace src_colorspace, SDL_PixelFormatEnum dst_format, SDL_Colorspace dst_colorspace)
+{
+    SDL_Surface *src = SDL_CreateSurface(1920, 1080, src_format);
+    SDL_Surface *dst = SDL_CreateSurface(1920, 1080, dst_format);
+    Uint64 start;
+
+    if (src && dst) {
+        SDL_memset(src->pixels, 0x5A, (size_t)src->h * src->pitch);
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        SDL_SetSurfaceColorspace(src, src_colorspace);
+        SDL_SetSurfaceColorspace(dst, dst_colorspace);
+        start = SDL_GetPerformanceCounter();
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        SDLTest_Log("Benchmark: %s 1920x1080 took %.2f ms", name, pixels_ticksToMS(SDL_GetPerformanceCounter() - start));
+    }
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+}
+
+/**
+ * Converts every HDR10 code value to sRGB and checks the result against a double precision reference
+ *
+ * \sa SDL_BlitSurface
+ * \sa SDL_SetSurfaceColorspace
+ */
+static int pixels_convertHDR10toSRGB(void *arg)
+{
+    static const double mat2020to709[] = {
+        1.660496, -0.587656, -0.072840,
+        -0.124547, 1.132895, -0.008348,
+        -0.018154, -0.100597, 1.118751
+    };
+    const double SDR_white_point = 203.0;
+    const int w = 1024, h = 4;
+    SDL_Surface *src, *dst;
+    int x, y, i, ret;
+    int max_error = 0;
+
+    src = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_XBGR2101010);
+    dst = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (!src || !dst) {
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceColorspace(src, SDL_COLORSPACE_HDR10);
+    SDL_SetSurfaceColorspace(dst, SDL_COLORSPACE_SRGB);
+
+    /* Each row walks all 1024 code values, with the channels offset from each other */
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (x = 0; x < w; ++x) {
+            Uint32 r = (Uint32)x;
+            Uint32 g = (Uint32)(x * (y + 1) + y * 311) & 0x3FF;
+            Uint32 b = (Uint32)(x * (2 * y + 3) + y * 517) & 0x3FF;
+            row[x] = (3u << 30) | (b << 20) | (g << 10) | r;
+        }
+    }
+
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertPass("Call to SDL_BlitSurface(HDR10 -> sRGB)");
+    SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+
+    for (y = 0; y < h; ++y) {
+        const Uint32 *srow = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+        const Uint32 *drow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+        for (x = 0; x < w; ++x) {
+            double rgb[3];
+            int actual[3];
+
+            rgb[0] = pixels_PQtoNits(((srow[x] >> 0) & 0x3FF) / 1023.0) / SDR_white_point;
+            rgb[1] = pixels_PQtoNits(((srow[x] >> 10) & 0x3FF) / 1023.0) / SDR_white_point;
+            rgb[2] = pixels_PQtoNits(((srow[x] >> 20) & 0x3FF) / 1023.0) / SDR_white_point;
+            pixels_convertPrimaries(mat2020to709, rgb);
+            actual[0] = (int)((drow[x] >> 16) & 0xFF);
+            actual[1] = (int)((drow[x] >> 8) & 0xFF);
+            actual[2] = (int)((drow[x] >> 0) & 0xFF);
+            for (i = 0; i < 3; ++i) {
+                int expected = pixels_encodeChannel(pixels_sRGBfromLinear(SDL_clamp(rgb[i], 0.0, 1.0)), 255);
+                max_error = SDL_max(max_error, SDL_abs(actual[i] - expected));
+            }
+        }
+    }
+    SDLTest_AssertCheck(max_error <= 1, "Verify maximum error, expected: <= 1, got: %d", max_error);
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+
+    pixels_benchmarkConversion("XBGR2101010 HDR10 -> ARGB8888 sRGB", SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_HDR10, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Converts every sRGB code value to HDR10 and checks the result against a double precision reference
+ *
+ * \sa SDL_BlitSurface
+ * \sa SDL_SetSurfaceColorspace
+ */
+static int pixels_convertSRGBtoHDR10(void *arg)
+{
+    static const double mat709to2020[] = {
+        0.627404, 0.329283, 0.043313,
+        0.069097, 0.919541, 0.011362,
+        0.016391, 0.088013, 0.895595,
+    };
+    const double SDR_white_point = 203.0;
+    const int w = 256, h = 4;
+    SDL_Surface *src, *dst;
+    int x, y, i, ret;
+    int max_error = 0;
+
+    src = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_XBGR2101010);
+    SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (!src || !dst) {
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceColorspace(src, SDL_COLORSPACE_SRGB);
+    SDL_SetSurfaceColorspace(dst, SDL_COLORSPACE_HDR10);
+
+    for (y = 0; y < h; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)src->pixels + y * src->pitch);
+        for (x = 0; x < w; ++x) {
+            Uint32 r = (Uint32)x;
+            Uint32 g = (Uint32)(x * (y + 1) + y * 77) & 0xFF;
+            Uint32 b = (Uint32)(x * (2 * y + 3) + y * 131) & 0xFF;
+            row[x] = 0xFF000000 | (r << 16) | (g << 8) | b;
+        }
+    }
+
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertPass("Call to SDL_BlitSurface(sRGB -> HDR10)");
+    SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+
+    for (y = 0; y < h; ++y) {
+        const Uint32 *srow = (const Uint32 *)((const Uint8 *)src->pixels + y * src->pitch);
+        const Uint32 *drow = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+        for (x = 0; x < w; ++x) {
+            double rgb[3];
+            int actual[3];
+
+            rgb[0] = pixels_sRGBtoLinear(((srow[x] >> 16) & 0xFF) / 255.0);
+            rgb[1] = pixels_sRGBtoLinear(((srow[x] >> 8) & 0xFF) / 255.0);
+            rgb[2] = pixels_sRGBtoLinear(((srow[x] >> 0) & 0xFF) / 255.0);
+            pixels_convertPrimaries(mat709to2020, rgb);
+            actual[0] = (int)((drow[x] >> 0) & 0x3FF);
+            actual[1] = (int)((drow[x] >> 10) & 0x3FF);
+            actual[2] = (int)((drow[x] >> 20) & 0x3FF);
+            for (i = 0; i < 3; ++i) {
+                int expected = pixels_encodeChannel(pixels_PQfromNits(rgb[i] * SDR_white_point), 1023);
+                max_error = SDL_max(max_error, SDL_abs(actual[i] - expected));
+            }
+        }
+    }
+    SDLTest_AssertCheck(max_error <= 1, "Verify maximum error, expected: <= 1, got: %d", max_error);
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+
+    pixels_benchmarkConversion("ARGB8888 sRGB -> XBGR2101010 HDR10", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_HDR10);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * Converts every sRGB code value to linear float and checks the result against a double precision reference
+ *
+ * \sa SDL_BlitSurface
+ * \sa SDL_SetSurfaceColorspace
+ */
+static int pixels_convertSRGBtoLinear(void *arg)
+{
+    const int w = 256, h = 1;
+    SDL_Surface *src, *dst;
+    const Uint32 *srow;
+    const float *drow;
+    int x, ret;
+    double max_error = 0.0;
+
+    src = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateSurface(w, h, SDL_PIXELFORMAT_RGBA128_FLOAT);
+    SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+    if (!src || !dst) {
+        SDL_DestroySurface(src);
+        SDL_DestroySurface(dst);
+        return TEST_ABORTED;
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+    SDL_SetSurfaceColorspace(src, SDL_COLORSPACE_SRGB);
+    SDL_SetSurfaceColorspace(dst, SDL_COLORSPACE_SRGB_LINEAR);
+
+    srow = (const Uint32 *)src->pixels;
+    for (x = 0; x < w; ++x) {
+        Uint32 v = (Uint32)x;
+        ((Uint32 *)src->pixels)[x] = (v << 24) | (v << 16) | ((255 - v) << 8) | ((v * 7) & 0xFF);
+    }
+
+    ret = SDL_BlitSurface(src, NULL, dst, NULL);
+    SDLTest_AssertPass("Call to SDL_BlitSurface(sRGB -> linear)");
+    SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+
+    drow = (const float *)dst->pixels;
+    for (x = 0; x < w; ++x) {
+        const float *pixel = &drow[x * 4];
+        double expected[4];
+        int i;
+
+        expected[0] = pixels_sRGBtoLinear(((srow[x] >> 16) & 0xFF) / 255.0);
+        expected[1] = pixels_sRGBtoLinear(((srow[x] >> 8) & 0xFF) / 255.0);
+        expected[2] = pixels_sRGBtoLinear(((srow[x] >> 0) & 0xFF) / 255.0);
+        expected[3] = ((srow[x] >> 24) & 0xFF) / 255.0;
+        for (i = 0; i < 4; ++i) {
+            max_error = SDL_max(max_error, SDL_fabs(pixel[i] - expected[i]));
+        }
+    }
+    SDLTest_AssertCheck(max_error <= 1e-5, "Verify maximum error, expected: <= 1e-5, got: %g", max_error);
+
+    SDL_DestroySurface(src);
+    SDL_DestroySurface(dst);
+
+    pixels_benchmarkConversion("ARGB8888 sRGB -> RGBA128_FLOAT linear", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_RGBA128_FLOAT, SDL_COLORSPACE_SRGB_LINEAR);
+
+    return TEST_COMPLETED;
+}
+
+/* Brute force nearest palette entry, matching the documented SDL_MapRGBA() behavior */
+static Uint32 pixels_findNearestColor(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    unsigned int smallest = ~0U;
+    Uint32 pixel = 0;
+    int i;
+
+    for (i = 0; i < palette->ncolors; ++i) {
+        const int rd = palette->colors[i].r - r;
+        const int gd = palette->colors[i].g - g;
+        const int bd = palette->colors[i].b - b;
+        const int ad = palette->colors[i].a - a;
+        const unsigned int distance = (unsigned int)(rd * rd + gd * gd + bd * bd + ad * ad);
+        if (distance < smallest) {
+            pixel = (Uint32)i;
+            smallest = distance;
+        }
+    }
+    return pixel;
+}
+
+static int pixels_checkMapRGBA(const SDL_PixelFormat *format, int count, Uint64 *mapped_ticks, Uint64 *reference_ticks)
+{
+    Uint32 *colors = (Uint32 *)SDL_malloc(count * sizeof(*colors));
+    Uint32 *pixels = (Uint32 *)SDL_malloc(count * sizeof(*pixels));
+    Uint64 start;
+    int i, mismatches = 0;
+
+    if (!colors || !pixels) {
+        SDL_free(colors);
+        SDL_free(pixels);
+        return -1;
+    }
+
+    /* Random colors, half of them opaque, plus every palette entry */
+    for (i = 0; i < count; ++i) {
+        if (i < format->palette->ncolors) {
+            const SDL_Color *color = &format->palette->colors[i];
+            colors[i] = ((Uint32)color->r << 24) | ((Uint32)color->g << 16) | ((Uint32)color->b << 8) | color->a;
+        } else {
+            colors[i] = (Uint32)SDLTest_RandomUint32() | ((i & 1) ? 0xFF : 0x00);
+        }
+    }
+
+    /* The first pass fills in the palette lookup, the second is timed and should give the same results */
+    for (i = 0; i < count; ++i) {
+        pixels[i] = SDL_MapRGBA(format, (Uint8)(colors[i] >> 24), (Uint8)(colors[i] >> 16), (Uint8)(colors[i] >> 8), (Uint8)colors[i]);
+    }
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < count; ++i) {
+        if (SDL_MapRGBA(format, (Uint8)(colors[i] >> 24), (Uint8)(colors[i] >> 16), (Uint8)(colors[i] >> 8), (Uint8)colors[i]) != pixels[i]) {
+            ++mismatches;
+        }
+    }
+    *mapped_ticks += SDL_GetPerformanceCounter() - start;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < count; ++i) {
+        const Uint32 expected = pixels_findNearestColor(format->palette, (Uint8)(colors[i] >> 24), (Uint8)(colors[i] >> 16), (Uint8)(colors[i] >> 8), (Uint8)colors[i]);
+        if (pixels[i] != expected) {
+            if (mismatches++ == 0) {
+                SDLTest_LogError("SDL_MapRGBA(0x%.8" SDL_PRIx32 ") returned %" SDL_PRIu32 ", expected %" SDL_PRIu32, colors[i], pixels[i], expected);
+            }
+        }
+    }
+    *reference_ticks += SDL_GetPerformanceCounter() - start;
+
+    SDL_free(colors);
+    SDL_free(pixels);
+    return mismatches;
+}
+
+/**
+ * Call to SDL_MapRGBA on paletted formats, checked against a search of the whole palette
+ *
+ * \sa SDL_MapRGBA
+ * \sa SDL_SetPaletteColors
+ */
+static int pixels_mapRGBAPalette(void *arg)
+{
+    const int count = 100000;
+    SDL_PixelFormat *format;
+    SDL_Palette *palette;
+    SDL_Color colors[256];
+    Uint64 mapped_ticks = 0, reference_ticks = 0;
+    int i, pass, mismatches;
+
+    format = SDL_CreatePixelFormat(SDL_PIXELFORMAT_INDEX8);
+    palette = SDL_CreatePalette(256);
+    SDLTest_AssertCheck(format != NULL && palette != NULL, "Verify format and palette are not NULL");
+    if (!format || !palette) {
+        SDL_DestroyPixelFormat(format);
+        SDL_DestroyPalette(palette);
+        return TEST_ABORTED;
+    }
+    SDL_SetPixelFormatPalette(format, palette);
+
+    for (pass = 0; pass < 4; ++pass) {
+        const int ncolors = (pass == 3) ? 16 : 256;
+
+        for (i = 0; i < ncolors; ++i) {
+            switch (pass) {
+            case 0:
+                /* Random opaque colors, with a few duplicates */
+                colors[i].r = (Uint8)SDLTest_RandomUint8();
+                colors[i].g = (Uint8)SDLTest_RandomUint8();
+                colors[i].b = (Uint8)SDLTest_RandomUint8();
+                colors[i].a = SDL_ALPHA_OPAQUE;
+                if (i >= 8 && (i % 8) == 0) {
+                    colors[i] = colors[i - 8];
+                }
+                break;
+            case 1:
+                /* Random colors with alpha */
+                colors[i].r = (Uint8)SDLTest_RandomUint8();
+                colors[i].g = (Uint8)SDLTest_RandomUint8();
+                colors[i].b = (Uint8)SDLTest_RandomUint8();
+                colors[i].a = (Uint8)SDLTest_RandomUint8();
+                break;
+            case 2:
+                /* A gray ramp, so many entries are about as near as each other */
+                colors[i].r = colors[i].g = colors[i].b = (Uint8)i;
+                colors[i].a = SDL_ALPHA_OPAQUE;
+                break;
+            default:
+                /* A small palette */
+                colors[i].r = (Uint8)(i * 17);
+                colors[i].g = (Uint8)(255 - i * 17);
+                colors[i].b = (Uint8)SDLTest_RandomUint8();
+                colors[i].a = SDL_ALPHA_OPAQUE;
+                break;
+            }
+        }
+        if (ncolors != palette->ncolors) {
+            SDL_DestroyPalette(palette);
+            palette = SDL_CreatePalette(ncolors);
+            SDLTest_AssertCheck(palette != NULL, "Verify palette is not NULL");
+            if (!palette) {
+                break;
+            }
+            SDL_SetPixelFormatPalette(format, palette);
+        }
+        SDL_SetPaletteColors(palette, colors, 0, ncolors);
+        SDLTest_AssertPass("Call to SDL_SetPaletteColors(palette, colors, 0, %d)", ncolors);
+
+        mismatches = pixels_checkMapRGBA(format, count, &mapped_ticks, &reference_ticks);
+        SDLTest_AssertCheck(mismatches == 0, "Verify SDL_MapRGBA() found the nearest colors, expected: 0 mismatches, got: %d", mismatches);
+    }
+
+    SDLTest_Log("Benchmark: SDL_MapRGBA() on INDEX8 took %.1f ns per call, a search of the whole palette %.1f ns",
+                pixels_ticksToMS(mapped_ticks) * 1e6 / (4 * count), pixels_ticksToMS(reference_ticks) * 1e6 / (4 * count));
+
+    SDL_DestroyPixelFormat(format);
+    SDL_DestroyPalette(palette);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -382,9 +834,25 @@ static const SDLTest_TestCaseReference pixelsTest3 = {
     (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference pixelsTest4 = {
+    (SDLTest_TestCaseFp)pixels_convertHDR10toSRGB, "pixels_convertHDR10toSRGB", "Check HDR10 to sRGB blits against a reference conversion", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference pixelsTest5 = {
+    (SDLTest_TestCaseFp)pixels_convertSRGBtoHDR10, "pixels_convertSRGBtoHDR10", "Check sRGB to HDR10 blits against a reference conversion", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference pixelsTest6 = {
+    (SDLTest_TestCaseFp)pixels_convertSRGBtoLinear, "pixels_convertSRGBtoLinear", "Check sRGB to linear float blits against a reference conversion", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference pixelsTest7 = {
+    (SDLTest_TestCaseFp)pixels_mapRGBAPalette, "pixels_mapRGBAPalette", "Check SDL_MapRGBA on paletted formats against a search of the whole palette", TEST_ENABLED
+};
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] = {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6, &pixelsTest7, NULL
 };
 
 /* Pixels test suite (global) */
@@ -382,6 +382,100 @@ static int properties_testLocking(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * Test property key functionality
+ */
+static int properties_testKeys(void *arg)
+{
+    SDL_PropertiesID props;
+    SDL_PropertyKey key, key2, missing_key;
+    const char *string;
+    Sint64 num;
+    float fnum;
+    SDL_bool boolean;
+    void *data;
+    int result, count;
+    Uint64 start, by_name, by_key;
+    int i;
+    const int iterations = 100000;
+
+    props = SDL_CreateProperties();
+
+    SDLTest_AssertPass("Call to SDL_GetPropertyKey()");
+    key = SDL_GetPropertyKey("foo");
+    SDLTest_AssertCheck(key != 0, "Verify key is valid, got %" SDL_PRIu32, key);
+    key2 = SDL_GetPropertyKey("foo");
+    SDLTest_AssertCheck(key2 == key,
+        "Verify the same name gives the same key, got %" SDL_PRIu32 ", expected %" SDL_PRIu32, key2, key);
+    missing_key = SDL_GetPropertyKey("bar");
+    SDLTest_AssertCheck(missing_key != 0 && missing_key != key,
+        "Verify a different name gives a different key, got %" SDL_PRIu32, missing_key);
+    key2 = SDL_GetPropertyKey("");
+    SDLTest_AssertCheck(key2 == 0, "Verify empty name is rejected, got %" SDL_PRIu32, key2);
+
+    SDLTest_AssertPass("Call to SDL_SetNumberPropertyByKey()");
+    SDL_SetNumberPropertyByKey(props, key, 42);
+    num = SDL_GetNumberPropertyByKey(props, key, 0);
+    SDLTest_AssertCheck(num == 42,
+        "Verify number property, got %" SDL_PRIs64 ", expected 42", num);
+    num = SDL_GetNumberProperty(props, "foo", 0);
+    SDLTest_AssertCheck(num == 42,
+        "Verify number property by name, got %" SDL_PRIs64 ", expected 42", num);
+    num = SDL_GetNumberPropertyByKey(props, missing_key, 7);
+    SDLTest_AssertCheck(num == 7,
+        "Verify missing property returns the default, got %" SDL_PRIs64 ", expected 7", num);
+    count = 0;
+    SDL_EnumerateProperties(props, count_foo_properties, &count);
+    SDLTest_AssertCheck(count == 1,
+        "Verify enumerated name is \"foo\", got %d matches, expected 1", count);
+
+    SDLTest_AssertPass("Call to SDL_SetStringProperty() and SDL_GetStringPropertyByKey()");
+    SDL_SetStringProperty(props, "foo", "abcd");
+    string = SDL_GetStringPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(string && SDL_strcmp(string, "abcd") == 0,
+        "Verify string property, got %s, expected abcd", string ? string : "NULL");
+
+    SDL_SetFloatPropertyByKey(props, key, 1.5f);
+    fnum = SDL_GetFloatPropertyByKey(props, key, 0.0f);
+    SDLTest_AssertCheck(fnum == 1.5f, "Verify float property, got %f, expected 1.5", fnum);
+
+    SDL_SetBooleanPropertyByKey(props, key, SDL_TRUE);
+    boolean = SDL_GetBooleanPropertyByKey(props, key, SDL_FALSE);
+    SDLTest_AssertCheck(boolean == SDL_TRUE, "Verify boolean property, got %d, expected 1", boolean);
+
+    SDL_SetPropertyByKey(props, key, &props);
+    data = SDL_GetPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(data == &props, "Verify pointer property, got %p, expected %p", data, (void *)&props);
+
+    SDLTest_AssertPass("Call to SDL_SetPropertyByKey(NULL)");
+    SDL_SetPropertyByKey(props, key, NULL);
+    SDLTest_AssertCheck(!SDL_HasProperty(props, "foo"), "Verify property was cleared");
+
+    result = SDL_SetNumberPropertyByKey(props, 0, 1);
+    SDLTest_AssertCheck(result == -1, "Verify invalid key is rejected, got %d, expected -1", result);
+    result = SDL_SetNumberPropertyByKey(0, key, 1);
+    SDLTest_AssertCheck(result == -1, "Verify invalid properties are rejected, got %d, expected -1", result);
+
+    SDL_SetNumberPropertyByKey(props, key, 1);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        num += SDL_GetNumberProperty(props, "foo", 0);
+    }
+    by_name = SDL_GetPerformanceCounter() - start;
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        num += SDL_GetNumberPropertyByKey(props, key, 0);
+    }
+    by_key = SDL_GetPerformanceCounter() - start;
+    SDLTest_Log("SDL_GetNumberProperty: %.1f ns, SDL_GetNumberPropertyByKey: %.1f ns",
+                (double)by_name * 1e9 / SDL_GetPerformanceFrequency() / iterations,
+                (double)by_key * 1e9 / SDL_GetPerformanceFrequency() / iterations);
+
+    SDL_DestroyProperties(props);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Properties test cases */
@@ -401,12 +495,17 @@ static const SDLTest_TestCaseReference propertiesTestLocking = {
     (SDLTest_TestCaseFp)properties_testLocking, "properties_testLocking", "Test property locking functionality", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference propertiesTestKeys = {
+    (SDLTest_TestCaseFp)properties_testKeys, "properties_testKeys", "Test property key functionality", TEST_ENABLED
+};
+
 /* Sequence of Properties test cases */
 static const SDLTest_TestCaseReference *propertiesTests[] = {
     &propertiesTestBasic,
     &propertiesTestCopy,
     &propertiesTestCleanup,
     &propertiesTestLocking,
+    &propertiesTestKeys,
     NULL
 };
 
@@ -0,0 +1,485 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Check the SSE2 and AVX2 alpha blitters that this CPU supports against a
+   per-pixel reference of the math they implement, then report their
+   throughput next to the MMX and scalar blitters on 1080p surfaces.
+*/
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+/* Hack #4: SDL_expand_byte isn't exported, and none of the blitters tested here use it */
+#define SDL_expand_byte testblitalpha_expand_byte
+
+#include "../src/video/SDL_blit_A.c"
+
+Uint8 *testblitalpha_expand_byte[9];
+
+#define TEST_W 41
+#define TEST_H 7
+#define TEST_PADDING 12
+
+#define BENCH_W 1920
+#define BENCH_H 1080
+
+#ifdef SDL_MMX_INTRINSICS
+#define MMX_FUNC(name) name##MMX
+#else
+#define MMX_FUNC(name) NULL
+#endif
+#ifdef SDL_SSE2_INTRINSICS
+#define SSE2_FUNC(name) name##SSE2
+#else
+#define SSE2_FUNC(name) NULL
+#endif
+#ifdef SDL_AVX2_INTRINSICS
+#define AVX2_FUNC(name) name##AVX2
+#else
+#define AVX2_FUNC(name) NULL
+#endif
+
+typedef Uint32 (*ReferenceFunc)(Uint32 s, Uint32 d, Uint8 alpha, const SDL_PixelFormat *sf, const SDL_PixelFormat *df);
+
+typedef struct
+{
+    SDL_PixelFormatEnum src_format;
+    SDL_PixelFormatEnum dst_format;
+    SDL_bool surface_alpha;
+    ReferenceFunc reference;
+    SDL_BlitFunc scalar;
+    SDL_BlitFunc mmx;
+    SDL_BlitFunc sse2;
+    SDL_BlitFunc avx2;
+} BlitCase;
+
+typedef struct
+{
+    int w, h;
+    int pitch;
+    int bpp;
+    Uint8 *pixels;
+} Buffer;
+
+static int iterations = 20;
+
+/* The blend used by the 8888 pixel alpha blitters, with the alpha channel weighted by 256 */
+static Uint32 RefPixelAlpha8888(Uint32 s, Uint32 d, Uint8 alpha, const SDL_PixelFormat *sf, const SDL_PixelFormat *df)
+{
+    const Uint32 a = (s >> sf->Ashift) & 0xFF;
+    Uint32 result = 0;
+    int shift;
+
+    (void)alpha;
+    (void)df;
+
+    if (a == 0xFF) {
+        return s;
+    } else if (a == 0) {
+        return d;
+    }
+    for (shift = 0; shift < 32; shift += 8) {
+        const Uint32 sc = (s >> shift) & 0xFF;
+        const Uint32 dc = (d >> shift) & 0xFF;
+        Uint32 c;
+
+        if (shift == sf->Ashift) {
+            c = SDL_min(sc + (dc * (0xFF - a) >> 8), 0xFF);
+        } else {
+            c = (sc * a >> 8) + (dc * (0xFF - a) >> 8);
+        }
+        result |= c << shift;
+    }
+    return result;
+}
+
+static Uint32 RefPixelAlphaSwapRB(Uint32 s, Uint32 d, Uint8 alpha, const SDL_PixelFormat *sf, const SDL_PixelFormat *df)
+{
+    s = (s & 0xFF00FF00) | ((s >> 16) & 0xFF) | ((s & 0xFF) << 16);
+    return RefPixelAlpha8888(s, d, alpha, sf, df);
+}
+
+/* d + ((s - d) * alpha >> 8) per color channel, wrapping to 8 bits */
+static Uint32 RefSurfaceAlpha8888(Uint32 s, Uint32 d, Uint8 alpha, const SDL_PixelFormat *sf, const SDL_PixelFormat *df)
+{
+    const Uint32 chanmask = sf->Rmask | sf->Gmask | sf->Bmask;
+    Uint32 result = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        const int sc = (s >> shift) & 0xFF;
+        const int dc = (d >> shift) & 0xFF;
+        Uint32 c = (Uint32)dc;
+
+        if (chanmask & (0xFFu << shift)) {
+            c = (Uint8)(dc + (Uint8)((Uint16)((sc - dc) * alpha) >> 8));
+        }
+        result |= c << shift;
+    }
+    return result | df->Amask;
+}
+
+static int BlendChannel16(int s, int d, int alpha)
+{
+    const int delta = (s - d) * alpha;
+
+    /* Round towards negative infinity, like an arithmetic shift */
+    return d + (delta >= 0 ? delta / 32 : -((31 - delta) / 32));
+}
+
+/* d + floor((s - d) * alpha / 32) per channel of a 565 or 555 pixel */
+static Uint32 Blend16(Uint32 s, Uint32 d, int alpha, int rshift, Uint32 gmask)
+{
+    const int r = BlendChannel16(s >> rshift & 0x1F, d >> rshift & 0x1F, alpha);
+    const int g = BlendChannel16(s >> 5 & gmask, d >> 5 & gmask, alpha);
+    const int b = BlendChannel16(s & 0x1F, d & 0x1F, alpha);
+
+    return ((Uint32)r << rshift) | ((Uint32)g << 5) | (Uint32)b;
+}
+
+static Uint32 RefSurfaceAlpha16(Uint32 s, Uint32 d, Uint8 alpha, const SDL_PixelFormat *sf, const SDL_PixelFormat *df)
+{
+    (void)sf;
+
+    return Blend16(s, d, alpha >> 3, df->Gmask == 0x7E0 ? 11 : 10, df->Gmask >> 5);
+}
+
+static Uint32 RefPixelAlpha8888to16(Uint32 s, Uint32 d, Uint8 alpha, const SDL_PixelFormat *sf, const SDL_PixelFormat *df)
+{
+    const int rshift = df->Gmask == 0x7E0 ? 11 : 10;
+    const Uint32 gmask = df->Gmask >> 5;
+    const int a = s >> 27;
+    const Uint32 src = ((s >> 19 & 0x1F) << rshift) | ((s >> (gmask == 0x3F ? 10 : 11) & gmask) << 5) | (s >> 3 & 0x1F);
+
+    (void)alpha;
+    (void)sf;
+
+    if (a == (SDL_ALPHA_OPAQUE >> 3)) {
+        return src;
+    } else if (a == 0) {
+        return d;
+    }
+    return Blend16(src, d, a, rshift, gmask);
+}
+
+static const BlitCase cases[] = {
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, RefPixelAlpha8888, BlitRGBtoRGBPixelAlpha, MMX_FUNC(BlitRGBtoRGBPixelAlpha), SSE2_FUNC(BlitRGBtoRGBPixelAlpha), AVX2_FUNC(BlitRGBtoRGBPixelAlpha) },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, SDL_FALSE, RefPixelAlpha8888, BlitRGBtoRGBPixelAlpha, MMX_FUNC(BlitRGBtoRGBPixelAlpha), SSE2_FUNC(BlitRGBtoRGBPixelAlpha), AVX2_FUNC(BlitRGBtoRGBPixelAlpha) },
+    { SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_RGBA8888, SDL_FALSE, RefPixelAlpha8888, NULL, MMX_FUNC(BlitRGBtoRGBPixelAlpha), SSE2_FUNC(BlitRGBtoRGBPixelAlpha), AVX2_FUNC(BlitRGBtoRGBPixelAlpha) },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_FALSE, RefPixelAlphaSwapRB, BlitRGBtoBGRPixelAlpha, NULL, SSE2_FUNC(BlitRGBtoBGRPixelAlpha), AVX2_FUNC(BlitRGBtoBGRPixelAlpha) },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XRGB8888, SDL_FALSE, RefPixelAlphaSwapRB, BlitRGBtoBGRPixelAlpha, NULL, SSE2_FUNC(BlitRGBtoBGRPixelAlpha), AVX2_FUNC(BlitRGBtoBGRPixelAlpha) },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_FALSE, RefPixelAlpha8888to16, BlitARGBto565PixelAlpha, NULL, SSE2_FUNC(BlitARGBto565PixelAlpha), AVX2_FUNC(BlitARGBto565PixelAlpha) },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGR565, SDL_FALSE, RefPixelAlpha8888to16, BlitARGBto565PixelAlpha, NULL, SSE2_FUNC(BlitARGBto565PixelAlpha), AVX2_FUNC(BlitARGBto565PixelAlpha) },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB1555, SDL_FALSE, RefPixelAlpha8888to16, BlitARGBto555PixelAlpha, NULL, SSE2_FUNC(BlitARGBto555PixelAlpha), AVX2_FUNC(BlitARGBto555PixelAlpha) },
+    { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR1555, SDL_FALSE, RefPixelAlpha8888to16, BlitARGBto555PixelAlpha, NULL, SSE2_FUNC(BlitARGBto555PixelAlpha), AVX2_FUNC(BlitARGBto555PixelAlpha) },
+    { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_TRUE, RefSurfaceAlpha16, Blit565to565SurfaceAlpha, MMX_FUNC(Blit565to565SurfaceAlpha), SSE2_FUNC(Blit565to565SurfaceAlpha), AVX2_FUNC(Blit565to565SurfaceAlpha) },
+    { SDL_PIXELFORMAT_XRGB1555, SDL_PIXELFORMAT_XRGB1555, SDL_TRUE, RefSurfaceAlpha16, Blit555to555SurfaceAlpha, MMX_FUNC(Blit555to555SurfaceAlpha), SSE2_FUNC(Blit555to555SurfaceAlpha), AVX2_FUNC(Blit555to555SurfaceAlpha) },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_TRUE, RefSurfaceAlpha8888, BlitRGBtoRGBSurfaceAlpha, MMX_FUNC(BlitRGBtoRGBSurfaceAlpha), SSE2_FUNC(BlitRGBtoRGBSurfaceAlpha), AVX2_FUNC(BlitRGBtoRGBSurfaceAlpha) },
+    { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_TRUE, RefSurfaceAlpha8888, BlitRGBtoRGBSurfaceAlpha, MMX_FUNC(BlitRGBtoRGBSurfaceAlpha), SSE2_FUNC(BlitRGBtoRGBSurfaceAlpha), AVX2_FUNC(BlitRGBtoRGBSurfaceAlpha) },
+    { SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_RGBX8888, SDL_TRUE, RefSurfaceAlpha8888, NULL, MMX_FUNC(BlitRGBtoRGBSurfaceAlpha), SSE2_FUNC(BlitRGBtoRGBSurfaceAlpha), AVX2_FUNC(BlitRGBtoRGBSurfaceAlpha) },
+};
+
+static const char *FormatName(SDL_PixelFormatEnum format)
+{
+    return SDL_GetPixelFormatName(format) + SDL_strlen("SDL_PIXELFORMAT_");
+}
+
+static int CreateBuffer(Buffer *buffer, int w, int h, int bpp, int padding)
+{
+    buffer->w = w;
+    buffer->h = h;
+    buffer->bpp = bpp;
+    buffer->pitch = w * bpp + padding;
+    buffer->pixels = (Uint8 *)SDL_malloc((size_t)buffer->pitch * h);
+    if (!buffer->pixels) {
+        return -1;
+    }
+    return 0;
+}
+
+static Uint32 GetPixel(const Buffer *buffer, int x, int y)
+{
+    const Uint8 *p = buffer->pixels + y * buffer->pitch + x * buffer->bpp;
+
+    if (buffer->bpp == 2) {
+        return *(const Uint16 *)p;
+    }
+    return *(const Uint32 *)p;
+}
+
+static void SetPixel(Buffer *buffer, int x, int y, Uint32 pixel)
+{
+    Uint8 *p = buffer->pixels + y * buffer->pitch + x * buffer->bpp;
+
+    if (buffer->bpp == 2) {
+        *(Uint16 *)p = (Uint16)pixel;
+    } else {
+        *(Uint32 *)p = pixel;
+    }
+}
+
+/* Random pixels, with the alpha values at the edges of the special cases mixed in */
+static void FillBuffer(Buffer *buffer, const SDL_PixelFormat *format)
+{
+    static const Uint8 special[] = { 0x00, 0x01, 0x07, 0x08, 0x80, 0xF7, 0xF8, 0xFE, 0xFF };
+    int i;
+
+    for (i = 0; i < buffer->pitch * buffer->h; ++i) {
+        buffer->pixels[i] = (Uint8)SDL_rand(256);
+    }
+    if (format->Amask) {
+        int x, y;
+
+        for (y = 0; y < buffer->h; ++y) {
+            for (x = 0; x < buffer->w; ++x) {
+                const Sint32 choice = SDL_rand(2 * SDL_arraysize(special));
+                if (choice < (Sint32)SDL_arraysize(special)) {
+                    const Uint32 pixel = GetPixel(buffer, x, y) & ~format->Amask;
+                    SetPixel(buffer, x, y, pixel | ((Uint32)special[choice] << format->Ashift));
+                }
+            }
+        }
+    }
+}
+
+static void Blit(SDL_BlitFunc func, const Buffer *src, Buffer *dst, SDL_PixelFormat *sf, SDL_PixelFormat *df, Uint8 alpha)
+{
+    SDL_BlitInfo info;
+
+    SDL_zero(info);
+    info.src = src->pixels;
+    info.src_w = dst->w;
+    info.src_h = dst->h;
+    info.src_pitch = src->pitch;
+    info.src_skip = src->pitch - dst->w * src->bpp;
+    info.dst = dst->pixels;
+    info.dst_w = dst->w;
+    info.dst_h = dst->h;
+    info.dst_pitch = dst->pitch;
+    info.dst_skip = dst->pitch - dst->w * dst->bpp;
+    info.src_fmt = sf;
+    info.dst_fmt = df;
+    info.a = alpha;
+    func(&info);
+}
+
+static int CheckFunc(const BlitCase *test, SDL_BlitFunc func, const char *isa, SDL_PixelFormat *sf, SDL_PixelFormat *df)
+{
+    static const Uint8 alphas[] = { 0x00, 0x01, 0x07, 0x08, 0x7F, 0x80, 0x81, 0xFE, 0xFF };
+    Buffer src, dst, actual;
+    int errors = 0;
+    int i, w;
+
+    if (CreateBuffer(&src, TEST_W, TEST_H, sf->bytes_per_pixel, TEST_PADDING) < 0 ||
+        CreateBuffer(&dst, TEST_W, TEST_H, df->bytes_per_pixel, TEST_PADDING) < 0 ||
+        CreateBuffer(&actual, TEST_W, TEST_H, df->bytes_per_pixel, TEST_PADDING) < 0) {
+        return -1;
+    }
+    FillBuffer(&src, sf);
+    FillBuffer(&dst, df);
+
+    /* Every width up to the buffer size, to cover the partial vectors at the end of each row */
+    for (w = 1; w <= TEST_W; ++w) {
+        for (i = 0; i < (test->surface_alpha ? (int)SDL_arraysize(alphas) : 1); ++i) {
+            const Uint8 alpha = alphas[i];
+            int x, y;
+
+            SDL_memcpy(actual.pixels, dst.pixels, (size_t)dst.pitch * dst.h);
+            actual.w = w;
+            Blit(func, &src, &actual, sf, df, alpha);
+            actual.w = TEST_W;
+
+            for (y = 0; y < TEST_H; ++y) {
+                for (x = 0; x < TEST_W; ++x) {
+                    const Uint32 s = GetPixel(&src, x, y);
+                    const Uint32 d = GetPixel(&dst, x, y);
+                    const Uint32 expected = (x < w) ? test->reference(s, d, alpha, sf, df) : d;
+                    const Uint32 result = GetPixel(&actual, x, y);
+
+                    if (result != expected) {
+                        if (errors++ < 10) {
+                            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s %s -> %s: width %d alpha %d pixel %d,%d 0x%.8" SDL_PRIx32 " over 0x%.8" SDL_PRIx32 " gave 0x%.8" SDL_PRIx32 ", expected 0x%.8" SDL_PRIx32 "\n",
+                                         isa, FormatName(test->src_format), FormatName(test->dst_format), w, alpha, x, y, s, d, result, expected);
+                        }
+                    }
+                }
+            }
+            /* The padding at the end of each row should be left alone */
+            for (y = 0; y < TEST_H; ++y) {
+                const size_t row = (size_t)TEST_W * dst.bpp;
+                if (SDL_memcmp(actual.pixels + y * dst.pitch + row, dst.pixels + y * dst.pitch + row, dst.pitch - row) != 0) {
+                    if (errors++ < 10) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s %s -> %s: width %d wrote past the end of row %d\n",
+                                     isa, FormatName(test->src_format), FormatName(test->dst_format), w, y);
+                    }
+                }
+            }
+        }
+    }
+
+    SDL_free(src.pixels);
+    SDL_free(dst.pixels);
+    SDL_free(actual.pixels);
+
+    return errors ? -1 : 0;
+}
+
+static double Benchmark(SDL_BlitFunc func, const Buffer *src, Buffer *dst, SDL_PixelFormat *sf, SDL_PixelFormat *df)
+{
+    Uint64 start, elapsed;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        Blit(func, src, dst, sf, df, 0xA0);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    return (double)dst->w * dst->h * iterations * SDL_GetPerformanceFrequency() / (double)elapsed / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    SDL_bool benchmark = SDL_TRUE;
+    SDL_bool has_sse2 = SDL_HasSSE2();
+    SDL_bool has_avx2 = SDL_HasAVX2();
+    int errors = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    iterations = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && iterations > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--no-benchmark") == 0) {
+                benchmark = SDL_FALSE;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--iterations NB]",
+                "[--no-benchmark]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (!has_sse2) {
+        SDL_Log("SSE2 not supported by this CPU, skipped");
+    }
+    if (!has_avx2) {
+        SDL_Log("AVX2 not supported by this CPU, skipped");
+    }
+
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        const BlitCase *test = &cases[i];
+        SDL_PixelFormat *sf = SDL_CreatePixelFormat(test->src_format);
+        SDL_PixelFormat *df = SDL_CreatePixelFormat(test->dst_format);
+
+        if (!sf || !df) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create pixel formats: %s\n", SDL_GetError());
+            return 1;
+        }
+
+        if (test->sse2 && has_sse2 && CheckFunc(test, test->sse2, "SSE2", sf, df) < 0) {
+            ++errors;
+        }
+        if (test->avx2 && has_avx2 && CheckFunc(test, test->avx2, "AVX2", sf, df) < 0) {
+            ++errors;
+        }
+
+        if (benchmark) {
+            Buffer src, dst;
+            char rates[128];
+            size_t len = 0;
+
+            if (CreateBuffer(&src, BENCH_W, BENCH_H, sf->bytes_per_pixel, 0) < 0 ||
+                CreateBuffer(&dst, BENCH_W, BENCH_H, df->bytes_per_pixel, 0) < 0) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+                return 1;
+            }
+            FillBuffer(&src, sf);
+            FillBuffer(&dst, df);
+
+            rates[0] = '\0';
+            if (test->scalar) {
+                len += SDL_snprintf(rates + len, sizeof(rates) - len, " scalar %7.1f", Benchmark(test->scalar, &src, &dst, sf, df));
+            }
+            if (test->mmx && SDL_HasMMX()) {
+                len += SDL_snprintf(rates + len, sizeof(rates) - len, " MMX %7.1f", Benchmark(test->mmx, &src, &dst, sf, df));
+            }
+            if (test->sse2 && has_sse2) {
+                len += SDL_snprintf(rates + len, sizeof(rates) - len, " SSE2 %7.1f", Benchmark(test->sse2, &src, &dst, sf, df));
+            }
+            if (test->avx2 && has_avx2) {
+                len += SDL_snprintf(rates + len, sizeof(rates) - len, " AVX2 %7.1f", Benchmark(test->avx2, &src, &dst, sf, df));
+            }
+            SDL_Log("%-8s -> %-8s %s:%s Mpixels/sec", FormatName(test->src_format), FormatName(test->dst_format),
+                    test->surface_alpha ? "surface alpha" : "pixel alpha  ", rates);
+
+            SDL_free(src.pixels);
+            SDL_free(dst.pixels);
+        }
+
+        SDL_DestroyPixelFormat(sf);
+        SDL_DestroyPixelFormat(df);
+    }
+
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,370 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Check each of the generated SIMD blitters that this CPU supports against
+   the scalar one it replaces, for every combination of blend mode and
+   color/alpha modulation, then report the throughput of both on 1080p
+   surfaces.
+*/
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+#include "../src/video/SDL_blit_auto.c"
+
+#define TEST_SRC_W 37
+#define TEST_SRC_H 23
+
+#define BENCH_W 1920
+#define BENCH_H 1080
+
+typedef struct
+{
+    int w, h;
+    int pitch;
+    Uint32 *pixels;
+} Buffer;
+
+static int iterations = 20;
+
+static const char *CPUName(unsigned int cpu)
+{
+    switch (cpu) {
+    case SDL_CPU_SSE4_1:
+        return "SSE4.1";
+    case SDL_CPU_AVX2:
+        return "AVX2";
+    case SDL_CPU_NEON:
+        return "NEON";
+    default:
+        return "scalar";
+    }
+}
+
+static SDL_bool CPUSupported(unsigned int cpu)
+{
+    switch (cpu) {
+    case SDL_CPU_ANY:
+        return SDL_TRUE;
+    case SDL_CPU_SSE4_1:
+        return SDL_HasSSE41();
+    case SDL_CPU_AVX2:
+        return SDL_HasAVX2();
+    case SDL_CPU_NEON:
+        return SDL_HasNEON();
+    default:
+        return SDL_FALSE;
+    }
+}
+
+static const SDL_BlitFuncEntry *FindScalarEntry(const SDL_BlitFuncEntry *entry)
+{
+    const SDL_BlitFuncEntry *scalar;
+
+    for (scalar = SDL_GeneratedBlitFuncTable; scalar->func; ++scalar) {
+        if (scalar->src_format == entry->src_format &&
+            scalar->dst_format == entry->dst_format &&
+            scalar->flags == entry->flags &&
+            scalar->cpu == SDL_CPU_ANY) {
+            return scalar;
+        }
+    }
+    return NULL;
+}
+
+static void EntryName(const SDL_BlitFuncEntry *entry, char *name, size_t maxlen)
+{
+    (void)SDL_snprintf(name, maxlen, "%s -> %s%s%s%s",
+                       SDL_GetPixelFormatName(entry->src_format) + SDL_strlen("SDL_PIXELFORMAT_"),
+                       SDL_GetPixelFormatName(entry->dst_format) + SDL_strlen("SDL_PIXELFORMAT_"),
+                       (entry->flags & SDL_COPY_MODULATE_COLOR) ? " modulate" : "",
+                       (entry->flags & SDL_COPY_BLEND) ? " blend" : "",
+                       (entry->flags & SDL_COPY_NEAREST) ? " scale" : "");
+}
+
+static int CreateBuffer(Buffer *buffer, int w, int h)
+{
+    buffer->w = w;
+    buffer->h = h;
+    buffer->pitch = w * (int)sizeof(Uint32);
+    buffer->pixels = (Uint32 *)SDL_malloc((size_t)w * h * sizeof(Uint32));
+    if (!buffer->pixels) {
+        return -1;
+    }
+    return 0;
+}
+
+/* Random pixels, with fully opaque, fully transparent and saturated ones mixed in */
+static void FillBuffer(Buffer *buffer)
+{
+    static const Uint32 special[] = { 0x00000000, 0xFFFFFFFF, 0xFF000000, 0x000000FF, 0x00FFFFFF, 0xFFFFFF00 };
+    int i;
+
+    for (i = 0; i < buffer->w * buffer->h; ++i) {
+        const Sint32 choice = SDL_rand(16);
+        if (choice < (Sint32)SDL_arraysize(special)) {
+            buffer->pixels[i] = special[choice];
+        } else {
+            buffer->pixels[i] = ((Uint32)SDL_rand(0x10000) << 16) | (Uint32)SDL_rand(0x10000);
+        }
+    }
+}
+
+static void Blit(SDL_BlitFunc func, const Buffer *src, Buffer *dst, int flags, const Uint8 *modulate)
+{
+    SDL_BlitInfo info;
+
+    SDL_zero(info);
+    info.src = (Uint8 *)src->pixels;
+    info.src_w = src->w;
+    info.src_h = src->h;
+    info.src_pitch = src->pitch;
+    info.dst = (Uint8 *)dst->pixels;
+    info.dst_w = dst->w;
+    info.dst_h = dst->h;
+    info.dst_pitch = dst->pitch;
+    info.flags = flags;
+    info.r = modulate[0];
+    info.g = modulate[1];
+    info.b = modulate[2];
+    info.a = modulate[3];
+    func(&info);
+}
+
+static int CheckEntry(const SDL_BlitFuncEntry *entry, const SDL_BlitFuncEntry *scalar, const char *name)
+{
+    static const int blend_modes[] = { 0, SDL_COPY_BLEND, SDL_COPY_ADD, SDL_COPY_MOD, SDL_COPY_MUL };
+    static const int modulate_modes[] = { 0, SDL_COPY_MODULATE_COLOR, SDL_COPY_MODULATE_ALPHA, SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA };
+    static const struct
+    {
+        int w, h;
+    } dst_sizes[] = { { TEST_SRC_W, TEST_SRC_H }, { 61, 29 }, { 19, 11 }, { 3, 2 } };
+    Uint8 modulate[4];
+    Buffer src, dst, expected, actual;
+    int errors = 0;
+    int i, j, k, m;
+
+    if (CreateBuffer(&src, TEST_SRC_W, TEST_SRC_H) < 0) {
+        return -1;
+    }
+    FillBuffer(&src);
+
+    for (i = 0; i < SDL_arraysize(dst_sizes); ++i) {
+        if (!(entry->flags & SDL_COPY_NEAREST) && (dst_sizes[i].w != src.w || dst_sizes[i].h != src.h)) {
+            continue;
+        }
+        if (CreateBuffer(&dst, dst_sizes[i].w, dst_sizes[i].h) < 0 ||
+            CreateBuffer(&expected, dst.w, dst.h) < 0 ||
+            CreateBuffer(&actual, dst.w, dst.h) < 0) {
+            SDL_free(src.pixels);
+            return -1;
+        }
+        FillBuffer(&dst);
+
+        for (j = 0; j < SDL_arraysize(blend_modes); ++j) {
+            if (blend_modes[j] && !(entry->flags & blend_modes[j])) {
+                continue;
+            }
+            for (k = 0; k < SDL_arraysize(modulate_modes); ++k) {
+                const int flags = blend_modes[j] | modulate_modes[k] | (entry->flags & SDL_COPY_NEAREST);
+
+                if (modulate_modes[k] && !(entry->flags & SDL_COPY_MODULATE_COLOR)) {
+                    continue;
+                }
+                for (m = 0; m < 3; ++m) {
+                    /* Opaque white, fully transparent black, and something in between */
+                    if (m == 0) {
+                        SDL_memset(modulate, 0xFF, sizeof(modulate));
+                    } else if (m == 1) {
+                        SDL_memset(modulate, 0x00, sizeof(modulate));
+                    } else {
+                        modulate[0] = (Uint8)SDL_rand(256);
+                        modulate[1] = (Uint8)SDL_rand(256);
+                        modulate[2] = (Uint8)SDL_rand(256);
+                        modulate[3] = (Uint8)SDL_rand(256);
+                    }
+
+                    SDL_memcpy(expected.pixels, dst.pixels, (size_t)dst.pitch * dst.h);
+                    SDL_memcpy(actual.pixels, dst.pixels, (size_t)dst.pitch * dst.h);
+                    Blit(scalar->func, &src, &expected, flags, modulate);
+                    Blit(entry->func, &src, &actual, flags, modulate);
+
+                    if (SDL_memcmp(expected.pixels, actual.pixels, (size_t)dst.pitch * dst.h) != 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s %s doesn't match the scalar blitter for %dx%d with flags 0x%x and modulation %d,%d,%d,%d\n",
+                                     CPUName(entry->cpu), name, dst.w, dst.h, flags, modulate[0], modulate[1], modulate[2], modulate[3]);
+                        ++errors;
+                    }
+                }
+            }
+        }
+
+        SDL_free(dst.pixels);
+        SDL_free(expected.pixels);
+        SDL_free(actual.pixels);
+    }
+    SDL_free(src.pixels);
+
+    return errors ? -1 : 0;
+}
+
+static double Benchmark(SDL_BlitFunc func, int flags, const Buffer *src, Buffer *dst)
+{
+    static const Uint8 modulate[4] = { 0xC0, 0x80, 0x40, 0xA0 };
+    Uint64 start, elapsed;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        Blit(func, src, dst, flags, modulate);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    return (double)dst->w * dst->h * iterations * SDL_GetPerformanceFrequency() / (double)elapsed / 1e6;
+}
+
+int main(int argc, char *argv[])
+{
+    static const unsigned int cpus[] = { SDL_CPU_SSE4_1, SDL_CPU_AVX2, SDL_CPU_NEON };
+    const SDL_BlitFuncEntry *entry;
+    SDLTest_CommonState *state;
+    Buffer src, scaled_src, dst;
+    SDL_bool benchmark = SDL_TRUE;
+    int errors = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    iterations = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && iterations > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--no-benchmark") == 0) {
+                benchmark = SDL_FALSE;
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--iterations NB]",
+                "[--no-benchmark]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    for (i = 0; i < SDL_arraysize(cpus); ++i) {
+        if (!CPUSupported(cpus[i])) {
+            SDL_Log("%-6s not supported by this CPU, skipped", CPUName(cpus[i]));
+        }
+    }
+
+    if (CreateBuffer(&src, BENCH_W, BENCH_H) < 0 ||
+        CreateBuffer(&scaled_src, 1280, 720) < 0 ||
+        CreateBuffer(&dst, BENCH_W, BENCH_H) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return 1;
+    }
+    FillBuffer(&src);
+    FillBuffer(&scaled_src);
+    FillBuffer(&dst);
+
+    for (entry = SDL_GeneratedBlitFuncTable; entry->func; ++entry) {
+        const SDL_BlitFuncEntry *scalar;
+        char name[128];
+        int flags;
+
+        if (entry->cpu == SDL_CPU_ANY || !CPUSupported(entry->cpu)) {
+            continue;
+        }
+
+        scalar = FindScalarEntry(entry);
+        if (!scalar) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "No scalar blitter for table entry %d\n", (int)(entry - SDL_GeneratedBlitFuncTable));
+            ++errors;
+            continue;
+        }
+
+        EntryName(entry, name, sizeof(name));
+        if (CheckEntry(entry, scalar, name) < 0) {
+            ++errors;
+        }
+
+        if (benchmark) {
+            double scalar_rate, rate;
+            const Buffer *source = (entry->flags & SDL_COPY_NEAREST) ? &scaled_src : &src;
+
+            /* Time the most common use of each blitter */
+            flags = entry->flags & SDL_COPY_NEAREST;
+            if (entry->flags & SDL_COPY_MODULATE_COLOR) {
+                flags |= SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA;
+            }
+            if (entry->flags & SDL_COPY_BLEND) {
+                flags |= SDL_COPY_BLEND;
+            }
+            scalar_rate = Benchmark(scalar->func, flags, source, &dst);
+            rate = Benchmark(entry->func, flags, source, &dst);
+
+            SDL_Log("%-6s %-44s %8.1f Mpixels/sec, scalar %8.1f Mpixels/sec (%.1fx)",
+                    CPUName(entry->cpu), name, rate, scalar_rate, rate / scalar_rate);
+        }
+    }
+
+    SDL_free(src.pixels);
+    SDL_free(scaled_src.pixels);
+    SDL_free(dst.pixels);
+
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
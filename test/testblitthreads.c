@@ -0,0 +1,271 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Time SDL_ConvertSurfaceFormat(), SDL_BlitSurfaceScaled() and scrolling
+   a surface onto itself on large surfaces while sweeping SDL_HINT_SURFACE_BLIT_THREADS through 0, 1, 2, 4...
+   up to --threads worker threads. The output with each thread count is compared
+   against the output on the calling thread alone, since it should not change.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef enum
+{
+    BLIT_CONVERT, /* SDL_ConvertSurfaceFormat() */
+    BLIT_SCALED,  /* blit scaled by 3/2 */
+    BLIT_SCROLL   /* blit onto the same surface, one row down */
+} BlitMode;
+
+typedef struct
+{
+    const char *name;
+    SDL_PixelFormatEnum src_format;
+    SDL_Colorspace src_colorspace;
+    SDL_PixelFormatEnum dst_format;
+    SDL_Colorspace dst_colorspace;
+    BlitMode mode;
+    SDL_ScaleMode scale_mode;
+} BlitCase;
+
+static const BlitCase cases[] = {
+    { "XRGB8888 -> RGB565", SDL_PIXELFORMAT_XRGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_RGB565, SDL_COLORSPACE_SRGB, BLIT_CONVERT, SDL_SCALEMODE_NEAREST },
+    { "ARGB8888 -> ABGR8888", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_ABGR8888, SDL_COLORSPACE_SRGB, BLIT_CONVERT, SDL_SCALEMODE_NEAREST },
+    { "RGB24 -> ARGB8888", SDL_PIXELFORMAT_RGB24, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, BLIT_CONVERT, SDL_SCALEMODE_NEAREST },
+    { "XBGR2101010 HDR10 -> ARGB8888 sRGB", SDL_PIXELFORMAT_XBGR2101010, SDL_COLORSPACE_HDR10, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, BLIT_CONVERT, SDL_SCALEMODE_NEAREST },
+    { "ARGB8888 scaled, nearest", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, BLIT_SCALED, SDL_SCALEMODE_NEAREST },
+    { "ARGB8888 scaled, linear", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, BLIT_SCALED, SDL_SCALEMODE_LINEAR },
+    { "ARGB8888 scrolled onto itself", SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, SDL_PIXELFORMAT_ARGB8888, SDL_COLORSPACE_SRGB, BLIT_SCROLL, SDL_SCALEMODE_NEAREST },
+};
+
+static int nb_threads = 0;
+static int iterations = 5;
+static int width = 3840;
+static int height = 2160;
+
+static SDL_Surface *CreateSourceSurface(const BlitCase *test)
+{
+    SDL_Surface *surface = SDL_CreateSurface(width, height, test->src_format);
+    Uint32 seed = 1;
+    int x, y;
+
+    if (!surface) {
+        return NULL;
+    }
+    SDL_SetSurfaceColorspace(surface, test->src_colorspace);
+    SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
+
+    for (y = 0; y < surface->h; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+        for (x = 0; x < surface->pitch; ++x) {
+            seed = seed * 1103515245u + 12345u;
+            row[x] = (Uint8)(seed >> 16);
+        }
+    }
+    return surface;
+}
+
+/* Runs the case with the given number of worker threads, returning the last output and the average time in ms */
+static SDL_Surface *RunBlit(const BlitCase *test, SDL_Surface *src, int threads, double *ms)
+{
+    SDL_Surface *dst = NULL;
+    Uint64 start, elapsed = 0;
+    char value[16];
+    int i;
+
+    (void)SDL_snprintf(value, sizeof(value), "%d", threads);
+    SDL_SetHint(SDL_HINT_SURFACE_BLIT_THREADS, value);
+
+    if (test->mode == BLIT_SCALED) {
+        dst = SDL_CreateSurface(width * 3 / 2, height * 3 / 2, test->dst_format);
+        if (!dst) {
+            return NULL;
+        }
+        SDL_SetSurfaceColorspace(dst, test->dst_colorspace);
+    }
+
+    /* The first run creates the worker threads, so it isn't timed */
+    for (i = 0; i <= iterations; ++i) {
+        if (test->mode == BLIT_SCROLL) {
+            /* Each run scrolls a fresh copy, so the output is the same every time */
+            SDL_DestroySurface(dst);
+            dst = SDL_DuplicateSurface(src);
+            if (!dst) {
+                return NULL;
+            }
+        }
+        start = SDL_GetPerformanceCounter();
+        if (test->mode == BLIT_SCALED) {
+            if (SDL_BlitSurfaceScaled(src, NULL, dst, NULL, test->scale_mode) < 0) {
+                SDL_DestroySurface(dst);
+                return NULL;
+            }
+        } else if (test->mode == BLIT_SCROLL) {
+            const SDL_Rect srcrect = { 0, 0, width, height - 1 };
+            SDL_Rect dstrect = { 0, 1, width, height - 1 };
+
+            if (SDL_BlitSurface(dst, &srcrect, dst, &dstrect) < 0) {
+                SDL_DestroySurface(dst);
+                return NULL;
+            }
+        } else {
+            SDL_DestroySurface(dst);
+            dst = SDL_ConvertSurfaceFormatAndColorspace(src, test->dst_format, test->dst_colorspace, 0);
+            if (!dst) {
+                return NULL;
+            }
+        }
+        if (i > 0) {
+            elapsed += SDL_GetPerformanceCounter() - start;
+        }
+    }
+
+    *ms = (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+    return dst;
+}
+
+/* Doubles the thread count, ending on exactly nb_threads */
+static int NextThreadCount(int threads)
+{
+    if (threads < nb_threads && threads * 2 > nb_threads) {
+        return nb_threads;
+    }
+    return threads * 2;
+}
+
+static SDL_bool CompareSurfaces(SDL_Surface *a, SDL_Surface *b)
+{
+    const size_t row_size = (size_t)a->w * SDL_BYTESPERPIXEL(a->format->format);
+    int y;
+
+    if (a->w != b->w || a->h != b->h || a->format->format != b->format->format) {
+        return SDL_FALSE;
+    }
+    for (y = 0; y < a->h; ++y) {
+        if (SDL_memcmp((Uint8 *)a->pixels + y * a->pitch, (Uint8 *)b->pixels + y * b->pitch, row_size) != 0) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_TRUE;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    int errors = 0;
+    int i, threads;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--threads") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    nb_threads = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && nb_threads > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--iterations") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    iterations = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && iterations > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--size") == 0) {
+                if (argv[i + 1] && SDL_sscanf(argv[i + 1], "%dx%d", &width, &height) == 2 && width > 0 && height > 0) {
+                    consumed = 2;
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--threads NB]",
+                "[--iterations NB]",
+                "[--size WxH]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (nb_threads == 0) {
+        /* Default to one worker per extra core, and at least one so the threaded path is always checked */
+        nb_threads = SDL_max(SDL_GetCPUCount() - 1, 1);
+    }
+
+    SDL_Log("Blitting %dx%d surfaces with 0 to %d worker threads, %d iterations each", width, height, nb_threads, iterations);
+
+    for (i = 0; i < SDL_arraysize(cases); ++i) {
+        const BlitCase *test = &cases[i];
+        SDL_Surface *src = CreateSourceSurface(test);
+        SDL_Surface *serial;
+        double serial_ms = 0.0;
+
+        if (!src) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface: %s\n", SDL_GetError());
+            return 1;
+        }
+
+        serial = RunBlit(test, src, 0, &serial_ms);
+        if (!serial) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: blit failed: %s\n", test->name, SDL_GetError());
+            ++errors;
+            SDL_DestroySurface(src);
+            continue;
+        }
+        SDL_Log("%-36s 0 worker threads: %8.2f ms", test->name, serial_ms);
+
+        for (threads = 1; threads <= nb_threads; threads = NextThreadCount(threads)) {
+            double ms = 0.0;
+            SDL_Surface *dst = RunBlit(test, src, threads, &ms);
+
+            if (!dst) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: blit failed with %d worker threads: %s\n", test->name, threads, SDL_GetError());
+                ++errors;
+                continue;
+            }
+            if (!CompareSurfaces(serial, dst)) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: output differs with %d worker threads\n", test->name, threads);
+                ++errors;
+            }
+            SDL_Log("%-36s %d worker threads: %8.2f ms (%.2fx)", test->name, threads, ms, serial_ms / ms);
+            SDL_DestroySurface(dst);
+        }
+
+        SDL_DestroySurface(serial);
+        SDL_DestroySurface(src);
+    }
+
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
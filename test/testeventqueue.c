@@ -0,0 +1,213 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Stress the event queue with several producer threads and one consumer,
+   checking that no event is lost or reordered within a producer, and
+   reporting the throughput and push latency.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+typedef struct
+{
+    int index;
+    Uint64 *latencies;
+    int retries;
+} ProducerData;
+
+static int nb_producers = 4;
+static int nb_events = 100000;
+static Uint32 event_type;
+
+static int SDLCALL
+ProducerRun(void *data)
+{
+    ProducerData *producer = (ProducerData *)data;
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = event_type;
+    event.user.code = producer->index;
+
+    for (i = 0; i < nb_events; ++i) {
+        Uint64 start, end;
+
+        event.user.data1 = (void *)(intptr_t)i;
+        event.common.timestamp = 0;
+
+        start = SDL_GetPerformanceCounter();
+        while (SDL_PushEvent(&event) <= 0) {
+            /* The queue is full, give the consumer a chance to catch up */
+            ++producer->retries;
+            SDL_Delay(0);
+            start = SDL_GetPerformanceCounter();
+        }
+        end = SDL_GetPerformanceCounter();
+        producer->latencies[i] = end - start;
+    }
+
+    return 0;
+}
+
+static int SDLCALL
+CompareLatency(const void *a, const void *b)
+{
+    const Uint64 lhs = *(const Uint64 *)a;
+    const Uint64 rhs = *(const Uint64 *)b;
+
+    if (lhs < rhs) {
+        return -1;
+    } else if (lhs > rhs) {
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    ProducerData *producers;
+    SDL_Thread **threads;
+    int *next_expected;
+    Uint64 *latencies;
+    Uint64 start, elapsed, frequency;
+    int total, received = 0, retries = 0, errors = 0;
+    int i;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--producers") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    nb_producers = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && nb_producers > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--events") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    nb_events = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && nb_events > 0) {
+                        consumed = 2;
+                    }
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--producers NB]",
+                "[--events NB]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    event_type = SDL_RegisterEvents(1);
+    total = nb_producers * nb_events;
+    producers = (ProducerData *)SDL_calloc(nb_producers, sizeof(*producers));
+    threads = (SDL_Thread **)SDL_calloc(nb_producers, sizeof(*threads));
+    next_expected = (int *)SDL_calloc(nb_producers, sizeof(*next_expected));
+    latencies = (Uint64 *)SDL_malloc(total * sizeof(*latencies));
+    if (!producers || !threads || !next_expected || !latencies) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return 1;
+    }
+
+    SDL_Log("%d producers pushing %d events each", nb_producers, nb_events);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < nb_producers; ++i) {
+        char name[64];
+
+        producers[i].index = i;
+        producers[i].latencies = &latencies[i * nb_events];
+        (void)SDL_snprintf(name, sizeof(name), "Producer%d", i);
+        threads[i] = SDL_CreateThread(ProducerRun, name, &producers[i]);
+        if (!threads[i]) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create producer thread: %s\n", SDL_GetError());
+            return 1;
+        }
+    }
+
+    while (received < total) {
+        SDL_Event event;
+
+        if (!SDL_PollEvent(&event)) {
+            continue;
+        }
+        if (event.type != event_type) {
+            continue;
+        }
+        if ((int)(intptr_t)event.user.data1 != next_expected[event.user.code]) {
+            ++errors;
+        }
+        next_expected[event.user.code] = (int)(intptr_t)event.user.data1 + 1;
+        ++received;
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    for (i = 0; i < nb_producers; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+        retries += producers[i].retries;
+    }
+
+    frequency = SDL_GetPerformanceFrequency();
+    SDL_qsort(latencies, total, sizeof(*latencies), CompareLatency);
+
+    SDL_Log("Received %d events in %.2f ms: %.0f events/sec",
+            received, (double)elapsed * 1000.0 / frequency,
+            (double)received * frequency / elapsed);
+    SDL_Log("Push latency: median %.0f ns, p99 %.0f ns, max %.0f ns",
+            (double)latencies[total / 2] * 1e9 / frequency,
+            (double)latencies[(Uint64)total * 99 / 100] * 1e9 / frequency,
+            (double)latencies[total - 1] * 1e9 / frequency);
+    SDL_Log("Pushes retried because the queue was full: %d", retries);
+    if (errors) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d events arrived out of order\n", errors);
+    }
+
+    SDL_free(latencies);
+    SDL_free(next_expected);
+    SDL_free(threads);
+    SDL_free(producers);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
@@ -0,0 +1,260 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Micro-benchmark for the internal hash table: insert, lookup (hits and
+   misses), iteration and removal with ID and string keys, from a handful of
+   entries up to a million, checking the results along the way.
+*/
+
+/* Hack #1: avoid inclusion of SDL_main.h by SDL_internal.h */
+#define SDL_main_h_
+
+/* Hack #2: avoid dynapi renaming (must be done before #include <SDL3/SDL.h>) */
+#include "../src/dynapi/SDL_dynapi.h"
+#ifdef SDL_DYNAMIC_API
+#undef SDL_DYNAMIC_API
+#endif
+#define SDL_DYNAMIC_API 0
+
+#include "../src/SDL_internal.h"
+
+/* Hack #3: undo Hack #1 */
+#ifdef SDL_main_h_
+#undef SDL_main_h_
+#endif
+#ifdef SDL_MAIN_NOIMPL
+#undef SDL_MAIN_NOIMPL
+#endif
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+
+/* The hash table isn't exported, so build it right into the test */
+#include "../src/SDL_hashtable.c"
+
+typedef enum
+{
+    KEY_ID,
+    KEY_STRING
+} KeyType;
+
+static int max_entries = 1000000;
+static int errors = 0;
+
+static double NanosecondsPer(Uint64 ticks, int count)
+{
+    return (double)ticks * 1e9 / SDL_GetPerformanceFrequency() / count;
+}
+
+static SDL_bool Check(SDL_bool condition, const char *what, int num)
+{
+    if (!condition) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d entries: %s failed", num, what);
+        ++errors;
+    }
+    return condition;
+}
+
+/* Stops the enclosing loop at the first failure, so one bug doesn't log a million errors */
+#define CHECK(cond) if (!Check((cond), #cond, num)) break
+
+static void RunBenchmark(KeyType type, int num, const void **keys, const void **missing_keys)
+{
+    SDL_HashTable *table;
+    Uint64 start, insert_ticks, hit_ticks, miss_ticks, iterate_ticks, remove_ticks;
+    const void *key, *value;
+    void *iter = NULL;
+    int i, found;
+
+    if (type == KEY_ID) {
+        table = SDL_CreateHashTable(NULL, 4, SDL_HashID, SDL_KeyMatchID, NULL, SDL_FALSE);
+    } else {
+        table = SDL_CreateHashTable(NULL, 4, SDL_HashString, SDL_KeyMatchString, NULL, SDL_FALSE);
+    }
+    if (!table) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create hash table: %s", SDL_GetError());
+        ++errors;
+        return;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num; ++i) {
+        CHECK(SDL_InsertIntoHashTable(table, keys[i], (const void *)(intptr_t)i));
+    }
+    insert_ticks = SDL_GetPerformanceCounter() - start;
+    for (i = 0; i < num; ++i) {
+        CHECK(!SDL_InsertIntoHashTable(table, keys[i], NULL));
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num; ++i) {
+        CHECK(SDL_FindInHashTable(table, keys[i], &value) && (intptr_t)value == i);
+    }
+    hit_ticks = SDL_GetPerformanceCounter() - start;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num; ++i) {
+        CHECK(!SDL_FindInHashTable(table, missing_keys[i], NULL));
+    }
+    miss_ticks = SDL_GetPerformanceCounter() - start;
+
+    found = 0;
+    start = SDL_GetPerformanceCounter();
+    while (SDL_IterateHashTable(table, &key, &value, &iter)) {
+        ++found;
+    }
+    iterate_ticks = SDL_GetPerformanceCounter() - start;
+    Check(found == num, "iterating every entry", num);
+
+    /* Remove every other entry, make sure the rest survived, then remove those too */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num; i += 2) {
+        CHECK(SDL_RemoveFromHashTable(table, keys[i]));
+    }
+    for (i = 0; i < num; ++i) {
+        CHECK(SDL_FindInHashTable(table, keys[i], NULL) == (i % 2 == 1));
+    }
+    for (i = 1; i < num; i += 2) {
+        CHECK(SDL_RemoveFromHashTable(table, keys[i]));
+    }
+    remove_ticks = SDL_GetPerformanceCounter() - start;
+    Check(SDL_HashTableEmpty(table), "emptying the table", num);
+
+    SDL_Log("%-6s %8d entries: insert %6.1f ns, hit %6.1f ns, miss %6.1f ns, iterate %5.1f ns, remove %6.1f ns",
+            type == KEY_ID ? "ID" : "string", num,
+            NanosecondsPer(insert_ticks, num), NanosecondsPer(hit_ticks, num),
+            NanosecondsPer(miss_ticks, num), NanosecondsPer(iterate_ticks, num),
+            NanosecondsPer(remove_ticks, num));
+
+    SDL_DestroyHashTable(table);
+}
+
+static void TestStackable(void)
+{
+    const int num = 100;
+    SDL_HashTable *table = SDL_CreateHashTable(NULL, 4, SDL_HashID, SDL_KeyMatchID, NULL, SDL_TRUE);
+    const void *value;
+    void *iter = NULL;
+    int i, seen = 0;
+    SDL_bool newest_first = SDL_TRUE;
+
+    for (i = 0; i < num; ++i) {
+        SDL_InsertIntoHashTable(table, (const void *)(uintptr_t)(i % 10), (const void *)(uintptr_t)i);
+    }
+
+    /* The most recently inserted value comes first, like the old chained table */
+    i = num - 3;
+    while (SDL_IterateHashTableKey(table, (const void *)(uintptr_t)7, &value, &iter)) {
+        seen |= 1 << ((uintptr_t)value / 10);
+        if ((intptr_t)value != i) {
+            newest_first = SDL_FALSE;
+        }
+        i -= 10;
+    }
+    Check(seen == 0x3FF, "iterating stacked values", num);
+    Check(newest_first, "iterating stacked values newest first", num);
+    for (i = 0; i < 10; ++i) {
+        if (!SDL_FindInHashTable(table, (const void *)(uintptr_t)7, &value) || (intptr_t)value != num - 3 - i * 10) {
+            newest_first = SDL_FALSE;
+        }
+        SDL_RemoveFromHashTable(table, (const void *)(uintptr_t)7);
+    }
+    Check(newest_first, "finding and removing stacked values newest first", num);
+    Check(!SDL_FindInHashTable(table, (const void *)(uintptr_t)7, NULL), "removing stacked values", num);
+    Check(SDL_FindInHashTable(table, (const void *)(uintptr_t)8, NULL), "keeping other keys", num);
+    SDL_DestroyHashTable(table);
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    const void **keys, **missing_keys;
+    char *strings;
+    int i, num;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--max-entries") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    max_entries = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && max_entries > 0) {
+                        consumed = 2;
+                    }
+                }
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--max-entries NB]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    keys = (const void **)SDL_malloc(max_entries * sizeof(*keys));
+    missing_keys = (const void **)SDL_malloc(max_entries * sizeof(*missing_keys));
+    strings = (char *)SDL_malloc((size_t)max_entries * 2 * 16);
+    if (!keys || !missing_keys || !strings) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory");
+        return 1;
+    }
+
+    TestStackable();
+
+    /* IDs are handed out sequentially, like the real ones */
+    for (i = 0; i < max_entries; ++i) {
+        keys[i] = (const void *)(uintptr_t)(i + 1);
+        missing_keys[i] = (const void *)(uintptr_t)(max_entries + i + 1);
+    }
+    for (num = 10; num <= max_entries; num *= 10) {
+        RunBenchmark(KEY_ID, num, keys, missing_keys);
+    }
+
+    /* Strings shaped like property names */
+    for (i = 0; i < max_entries; ++i) {
+        char *key = &strings[i * 16];
+        char *missing_key = &strings[(max_entries + i) * 16];
+        (void)SDL_snprintf(key, 16, "SDL.prop.%d", i);
+        (void)SDL_snprintf(missing_key, 16, "SDL.miss.%d", i);
+        keys[i] = key;
+        missing_keys[i] = missing_key;
+    }
+    for (num = 10; num <= max_entries; num *= 10) {
+        RunBenchmark(KEY_STRING, num, keys, missing_keys);
+    }
+
+    SDL_free(strings);
+    SDL_free(missing_keys);
+    SDL_free(keys);
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}
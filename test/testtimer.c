@@ -18,6 +18,8 @@
 #include <SDL3/SDL_test.h>
 
 #define DEFAULT_RESOLUTION 1
+#define NUM_STRESS_TIMERS   100000
+#define NUM_JITTER_TIMERS   100
 
 static int test_sdl_delay_within_bounds(void) {
     const int testDelay = 100;
@@ -72,6 +74,81 @@ callback(void *param, SDL_TimerID timerID, Uint32 interval)
     return interval;
 }
 
+static Uint32 SDLCALL
+idle(void *param, SDL_TimerID timerID, Uint32 interval)
+{
+    return interval;
+}
+
+typedef struct
+{
+    Uint64 expected;
+    SDL_AtomicInt fired;
+    Uint64 lateness;
+} JitterTimer;
+
+static Uint64 SDLCALL
+jitter(void *param, SDL_TimerID timerID, Uint64 interval)
+{
+    JitterTimer *timer = (JitterTimer *)param;
+    Uint64 now = SDL_GetTicksNS();
+
+    timer->lateness = (now > timer->expected) ? (now - timer->expected) : 0;
+    SDL_AtomicSet(&timer->fired, 1);
+    return 0;
+}
+
+static void stress_timers(void)
+{
+    SDL_TimerID *ids = (SDL_TimerID *)SDL_malloc(NUM_STRESS_TIMERS * sizeof(*ids));
+    JitterTimer *timers = (JitterTimer *)SDL_calloc(NUM_JITTER_TIMERS, sizeof(*timers));
+    Uint64 start_perf, now_perf, total_lateness = 0, max_lateness = 0;
+    int i, fired = 0;
+
+    if (!ids || !timers) {
+        SDL_free(ids);
+        SDL_free(timers);
+        return;
+    }
+
+    SDL_Log("Adding and removing %d timers\n", NUM_STRESS_TIMERS);
+    start_perf = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_STRESS_TIMERS; ++i) {
+        ids[i] = SDL_AddTimer(60 * 1000 + (i % 1000), idle, NULL);
+    }
+    now_perf = SDL_GetPerformanceCounter();
+    SDL_Log("SDL_AddTimer: %f us per timer\n", (double)((now_perf - start_perf) * 1000000) / SDL_GetPerformanceFrequency() / NUM_STRESS_TIMERS);
+
+    /* Measure how late short timers fire while all of these are queued */
+    for (i = 0; i < NUM_JITTER_TIMERS; ++i) {
+        const Uint64 interval = SDL_MS_TO_NS(i + 1);
+        timers[i].expected = SDL_GetTicksNS() + interval;
+        SDL_AddTimerNS(interval, jitter, &timers[i]);
+    }
+    SDL_Delay(NUM_JITTER_TIMERS + 100);
+    for (i = 0; i < NUM_JITTER_TIMERS; ++i) {
+        if (SDL_AtomicGet(&timers[i].fired)) {
+            ++fired;
+            total_lateness += timers[i].lateness;
+            max_lateness = SDL_max(max_lateness, timers[i].lateness);
+        }
+    }
+    if (fired) {
+        SDL_Log("%d/%d timers fired, wakeup jitter: average %f us, max %f us\n", fired, NUM_JITTER_TIMERS,
+                (double)total_lateness / fired / 1000.0, (double)max_lateness / 1000.0);
+    }
+
+    start_perf = SDL_GetPerformanceCounter();
+    for (i = 0; i < NUM_STRESS_TIMERS; ++i) {
+        SDL_RemoveTimer(ids[i]);
+    }
+    now_perf = SDL_GetPerformanceCounter();
+    SDL_Log("SDL_RemoveTimer: %f us per timer\n", (double)((now_perf - start_perf) * 1000000) / SDL_GetPerformanceFrequency() / NUM_STRESS_TIMERS);
+
+    SDL_free(ids);
+    SDL_free(timers);
+}
+
 int main(int argc, char *argv[])
 {
     int i;
@@ -213,6 +290,8 @@ int main(int argc, char *argv[])
     SDL_RemoveTimer(t2);
     SDL_RemoveTimer(t3);
 
+    stress_timers();
+
     ticks = 0;
     start_perf = SDL_GetPerformanceCounter();
     for (i = 0; i < 1000000; ++i) {
@@ -0,0 +1,527 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Transcode a WAVE file (sample.wav by default) to mu-law, A-law, IMA ADPCM
+   and MS ADPCM, in mono and stereo, and report how fast SDL_LoadWAV_IO()
+   decodes each of them: once as a short sound effect, to show the cost of
+   loading many small files, and once as a long file decoded on one thread and
+   then with SDL_HINT_WAVE_DECODE_THREADS (one thread per CPU core, unless
+   --threads says otherwise). The output of both long decodes is compared,
+   since it should not change.
+*/
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_main.h>
+#include <SDL3/SDL_test.h>
+#include "testutils.h"
+
+#define EFFECT_MS 250
+#define MEASURE_NS (SDL_NS_PER_SECOND / 5)
+
+static const char *decode_threads = "0";
+
+typedef struct
+{
+    Uint8 *data;
+    size_t size;
+    size_t capacity;
+} ByteBuffer;
+
+typedef struct
+{
+    const char *name;
+    Uint16 formattag;
+    Uint16 bitspersample;
+} Format;
+
+static const Format formats[] = {
+    { "PCM", 0x0001, 16 },
+    { "mu-law", 0x0007, 8 },
+    { "A-law", 0x0006, 8 },
+    { "IMA ADPCM", 0x0011, 4 },
+    { "MS ADPCM", 0x0002, 4 },
+};
+
+static const Sint16 ms_adpcm_coeffs[7][2] = {
+    { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 }, { 240, 0 }, { 460, -208 }, { 392, -232 }
+};
+
+static const Uint16 ima_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31,
+    34, 37, 41, 45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130,
+    143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282,
+    1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749, 3024, 3327,
+    3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350,
+    22385, 24623, 27086, 29794, 32767
+};
+
+static const int ima_index_steps[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+static const int ms_adpcm_adaptive[16] = {
+    230, 230, 230, 230, 307, 409, 512, 614, 768, 614, 512, 409, 307, 230, 230, 230
+};
+
+static SDL_bool Grow(ByteBuffer *buf, size_t len)
+{
+    if (buf->size + len > buf->capacity) {
+        size_t capacity = SDL_max(buf->capacity * 2, buf->size + len);
+        Uint8 *data = (Uint8 *)SDL_realloc(buf->data, capacity);
+        if (!data) {
+            return SDL_FALSE;
+        }
+        buf->data = data;
+        buf->capacity = capacity;
+    }
+    return SDL_TRUE;
+}
+
+static void Put8(ByteBuffer *buf, Uint8 val)
+{
+    if (Grow(buf, 1)) {
+        buf->data[buf->size++] = val;
+    }
+}
+
+static void Put16(ByteBuffer *buf, Uint16 val)
+{
+    Put8(buf, (Uint8)(val & 0xff));
+    Put8(buf, (Uint8)(val >> 8));
+}
+
+static void Put32(ByteBuffer *buf, Uint32 val)
+{
+    Put16(buf, (Uint16)(val & 0xffff));
+    Put16(buf, (Uint16)(val >> 16));
+}
+
+static void PutTag(ByteBuffer *buf, const char *tag)
+{
+    Put8(buf, tag[0]);
+    Put8(buf, tag[1]);
+    Put8(buf, tag[2]);
+    Put8(buf, tag[3]);
+}
+
+static Uint8 EncodeMuLaw(Sint16 sample)
+{
+    int value = sample;
+    int sign = 0;
+    int exponent = 7;
+
+    if (value < 0) {
+        value = -value;
+        sign = 0x80;
+    }
+    if (value > 32635) {
+        value = 32635;
+    }
+    value += 0x84;
+    while (exponent > 0 && !(value & (0x80 << exponent))) {
+        exponent--;
+    }
+    return (Uint8)~(sign | (exponent << 4) | ((value >> (exponent + 3)) & 0x0f));
+}
+
+static Uint8 EncodeALaw(Sint16 sample)
+{
+    int value = sample;
+    int sign = 0x80;
+    int exponent = 0;
+    int mantissa;
+
+    if (value < 0) {
+        value = -value - 1;
+        sign = 0;
+    }
+    if (value >= 256) {
+        exponent = 7;
+        while (exponent > 1 && !(value & (0x80 << exponent))) {
+            exponent--;
+        }
+        mantissa = (value >> (exponent + 3)) & 0x0f;
+    } else {
+        mantissa = value >> 4;
+    }
+    return (Uint8)((sign | (exponent << 4) | mantissa) ^ 0x55);
+}
+
+/* Encodes one sample like the IMA ADPCM reference encoder and updates the
+   predictor the same way the decoder will. */
+static Uint8 EncodeIMANybble(Sint16 sample, int *predicted, int *index)
+{
+    const int step = ima_steps[*index];
+    int diff = sample - *predicted;
+    int delta = step >> 3;
+    Uint8 nybble = 0;
+
+    if (diff < 0) {
+        nybble = 8;
+        diff = -diff;
+    }
+    if (diff >= step) {
+        nybble |= 4;
+        diff -= step;
+        delta += step;
+    }
+    if (diff >= (step >> 1)) {
+        nybble |= 2;
+        diff -= step >> 1;
+        delta += step >> 1;
+    }
+    if (diff >= (step >> 2)) {
+        nybble |= 1;
+        delta += step >> 2;
+    }
+
+    *predicted = SDL_clamp(*predicted + ((nybble & 8) ? -delta : delta), -32768, 32767);
+    *index = SDL_clamp(*index + ima_index_steps[nybble & 7], 0, 88);
+    return nybble;
+}
+
+static Uint8 EncodeMSNybble(Sint16 sample, const Sint16 *coeff, int *sample1, int *sample2, int *delta)
+{
+    const int predicted = (*sample1 * coeff[0] + *sample2 * coeff[1]) / 256;
+    int error = sample - predicted;
+    int decoded;
+
+    /* Round to the nearest multiple of delta. */
+    error = (error >= 0) ? (error + *delta / 2) / *delta : (error - *delta / 2) / *delta;
+    error = SDL_clamp(error, -8, 7);
+
+    decoded = SDL_clamp(predicted + error * *delta, -32768, 32767);
+    *sample2 = *sample1;
+    *sample1 = decoded;
+    *delta = SDL_clamp((*delta * ms_adpcm_adaptive[error & 0x0f]) / 256, 16, 65535);
+    return (Uint8)(error & 0x0f);
+}
+
+static Uint32 SamplesPerBlock(const Format *format, int channels, Uint16 blockalign)
+{
+    if (format->formattag == 0x0011) {
+        return (Uint32)(blockalign - 4 * channels) * 2 / channels + 1;
+    } else if (format->formattag == 0x0002) {
+        return (Uint32)(blockalign - 7 * channels) * 2 / channels + 2;
+    }
+    return 1;
+}
+
+/* Writes a whole WAVE file to `buf`, with `frames` sample frames from `pcm`. */
+static void WriteWAV(ByteBuffer *buf, const Format *format, int channels, int freq, const Sint16 *pcm, int frames)
+{
+    const SDL_bool adpcm = (format->bitspersample == 4);
+    const Uint16 blockalign = adpcm ? (Uint16)(512 * channels) : (Uint16)(format->bitspersample / 8 * channels);
+    const Uint32 spb = SamplesPerBlock(format, channels, blockalign);
+    size_t riffsize, datasize;
+    int frame, c, i;
+
+    buf->size = 0;
+    PutTag(buf, "RIFF");
+    riffsize = buf->size;
+    Put32(buf, 0);
+    PutTag(buf, "WAVE");
+
+    PutTag(buf, "fmt ");
+    Put32(buf, format->formattag == 0x0002 ? 50 : (format->formattag == 0x0011 ? 20 : 18));
+    Put16(buf, format->formattag);
+    Put16(buf, (Uint16)channels);
+    Put32(buf, (Uint32)freq);
+    Put32(buf, (Uint32)((Uint64)freq * blockalign / spb));
+    Put16(buf, blockalign);
+    Put16(buf, format->bitspersample);
+    if (format->formattag == 0x0002) {
+        Put16(buf, 32);
+        Put16(buf, (Uint16)spb);
+        Put16(buf, 7);
+        for (i = 0; i < 7; i++) {
+            Put16(buf, (Uint16)ms_adpcm_coeffs[i][0]);
+            Put16(buf, (Uint16)ms_adpcm_coeffs[i][1]);
+        }
+    } else if (format->formattag == 0x0011) {
+        Put16(buf, 2);
+        Put16(buf, (Uint16)spb);
+    } else {
+        Put16(buf, 0);
+    }
+
+    PutTag(buf, "data");
+    datasize = buf->size;
+    Put32(buf, 0);
+
+    if (format->formattag == 0x0001) {
+        for (i = 0; i < frames * channels; i++) {
+            Put16(buf, (Uint16)pcm[i]);
+        }
+    } else if (format->formattag == 0x0007 || format->formattag == 0x0006) {
+        for (i = 0; i < frames * channels; i++) {
+            Put8(buf, format->formattag == 0x0007 ? EncodeMuLaw(pcm[i]) : EncodeALaw(pcm[i]));
+        }
+    } else if (format->formattag == 0x0011) {
+        for (frame = 0; frame + (int)spb <= frames; frame += spb) {
+            const Sint16 *block = pcm + (size_t)frame * channels;
+            int predicted[2], index[2];
+            for (c = 0; c < channels; c++) {
+                predicted[c] = block[c];
+                index[c] = 0;
+                Put16(buf, (Uint16)block[c]);
+                Put8(buf, 0);
+                Put8(buf, 0);
+            }
+            for (i = 1; i < (int)spb; i += 8) {
+                for (c = 0; c < channels; c++) {
+                    int j;
+                    for (j = 0; j < 8; j += 2) {
+                        const Uint8 lo = EncodeIMANybble(block[(i + j) * channels + c], &predicted[c], &index[c]);
+                        const Uint8 hi = EncodeIMANybble(block[(i + j + 1) * channels + c], &predicted[c], &index[c]);
+                        Put8(buf, (Uint8)(lo | (hi << 4)));
+                    }
+                }
+            }
+        }
+    } else {
+        for (frame = 0; frame + (int)spb <= frames; frame += spb) {
+            const Sint16 *block = pcm + (size_t)frame * channels;
+            int sample1[2], sample2[2], delta[2];
+            int nybbles = 0;
+            Uint8 byte = 0;
+            for (c = 0; c < channels; c++) {
+                Put8(buf, 0); /* Always use the first coefficient pair. */
+            }
+            for (c = 0; c < channels; c++) {
+                delta[c] = 16;
+                Put16(buf, (Uint16)delta[c]);
+            }
+            for (c = 0; c < channels; c++) {
+                sample1[c] = block[channels + c];
+                Put16(buf, (Uint16)sample1[c]);
+            }
+            for (c = 0; c < channels; c++) {
+                sample2[c] = block[c];
+                Put16(buf, (Uint16)sample2[c]);
+            }
+            for (i = 2 * channels; i < (int)spb * channels; i++) {
+                c = i % channels;
+                byte = (Uint8)((byte << 4) | EncodeMSNybble(block[i], ms_adpcm_coeffs[0], &sample1[c], &sample2[c], &delta[c]));
+                if (++nybbles == 2) {
+                    Put8(buf, byte);
+                    nybbles = 0;
+                    byte = 0;
+                }
+            }
+            while (buf->size % blockalign != (datasize + 4) % blockalign) {
+                Put8(buf, 0);
+            }
+        }
+    }
+
+    if (buf->data) {
+        const size_t riff = buf->size - riffsize - 4;
+        const size_t data = buf->size - datasize - 4;
+        for (i = 0; i < 4; i++) {
+            buf->data[riffsize + i] = (Uint8)(riff >> (i * 8));
+            buf->data[datasize + i] = (Uint8)(data >> (i * 8));
+        }
+    }
+}
+
+/* Loads the file again and again for a while. Returns the average time per load in nanoseconds, or 0 on failure. */
+static Uint64 MeasureLoad(const ByteBuffer *buf, Uint8 **audio_buf, Uint32 *audio_len)
+{
+    const Uint64 start = SDL_GetTicksNS();
+    Uint64 now = start;
+    int loads = 0;
+
+    SDL_free(*audio_buf);
+    *audio_buf = NULL;
+    *audio_len = 0;
+    while (loads < 3 || now - start < MEASURE_NS) {
+        SDL_AudioSpec spec;
+        SDL_free(*audio_buf);
+        if (SDL_LoadWAV_IO(SDL_IOFromConstMem(buf->data, buf->size), SDL_TRUE, &spec, audio_buf, audio_len) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't decode: %s\n", SDL_GetError());
+            return 0;
+        }
+        loads++;
+        now = SDL_GetTicksNS();
+    }
+
+    return SDL_max((now - start) / loads, 1);
+}
+
+static int BenchmarkFormat(const Format *format, int channels, int freq, const Sint16 *pcm, int effect_frames, int long_frames)
+{
+    ByteBuffer buf = { NULL, 0, 0 };
+    Uint8 *serial = NULL, *threaded = NULL;
+    Uint32 serial_len = 0, threaded_len = 0;
+    Uint64 effect_ns, serial_ns, threaded_ns;
+    int errors = 0;
+
+    WriteWAV(&buf, format, channels, freq, pcm, effect_frames);
+    effect_ns = MeasureLoad(&buf, &serial, &serial_len);
+
+    WriteWAV(&buf, format, channels, freq, pcm, long_frames);
+    SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, "1");
+    serial_ns = MeasureLoad(&buf, &serial, &serial_len);
+    SDL_SetHint(SDL_HINT_WAVE_DECODE_THREADS, decode_threads);
+    threaded_ns = MeasureLoad(&buf, &threaded, &threaded_len);
+
+    if (!effect_ns || !serial_ns || !threaded_ns) {
+        ++errors;
+    } else {
+        const double seconds = (double)long_frames / freq;
+        SDL_Log("%-9s %s: %7.1f us per %d ms effect (%6.0f loads/s), %8.1f MB/s, %8.1f MB/s with threads (%.0fx realtime)",
+                format->name, channels == 1 ? "mono  " : "stereo",
+                effect_ns / 1000.0, EFFECT_MS, (double)SDL_NS_PER_SECOND / effect_ns,
+                serial_len / (serial_ns / 1e9) / (1024.0 * 1024.0),
+                threaded_len / (threaded_ns / 1e9) / (1024.0 * 1024.0),
+                seconds / (threaded_ns / 1e9));
+
+        if (serial_len != threaded_len || SDL_memcmp(serial, threaded, serial_len) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s %s decoded differently with threads\n", format->name, channels == 1 ? "mono" : "stereo");
+            ++errors;
+        }
+    }
+
+    SDL_free(serial);
+    SDL_free(threaded);
+    SDL_free(buf.data);
+    return errors;
+}
+
+int main(int argc, char *argv[])
+{
+    SDLTest_CommonState *state;
+    char *filename = NULL;
+    int long_seconds = 60;
+    SDL_AudioSpec spec, mono_spec;
+    Uint8 *audio_buf = NULL;
+    Uint32 audio_len = 0;
+    Sint16 *mono = NULL, *stereo = NULL;
+    int src_frames, long_frames, effect_frames;
+    int errors = 0;
+    int i, f;
+
+    /* Initialize test framework */
+    state = SDLTest_CommonCreateState(argv, 0);
+    if (!state) {
+        return 1;
+    }
+
+    /* Enable standard application logging */
+    SDL_SetLogPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Parse commandline */
+    for (i = 1; i < argc;) {
+        int consumed;
+
+        consumed = SDLTest_CommonArg(state, i);
+        if (!consumed) {
+            if (SDL_strcmp(argv[i], "--seconds") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    long_seconds = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && long_seconds > 0) {
+                        consumed = 2;
+                    }
+                }
+            } else if (SDL_strcmp(argv[i], "--threads") == 0) {
+                if (argv[i + 1]) {
+                    char *endptr;
+                    const long val = SDL_strtol(argv[i + 1], &endptr, 0);
+                    if (endptr != argv[i + 1] && *endptr == '\0' && val >= 0) {
+                        decode_threads = argv[i + 1];
+                        consumed = 2;
+                    }
+                }
+            } else if (!filename) {
+                filename = argv[i];
+                consumed = 1;
+            }
+        }
+        if (consumed <= 0) {
+            static const char *options[] = {
+                "[--seconds NB]",
+                "[--threads NB]",
+                "[sample.wav]",
+                NULL,
+            };
+            SDLTest_CommonLogUsage(state, argv[0], options);
+            return 1;
+        }
+
+        i += consumed;
+    }
+
+    filename = GetResourceFilename(filename, "sample.wav");
+    if (!filename) {
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    if (SDL_LoadWAV(filename, &spec, &audio_buf, &audio_len) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't load %s: %s\n", filename, SDL_GetError());
+        SDL_free(filename);
+        SDLTest_CommonDestroyState(state);
+        return 1;
+    }
+
+    /* Everything is encoded from 16-bit mono, and stereo just repeats it. */
+    mono_spec.format = SDL_AUDIO_S16;
+    mono_spec.channels = 1;
+    mono_spec.freq = spec.freq;
+    src_frames = 0;
+    {
+        Uint8 *converted = NULL;
+        int converted_len = 0;
+        if (SDL_ConvertAudioSamples(&spec, audio_buf, (int)audio_len, &mono_spec, &converted, &converted_len) == 0) {
+            src_frames = converted_len / (int)sizeof(Sint16);
+            mono = (Sint16 *)converted;
+        }
+    }
+    SDL_free(audio_buf);
+
+    long_frames = long_seconds * spec.freq;
+    effect_frames = SDL_min(EFFECT_MS * spec.freq / 1000, long_frames);
+    if (src_frames > 0) {
+        Sint16 *looped = (Sint16 *)SDL_malloc((size_t)long_frames * sizeof(Sint16));
+        stereo = (Sint16 *)SDL_malloc((size_t)long_frames * 2 * sizeof(Sint16));
+        if (looped && stereo) {
+            for (i = 0; i < long_frames; i++) {
+                looped[i] = mono[i % src_frames];
+                stereo[i * 2] = looped[i];
+                stereo[i * 2 + 1] = (Sint16)(looped[i] / 2);
+            }
+        }
+        SDL_free(mono);
+        mono = looped;
+    }
+
+    if (!mono || !stereo) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert %s: %s\n", filename, SDL_GetError());
+        ++errors;
+    } else {
+        SDL_Log("Decoding %s transcoded to each format, %d ms effects and %d s files at %d Hz", filename, EFFECT_MS, long_seconds, spec.freq);
+        for (f = 0; f < (int)SDL_arraysize(formats); f++) {
+            errors += BenchmarkFormat(&formats[f], 1, spec.freq, mono, effect_frames, long_frames);
+            errors += BenchmarkFormat(&formats[f], 2, spec.freq, stereo, effect_frames, long_frames);
+        }
+    }
+
+    SDL_free(mono);
+    SDL_free(stereo);
+    SDL_free(filename);
+    SDL_Quit();
+    SDLTest_CommonDestroyState(state);
+
+    return errors ? 1 : 0;
+}